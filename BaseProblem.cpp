@@ -11,10 +11,15 @@
 
 #include <assert.h>
 #include <algorithm>
-#include <stack>
+#include <queue>
+#include <limits>
+#include <map>
+#include <utility>
 
 #include "Point.h"
 #include "NonDominatedSet.h"
+#include "ConvexHull.h"
+#include "FacetHeap.h"
 #include "utility.h"
 
 
@@ -30,12 +35,13 @@ namespace pareto_approximator {
 
 //! BaseProblem's default constructor. (empty)
 template <class S> 
-BaseProblem<S>::BaseProblem() 
-{
-  // not really needed (it is done automatically)
-  // - added this line just to make the code more explicit
-  usedWeightVectors_ = std::list< std::vector<double> >();
-}
+BaseProblem<S>::BaseProblem() : combResults_(0.0), numThreads_(1), 
+                                 threadPool_(), maxCombCalls_(0), 
+                                 timeLimit_(0.0), 
+                                 combApproximationDelta_(0.0), 
+                                 numCombCalls_(0), 
+                                 newPointCallback_(), cancelled_(false), 
+                                 approximationErrorUpperBound_(0.0) { }
 
 
 //! BaseProblem's default destructor. (virtual and empty)
@@ -43,6 +49,100 @@ template <class S>
 BaseProblem<S>::~BaseProblem() { }
 
 
+//! Optimize many linear combinations of the objectives at once.
+/*! 
+ *  \param weightVectors A vector of weight vectors. (each one is a 
+ *                       std::vector<double> of weights w_{i}, just like 
+ *                       the ones comb() gets)
+ *  \return A vector containing one PointAndSolution<S> object for each 
+ *          weight vector (in the same order). Each one is exactly what 
+ *          comb() returned for the corresponding weight vector.
+ *  
+ *  BaseProblem's combBatch() simply calls comb() for each weight vector. 
+ *  If there is more than one thread (see setNumThreads()) the comb() 
+ *  calls run concurrently on the thread pool.
+ *  
+ *  Users can override it if their problem can answer many weight vectors 
+ *  in one pass. (see the declaration for more info)
+ *  
+ *  \sa comb(), prefersCombBatches() and setNumThreads()
+ */
+template <class S> 
+std::vector< PointAndSolution<S> > 
+BaseProblem<S>::combBatch(
+                  const std::vector< std::vector<double> > & weightVectors)
+{
+  return combEach(weightVectors, NULL);
+}
+
+
+//! Optimize a linear combination of the objectives, warm-started.
+/*! 
+ *  \param first Iterator to the first weight.
+ *  \param last Iterator to the past-the-end weight.
+ *  \param hint Ignored.
+ *  \return Whatever comb() returns for the same weights.
+ *  
+ *  BaseProblem's combWithHint() just calls comb(). (see the declaration 
+ *  for more info)
+ *  
+ *  \sa comb(), combBatchWithHints() and CombHint
+ */
+template <class S> 
+PointAndSolution<S> 
+BaseProblem<S>::combWithHint(std::vector<double>::const_iterator first, 
+                             std::vector<double>::const_iterator last, 
+                             const CombHint<S> & /* hint */)
+{
+  return comb(first, last);
+}
+
+
+//! Optimize many linear combinations of the objectives, warm-started.
+/*! 
+ *  \param weightVectors A vector of weight vectors.
+ *  \param hints One hint for each weight vector.
+ *  \return One PointAndSolution<S> object for each weight vector. (in 
+ *          the same order)
+ *  
+ *  Calls combBatch() (without the hints) if the problem prefers batches 
+ *  or combWithHint() for each weight vector otherwise. (see the 
+ *  declaration for more info)
+ *  
+ *  \sa combBatch(), combWithHint() and prefersCombBatches()
+ */
+template <class S> 
+std::vector< PointAndSolution<S> > 
+BaseProblem<S>::combBatchWithHints(
+                  const std::vector< std::vector<double> > & weightVectors, 
+                  const std::vector< CombHint<S> > & hints)
+{
+  assert(hints.size() == weightVectors.size());
+
+  if (prefersCombBatches())
+    return combBatch(weightVectors);
+  // else
+
+  return combEach(weightVectors, &hints);
+}
+
+
+//! Should Chord and PGEN collect weight vectors for combBatch()?
+/*! 
+ *  \return false. (BaseProblem's combBatch() just calls comb() for each 
+ *          weight vector - it is not any faster than separate comb() 
+ *          calls)
+ *  
+ *  \sa combBatch() and useCombBatches()
+ */
+template <class S> 
+bool 
+BaseProblem<S>::prefersCombBatches() const
+{
+  return false;
+}
+
+
 //! Compute an (1+eps)-approximate convex Pareto set of the problem.
 /*! 
  *  \param numObjectives The number of objectives to minimize. Note: The 
@@ -66,9 +166,9 @@ BaseProblem<S>::~BaseProblem() { }
  *  computeConvexParetoSet() will use the comb() method that the user 
  *  implemented. That is why comb() is declared virtual.
  *
- *  computeConvexParetoSet() initializes the usedWeightVectors_ 
- *  attribute to an empty list every time it is called (before it 
- *  calls any other method).
+ *  computeConvexParetoSet() clears the combResults_ memo (and the 
+ *  pointPool_) every time it is called (before it calls any other 
+ *  method).
  *
  *  \sa BaseProblem, PointAndSolution and Point
  */
@@ -76,17 +176,66 @@ template <class S>
 std::vector< PointAndSolution<S> > 
 BaseProblem<S>::computeConvexParetoSet(unsigned int numObjectives, 
                                        double eps) 
+{
+  return computeConvexParetoSet(numObjectives, eps, NewPointCallback());
+}
+
+
+/*!
+ *  \brief Compute an (1+eps)-approximate convex Pareto set of the 
+ *         problem, passing each new point to a callback as soon as it 
+ *         is found.
+ *  
+ *  \param numObjectives The number of objectives to minimize.
+ *  \param eps The degree of approximation.
+ *  \param newPointCallback Called for each new point (may be empty). If 
+ *                          it returns false computeConvexParetoSet() 
+ *                          stops.
+ *  \return An (1+eps)-approximate convex Pareto set of the problem or, 
+ *          if the callback cancelled the computation, all the points 
+ *          passed to it so far. (not filtered)
+ *  
+ *  Does all the work for both versions of computeConvexParetoSet(). 
+ *  (see the declaration for more info)
+ *  
+ *  \sa BaseProblem, NewPointCallback and reportNewPoints()
+ */
+template <class S> 
+std::vector< PointAndSolution<S> > 
+BaseProblem<S>::computeConvexParetoSet(unsigned int numObjectives, 
+                                       double eps, 
+                                       NewPointCallback newPointCallback) 
 {
   // reminder: comb's arguments are a set of iterators over a 
   // std::vector<double> of weights (one for each objective)
 
   assert(eps >= 0.0);
   assert(numObjectives >= 2);
-  assert(numObjectives <= 3);
 
-  // Clear the list of used weight vectors.
+  // The facets' eps. (see setCombApproximationDelta())
+  // - comb()'s points may be (1+delta) times further from the origin than 
+  //   the Pareto points, so a facet within facetEps of comb()'s point is 
+  //   within eps of the Pareto points: (1+facetEps)(1+delta) = 1+eps
+  double facetEps = eps;
+  if (combApproximationDelta_ > 0.0)
+    facetEps = std::max((1.0 + eps) / (1.0 + combApproximationDelta_) - 1.0, 
+                        0.0);
+
+  // Forget the points comb() returned so far.
   // - In case computeConvexParetoSet() was called earlier.
-  usedWeightVectors_.clear();
+  combResults_.clear();
+  pointPool_.clear();
+
+  // Start counting comb() calls and time. (see setMaxCombCalls() and 
+  // setTimeLimit())
+  numCombCalls_ = 0;
+  approximationErrorUpperBound_ = 0.0;
+  newPointCallback_ = newPointCallback;
+  cancelled_ = false;
+  if (timeLimit_ > 0.0)
+    deadline_ = std::chrono::steady_clock::now() + 
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(timeLimit_));
 
   // Find a best solution for each objective. 
   // - We'll end up with up to \#numObjectives (possibly less) different 
@@ -98,71 +247,116 @@ BaseProblem<S>::computeConvexParetoSet(unsigned int numObjectives,
   //   dominated but not strongly dominated). In case we do not want this, 
   //   we can use a very small positive number (e.g. eps/2) where we would 
   //   use 0.
+  // - The anchors' comb() calls are independent of each other, 
+  //   generateNewParetoPoints() will run them concurrently if we have 
+  //   more than one thread.
   // CHANGE temporary
   std::vector<double> weights(numObjectives, eps/2);
 //  std::vector<double> weights(numObjectives, 0.0);
-  std::vector< PointAndSolution<S> > anchors;
+  std::vector< std::vector<double> > anchorWeightVectors;
   for (unsigned int i = 0; i != numObjectives; ++i) {
     // make only the i'th element of the weight vector non-zero
     weights[i] = 1.0;
-    // generate an anchor
-    PointAndSolution<S> anchor = generateNewParetoPoint(weights);
-    assert(not anchor.isNull());
-    anchors.push_back(anchor);
+    anchorWeightVectors.push_back(weights);
     // restore the weight vector's i'th element (all zero again)
     // CHANGE temporary
     weights[i] = eps/2;
 //    weights[i] = 0.0;
   }
+  // generate the anchors
+  // - Like every point below, each anchor is a reference to a point (and 
+  //   solution) in pointPool_. (see PointPool)
+  std::vector< PointAndSolution<PoolIndex> > anchors;
+  anchors = generateNewParetoPoints(anchorWeightVectors);
+  for (unsigned int i = 0; i != numObjectives; ++i)
+    assert(not anchors[i].isNull());
 
   // Filter the anchor points (some might be weakly-dominated by others).
   // - We might even have 1 anchor point that dominates all the others. In 
   //   that case just return the single anchor point as the result.
   // - We use a NonDominatedSet for the filtering.
-  std::vector< PointAndSolution<S> > results;
-  NonDominatedSet< PointAndSolution<S> > nds(anchors.begin(), anchors.end());
+  std::vector< PointAndSolution<PoolIndex> > results;
+  NonDominatedSet< PointAndSolution<PoolIndex> > nds(anchors.begin(), 
+                                                     anchors.end());
 
   assert( (nds.size() > 0) && (nds.size() <= numObjectives) );
-  if (nds.size() == 1) 
+  // (approximationErrorUpperBound_ stays 0.0 in the two cases below, 
+  // there are no facets to refine)
+  if (nds.size() == 1) {
     // We are very lucky, we got a single solution that is optimum in 
     // every objective!!!
     results.assign(nds.begin(), nds.end());
-  else if ( (nds.size() > 1) && (nds.size() < numObjectives) ) 
+    reportNewPoints(results.begin(), results.end(), 0.0);
+  }
+  else if ( (nds.size() > 1) && (nds.size() < numObjectives) ) {
     // Not enough anchor points to continue.
     // - Return the anchor points we have so far.
     results.assign(nds.begin(), nds.end());
+    reportNewPoints(results.begin(), results.end(), 0.0);
+  }
   else {
     // Exactly \#numObjectives anchor points - enough to continue.
     // (no anchor point was dominated by any other)
 
     // make the convex hull of the anchor points (it is just a single facet)
-    Facet<S> anchorFacet(anchors.begin(), anchors.end());
+    Facet<PoolIndex> anchorFacet(anchors.begin(), anchors.end());
+
+    // Pass the anchor points to the newPointCallback_ (if any).
+    // - The anchor facet's bound is the only bound we have. (none if it 
+    //   is a boundary facet)
+    double anchorErrorUpperBound = std::numeric_limits<double>::infinity();
+    if (not anchorFacet.isBoundaryFacet())
+      anchorErrorUpperBound = anchorFacet.getLocalApproximationErrorUpperBound();
+    reportNewPoints(anchors.begin(), anchors.end(), anchorErrorUpperBound);
 
     // Call doChord() for biobjective problems or doPgen() for 
-    // more than two objectives.
-    std::vector< PointAndSolution<S> > unfilteredResults;
-    if (numObjectives == 2) {
+    // more than two objectives. (unless the newPointCallback_ cancelled 
+    // the computation already)
+    std::vector< PointAndSolution<PoolIndex> > unfilteredResults;
+    if (cancelled_)
+      unfilteredResults = anchors;
+    else if (numObjectives == 2) {
       // anchorFacet is just a single line segment for numObjectives == 2
 
       // Let doChord do all the work.
-      unfilteredResults = doChord(anchorFacet, eps);
+      unfilteredResults = doChord(anchorFacet, facetEps);
     }
     else {
       assert(numObjectives > 2);
 
       // Let doPgen do all the work.
-      unfilteredResults = doPgen(numObjectives, anchorFacet, eps);
+      unfilteredResults = doPgen(numObjectives, anchorFacet, facetEps);
     }
 
     // Filter the results.
     // - Some of the anchor points might be weakly Pareto optimal, so 
     //   some of the points computed by doChord might dominate them. 
-    results = pareto_approximator::utility::
-                      filterDominatedPoints<S>(unfilteredResults.begin(), 
-                                               unfilteredResults.end());
+    // - Unless the newPointCallback_ cancelled the computation. (it does 
+    //   not want to wait for the filtering)
+    if (cancelled_)
+      results.swap(unfilteredResults);
+    else
+      results = pareto_approximator::utility::
+                    filterDominatedPoints<PoolIndex>(unfilteredResults.begin(), 
+                                                     unfilteredResults.end(), 
+                                                     numThreads_);
   }
 
-  return results;
+  // The facets' bound assumes comb() is exact; add comb()'s delta.
+  approximationErrorUpperBound_ = 
+                  withCombApproximationDelta(approximationErrorUpperBound_);
+
+  // Move the resulting points (and solutions) out of the pool and forget 
+  // the rest.
+  std::vector< PointAndSolution<S> > paretoSet;
+  paretoSet = pointPool_.take(results.begin(), results.end());
+  combResults_.clear();
+  pointPool_.clear();
+
+  // Don't hold on to the callback (and whatever it refers to).
+  newPointCallback_ = NewPointCallback();
+
+  return paretoSet;
 }
 
 
@@ -171,9 +365,9 @@ BaseProblem<S>::computeConvexParetoSet(unsigned int numObjectives,
  * 
  *  \param anchorFacet The Facet defined by the anchor points.
  *  \param eps The degree of approximation. 
- *  \return A vector of Pareto optimal points (PointAndSolution instances).
- *          It might contain weakly-dominated points (some of the anchor 
- *          points). 
+ *  \return A vector of Pareto optimal points (references to points in 
+ *          pointPool_). It might contain weakly-dominated points (some 
+ *          of the anchor points). 
  *  
  *  Note: doChord() is only called for problems with exactly 2 criteria.
  *  
@@ -181,11 +375,24 @@ BaseProblem<S>::computeConvexParetoSet(unsigned int numObjectives,
  *  It's just a routine that BaseProblem::computeConvexParetoSet() uses 
  *  to do most of the work.
  *  
- *  doChord() has a big while loop that processes facets (from a stack). 
- *  On each iteration doChord() finds at most one new Pareto optimal point, 
- *  makes new facets using that point and pushes the new facets on the 
- *  stack (iff they improve the approximation; if the requested degree of 
- *  approximation has been met, no new facets are pushed onto the stack).
+ *  doChord() has a big while loop that processes facets (from a priority 
+ *  queue, largest local approximation error upper bound first). On each 
+ *  iteration doChord() finds at most one new Pareto optimal point, makes 
+ *  new facets using that point and pushes the new facets into the queue 
+ *  (facets within the requested degree of approximation are dropped when 
+ *  they reach the top of the queue).
+ *  
+ *  If we work in rounds (more than one thread or a problem that prefers 
+ *  combBatch() - see prefersCombBatches()) each iteration processes 
+ *  every facet in the queue instead of just the top one, passing all 
+ *  their weight vectors to combBatch() at once.
+ *  
+ *  doChord() stops early if it runs out of comb() calls or time (see 
+ *  setMaxCombCalls() and setTimeLimit()). Since it always refines the 
+ *  worst facets first, the points found so far approximate the whole 
+ *  Pareto set equally well. It sets approximationErrorUpperBound_ to the 
+ *  largest approximation error upper bound of any facet it either did 
+ *  not refine or was done with.
  *  
  *  Please read "How good is the Chord Algorithm?" by Constantinos 
  *  Daskalakis, Ilias Diakonikolas and Mihalis Yannakakis for in-depth 
@@ -194,98 +401,174 @@ BaseProblem<S>::computeConvexParetoSet(unsigned int numObjectives,
  *  \sa computeConvexParetoSet(), BaseProblem, PointAndSolution and Point
  */
 template <class S> 
-std::vector< PointAndSolution<S> > 
-BaseProblem<S>::doChord(Facet<S> anchorFacet, double eps) 
+std::vector< PointAndSolution<PoolIndex> > 
+BaseProblem<S>::doChord(Facet<PoolIndex> anchorFacet, double eps) 
 {
   // reminder: comb accepts a set of iterators to the objectives' weights
 
   assert(anchorFacet.spaceDimension() == 2);
 
   // a vector that will hold all the approximation points:
-  std::vector< PointAndSolution<S> > results;
+  std::vector< PointAndSolution<PoolIndex> > results;
   results.assign(anchorFacet.beginVertex(), anchorFacet.endVertex());
 
-  // a stack of Facets to try (for generating new Pareto optimal points):
-  std::stack< Facet<S> > facetsToTry;
+  // a priority queue of Facets to try (for generating new Pareto optimal 
+  // points), the facet with the largest local approximation error upper 
+  // bound on top:
+  typedef std::priority_queue< Facet<PoolIndex>, std::vector< Facet<PoolIndex> >, 
+                   pareto_approximator::utility::
+                   FacetHasSmallerLocalApproximationErrorUpperBound<PoolIndex> > 
+          FacetQueue;
+  FacetQueue facetsToTry;
   facetsToTry.push(anchorFacet);
 
-  while (not facetsToTry.empty()) {
-    // Get a facet from the stack and try to generate a new Pareto 
-    // optimal point using that facet.
-    Facet<S> generatingFacet = facetsToTry.top();
-    facetsToTry.pop();
-
-    // if the facet's local approximation error upper bound is less 
-    // than the tolerance move on to the next facet
-    if (generatingFacet.getLocalApproximationErrorUpperBound() <= eps)
-      continue;
-
-    PointAndSolution<S> opt = 
-                        generateNewParetoPointUsingFacet(generatingFacet);
-
-    // We will never encounter the same weight vector twice in 
-    // biobjective problems. 
-    //assert(not opt.isNull());
-    if (opt.isNull())
-      continue;
-
-    // Note: the generatingFacet will always have an all-positive normal 
-    //       vector in biobjective problems
-
-    // Check if the point we just found is approximately dominated by the 
-    // facet that made it (i.e. dominated by some convex combination of 
-    // the facet's two vertices). 
-    // - If it is dominated ignore it. (try the next facet)
-    // - It is dominated if it is one of the facet's two vertices.
-    if (generatingFacet.dominates(opt.point, eps))
-      continue;
-    // else
+  // the largest approximation error upper bound of the facets we are 
+  // done with
+  double doneErrorUpperBound = 0.0;
+
+  while (not facetsToTry.empty() and not budgetExhausted() and 
+         not cancelled_) {
+    // Get the facets we will try in this round from the queue.
+    // - Just one facet, unless we work in rounds (see useCombBatches()).
+    // - Every facet in the queue if we work in rounds (but no more than 
+    //   the comb() calls we have left). The facets are independent of 
+    //   each other so their weight vectors can all go to combBatch() at 
+    //   once (and their comb() calls can run concurrently).
+    // - if the top facet's local approximation error upper bound is less 
+    //   than the tolerance so are all the others - we are done
+    unsigned int maxRoundSize = useCombBatches() ? remainingCombCalls() : 1;
+    std::vector< Facet<PoolIndex> > generatingFacets;
+    std::vector< std::vector<double> > weightVectors;
+    std::vector< CombHint<S> > hints;
+    while ( not facetsToTry.empty() and 
+            generatingFacets.size() < maxRoundSize ) {
+      Facet<PoolIndex> facet = facetsToTry.top();
+      facetsToTry.pop();
+
+      if (facet.getLocalApproximationErrorUpperBound() <= eps) {
+        doneErrorUpperBound = std::max(doneErrorUpperBound, 
+                            facet.getLocalApproximationErrorUpperBound());
+        facetsToTry = FacetQueue();
+        break;
+      }
+      // else
 
-    // Add opt to the list of approximation points.
-    results.push_back(opt);
-
-    // Keep (for the new facet/facets) only those vertices of 
-    // generatingFacet that opt doesn't dominate. 
-    std::vector< PointAndSolution<S> > newFacetVertices;
-    typename Facet<S>::ConstVertexIterator fvi;
-    for (fvi = generatingFacet.beginVertex(); 
-         fvi != generatingFacet.endVertex(); ++fvi) 
-      if (!opt.dominates(*fvi))
-        newFacetVertices.push_back(*fvi);
-
-    // Make the new facets (using generatingFacet and opt) and push them 
-    // onto the stack.
-    if (newFacetVertices.size() == 0)
-      // opt dominated both of generatingFacet's vertices.
-      // - This can only happen if generatingFacet's vertices were both 
-      //   anchor points. 
-      // - Don't make any new facets, opt is the utopia point - we will 
-      //   not find any more points. (don't need any)
-      continue;
-    else if (newFacetVertices.size() == 1) {
-      // enough points (including opt) for exactly one new facet
-      newFacetVertices.push_back(opt);
-      Facet<S> newFacet(newFacetVertices.begin(), newFacetVertices.end());
-      facetsToTry.push(newFacet);
+      generatingFacets.push_back(facet);
+      weightVectors.push_back(pareto_approximator::utility::
+                              generateNewWeightVector<PoolIndex>(facet));
+      hints.push_back(makeCombHint(facet, weightVectors.back()));
     }
-    else {
-      assert(newFacetVertices.size() == 2);
-      // Enough points (including opt) for two new facets.
-      // opt is not yet included in newFacetVertices - newFacetVertices 
-      // currently contains the vertices of generatingFacet
-      PointAndSolution<S> tempVertex;
-      for (unsigned int i = 0; i != 2; ++i) {
-        // Temporarily replace one of the old facet vertices with opt.
-        tempVertex = newFacetVertices[i];
-        newFacetVertices[i] = opt;
-        // Push the new facet on top of the stack.
-        Facet<S> newFacet(newFacetVertices.begin(), newFacetVertices.end());
+
+    // Try to generate a new Pareto optimal point using each facet.
+    // - each facet's vertices are comb()'s hint (see combWithHint())
+    // - comb() may find nothing better than the best of them (the hint's 
+    //   upper bound); we then get that vertex back, which the facet 
+    //   dominates
+    std::vector< PointAndSolution<PoolIndex> > newPoints;
+    newPoints = generateNewParetoPoints(weightVectors, hints);
+    unsigned int numOldResults = results.size();
+
+    for (unsigned int k = 0; k != generatingFacets.size(); ++k) {
+      const Facet<PoolIndex> & generatingFacet = generatingFacets[k];
+      const PointAndSolution<PoolIndex> & opt = newPoints[k];
+
+      // Note: the generatingFacet will always have an all-positive normal 
+      //       vector in biobjective problems
+
+      // Check if the point we just found is approximately dominated by the 
+      // facet that made it (i.e. dominated by some convex combination of 
+      // the facet's two vertices). 
+      // - If it is dominated ignore it. (try the next facet)
+      // - It is dominated if it is one of the facet's two vertices.
+      // - The Pareto points below the facet are no further from it than 
+      //   opt, since opt minimizes the facet's weights.
+      // - No need to check opt's point again: completeNewParetoPoint() 
+      //   did. (and eps >= 0, see computeConvexParetoSet())
+      if (generatingFacet.dominatesUnchecked(opt.point, eps)) {
+        doneErrorUpperBound = std::max(doneErrorUpperBound, 
+                              generatingFacet.distanceUnchecked(opt.point));
+        continue;
+      }
+      // else
+
+      // Have we found opt before? 
+      // - It can happen if the facet's weights (almost) match weights we 
+      //   have used before. (see setWeightVectorTolerance())
+      // - We cannot refine the facet any further, so its bound stays.
+      if (std::find(results.begin(), results.end(), opt) != results.end()) {
+        doneErrorUpperBound = std::max(doneErrorUpperBound, 
+                      generatingFacet.getLocalApproximationErrorUpperBound());
+        continue;
+      }
+      // else
+
+      // Add opt to the list of approximation points.
+      results.push_back(opt);
+
+      // Keep (for the new facet/facets) only those vertices of 
+      // generatingFacet that opt doesn't dominate. 
+      std::vector< PointAndSolution<PoolIndex> > newFacetVertices;
+      typename Facet<PoolIndex>::ConstVertexIterator fvi;
+      for (fvi = generatingFacet.beginVertex(); 
+           fvi != generatingFacet.endVertex(); ++fvi) 
+        if (!opt.point.dominatesUnchecked(fvi->point))
+          newFacetVertices.push_back(*fvi);
+
+      // Make the new facets (using generatingFacet and opt) and push them 
+      // into the queue.
+      if (newFacetVertices.size() == 0)
+        // opt dominated both of generatingFacet's vertices.
+        // - This can only happen if generatingFacet's vertices were both 
+        //   anchor points. 
+        // - Don't make any new facets, opt is the utopia point - we will 
+        //   not find any more points. (don't need any)
+        continue;
+      else if (newFacetVertices.size() == 1) {
+        // enough points (including opt) for exactly one new facet
+        newFacetVertices.push_back(opt);
+        Facet<PoolIndex> newFacet(newFacetVertices.begin(), newFacetVertices.end());
         facetsToTry.push(newFacet);
-        // Restore newFacetVertices (replace opt with the old facet vertex).
-        newFacetVertices[i] = tempVertex;
       }
+      else {
+        assert(newFacetVertices.size() == 2);
+        // Enough points (including opt) for two new facets.
+        // opt is not yet included in newFacetVertices - newFacetVertices 
+        // currently contains the vertices of generatingFacet
+        PointAndSolution<PoolIndex> tempVertex;
+        for (unsigned int i = 0; i != 2; ++i) {
+          // Temporarily replace one of the old facet vertices with opt.
+          tempVertex = newFacetVertices[i];
+          newFacetVertices[i] = opt;
+          // Push the new facet into the queue.
+          Facet<PoolIndex> newFacet(newFacetVertices.begin(), newFacetVertices.end());
+          facetsToTry.push(newFacet);
+          // Restore newFacetVertices (replace opt with the old facet vertex).
+          newFacetVertices[i] = tempVertex;
+        }
+      }
+    }   // for each generating facet
+
+    // Pass the points we accepted in this round to the newPointCallback_.
+    // - The current bound is the largest of the bounds of the facets we 
+    //   are done with and of the facets in the queue. (the top facet has 
+    //   the largest bound)
+    if (results.size() != numOldResults) {
+      double errorUpperBound = doneErrorUpperBound;
+      if (not facetsToTry.empty())
+        errorUpperBound = std::max(errorUpperBound, 
+                    facetsToTry.top().getLocalApproximationErrorUpperBound());
+      reportNewPoints(results.begin() + numOldResults, results.end(), 
+                      errorUpperBound);
     }
-  }   // while (not facetsToTry.empty())
+  }   // while (not facetsToTry.empty() and not budgetExhausted() and ...)
+
+  // The facets we did not get to try (if we ran out of comb() calls or 
+  // time or were cancelled) count too. 
+  // - the top facet has the largest bound
+  approximationErrorUpperBound_ = doneErrorUpperBound;
+  if (not facetsToTry.empty())
+    approximationErrorUpperBound_ = std::max(approximationErrorUpperBound_, 
+                    facetsToTry.top().getLocalApproximationErrorUpperBound());
 
   return results;
 }
@@ -300,10 +583,35 @@ BaseProblem<S>::doChord(Facet<S> anchorFacet, double eps)
  *                       weights.
  *  \param anchors The Facet defined by the anchor points.
  *  \param eps The degree of approximation. 
- *  \return A vector of Pareto optimal points (PointAndSolution instances).
- *          BaseProblem::computeConvexParetoSet() will filter them to make 
- *          the (1+eps)-approximate convex Pareto set.
+ *  \return A vector of Pareto optimal points (references to points in 
+ *          pointPool_). BaseProblem::computeConvexParetoSet() will filter 
+ *          them to make the (1+eps)-approximate convex Pareto set.
  *
+ *  On each iteration doPgen() tries the facet with the largest local 
+ *  approximation error upper bound or, if we work in rounds (see 
+ *  prefersCombBatches()), every facet whose local approximation error 
+ *  upper bound is larger than eps at once.
+ *  
+ *  The convex hull of the approximation points is maintained 
+ *  incrementally (see ConvexHull): each new point only replaces the 
+ *  facets it can see, the rest keep their local approximation error 
+ *  upper bounds. The facets are kept in a FacetHeap, so choosing a facet 
+ *  does not get slower as the approximation grows.
+ *  
+ *  With three objectives a facet whose normal vector has negative 
+ *  elements may not give us a new point even though there are Pareto 
+ *  points beneath it. Its local approximation error upper bound still 
+ *  counts until, after the other facets, doPgen() tries the weight 
+ *  vectors of the strips along the hull's edges (see 
+ *  utility::generateEdgeWeightVectors()) and none of them gives us a new 
+ *  point either.
+ *  
+ *  doPgen() stops early if it runs out of comb() calls or time (see 
+ *  setMaxCombCalls() and setTimeLimit()). In the end it sets 
+ *  approximationErrorUpperBound_ to the largest local approximation error 
+ *  upper bound of the (non-boundary) facets left, including those that 
+ *  are stuck.
+ *  
  *  Please read "Approximating convex Pareto surfaces in multiobjective 
  *  radiotherapy planning" by David L. Craft et al. (2006) for more 
  *  info on the algorithm.
@@ -311,26 +619,26 @@ BaseProblem<S>::doChord(Facet<S> anchorFacet, double eps)
  *  \sa computeConvexParetoSet(), BaseProblem, PointAndSolution and Point
  */
 template <class S> 
-std::vector< PointAndSolution<S> > 
-BaseProblem<S>::doPgen(unsigned int numObjectives, Facet<S> anchorFacet, 
-                        double eps) 
+std::vector< PointAndSolution<PoolIndex> > 
+BaseProblem<S>::doPgen(unsigned int numObjectives, 
+                       Facet<PoolIndex> anchorFacet, double eps) 
 {
   // reminder: comb accepts a set of iterators to the objectives' weights
 
-  assert(numObjectives <= 3);
-  assert(anchorFacet.spaceDimension() <= 3);
+  assert(numObjectives > 2);
   assert(anchorFacet.spaceDimension() == numObjectives);
 
   unsigned int spaceDimension = numObjectives;
 
-  std::vector< PointAndSolution<S> > 
+  std::vector< PointAndSolution<PoolIndex> > 
                             approximationPoints(anchorFacet.beginVertex(), 
                                                 anchorFacet.endVertex());
 
-  // We need to add one more point (interior point) before we can call qconvex.
+  // We need to add one more point (interior point) before we can compute 
+  // the convex hull.
 
   // Make a Pareto point using anchorFacet as a generating facet.
-  PointAndSolution<S> interiorPoint = 
+  PointAndSolution<PoolIndex> interiorPoint = 
                       generateNewParetoPointUsingFacet(anchorFacet);
 
   // Is interiorPoint either an existing point or coplanar with the facet?
@@ -354,6 +662,7 @@ BaseProblem<S>::doPgen(unsigned int numObjectives, Facet<S> anchorFacet,
     //   is not completely unlikely that some other weight vector might 
     //   produce one but we have no systematic way to try every one of the 
     //   infinite possible weight vectors.
+    // - approximationErrorUpperBound_ stays 0.0, no facets to refine.
     return approximationPoints;
   }
   // else 
@@ -361,85 +670,256 @@ BaseProblem<S>::doPgen(unsigned int numObjectives, Facet<S> anchorFacet,
   // Add the new point to the existing set of approximation points.
   approximationPoints.push_back(interiorPoint);
 
-  // Compute the convex hull of the approximation points. 
-  // - Each facet has a local approximation error upper bound built-in.
-  // - That local approximation error upper bound is computed during the 
-  //   construction of the Facet instance.
-  std::list< Facet<S> > facets;
-  facets = pareto_approximator::utility::
-                       computeConvexHullFacets<S>(approximationPoints, 
-                                                  spaceDimension);
-  // Discard facets with all-negative normal vectors.
-  pareto_approximator::utility::discardUselessFacets<S>(facets);
-
-  while (not facets.empty()) {
-    // Choose the facet with largest local approximation error upper bound.
-    typename std::list< Facet<S> >::iterator generatingFacet;
-    generatingFacet = pareto_approximator::utility::
-                    chooseFacetWithLargestLocalApproximationErrorUpperBound<S>(
-                                          facets.begin(), facets.end());
-
-    // Were there any facets (except boundary facets)? 
-    if (generatingFacet != facets.end()) {
-      // generatingFacet is not a boundary facet
-
-      // Have we reached the required approximation factor?
-      // - the facet is surely not a boundary facet, it surely has a 
-      //   local approximation error upper bound
-      // - if we have reached the required approximation factor stop 
-      //   the algorithm
-      if (generatingFacet->getLocalApproximationErrorUpperBound() <= eps) 
+  // The convex hull of the approximation points. We keep it (and the 
+  // facets we made out of its facets) up to date as we find new points: 
+  // - Each new point only removes the hull facets it can see and adds 
+  //   the facets between itself and the horizon. 
+  // - Facets it cannot see are left untouched. The Facet<PoolIndex> instances we 
+  //   made out of them (and their local approximation error upper 
+  //   bounds, computed during their construction) are kept.
+  // - "facets" holds the Facet<PoolIndex> instance we made out of each hull 
+  //   facet, under the hull facet's id. Hull facets with all-negative 
+  //   normal vectors (i.e. useless facets) and facets that did not give 
+  //   us a new point are not in it.
+  // - "facets" is a FacetHeap, i.e. choosing the facet with the largest 
+  //   local approximation error upper bound (or a boundary facet) takes 
+  //   O(1) time and inserting or erasing a facet O(log n) time.
+  // - "stuckFacets" maps the ids of the (three objective) facets whose 
+  //   normal vectors have negative elements and which did not give us a 
+  //   new point to their local approximation error upper bounds. (see 
+  //   below) These still count, until a new point removes the facets 
+  //   from the hull or we make sure that there is nothing beneath them.
+  ConvexHull hull(spaceDimension);
+  FacetHeap<PoolIndex> facets;
+  std::map<unsigned int, double> stuckFacets;
+
+  // The largest local approximation error upper bound of the facets left. 
+  // (both the ones in "facets" and the ones in "stuckFacets")
+  auto largestErrorUpperBound = [&facets, &stuckFacets] () {
+    double bound = facets.largestLocalApproximationErrorUpperBound();
+    std::map<unsigned int, double>::const_iterator it;
+    for (it = stuckFacets.begin(); it != stuckFacets.end(); ++it)
+      bound = std::max(bound, it->second);
+    return bound;
+  };
+
+  // A stuck facet's local approximation error upper bound. Every point 
+  // beneath the facet dominates its lower distal point L, i.e. it is 
+  // eps-dominated by the facet's vertices (its usual bound) and by any 
+  // point p with p_i <= (1 + eps) L_i for every i.
+  auto stuckFacetErrorUpperBound = [&approximationPoints, spaceDimension] (
+                                          const Facet<PoolIndex> & facet) {
+    Point lowerDistalPoint = facet.computeLowerDistalPoint();
+    double smallestRatio = std::numeric_limits<double>::infinity();
+    for (unsigned int p = 0; p != approximationPoints.size(); ++p) {
+      double ratio = 0.0;
+      for (unsigned int i = 0; i != spaceDimension; ++i)
+        ratio = std::max(ratio, approximationPoints[p].point[i] / 
+                                lowerDistalPoint[i]);
+      smallestRatio = std::min(smallestRatio, ratio);
+    }
+    return std::min(facet.getLocalApproximationErrorUpperBound(), 
+                    std::max(smallestRatio - 1.0, 0.0));
+  };
+
+  // Add the approximation points from "firstNewPoint" onwards to the hull 
+  // and update "facets".
+  auto updateFacets = [&hull, &facets, &stuckFacets, &approximationPoints] (
+                                          unsigned int firstNewPoint) {
+    unsigned int firstNewFacetId = hull.nextFacetId();
+    for (unsigned int i = firstNewPoint; i != approximationPoints.size(); ++i)
+      hull.addPoint(approximationPoints[i].point);
+
+    std::vector<unsigned int> removedFacetIds = hull.takeRemovedFacetIds();
+    for (unsigned int i = 0; i != removedFacetIds.size(); ++i) {
+      facets.erase(removedFacetIds[i]);
+      stuckFacets.erase(removedFacetIds[i]);
+    }
+
+    const std::vector<ConvexHull::HullFacet> & hullFacets = hull.getFacets();
+    for (unsigned int f = 0; f != hullFacets.size(); ++f) 
+      if (hullFacets[f].id >= firstNewFacetId) {
+        Facet<PoolIndex> facet = pareto_approximator::utility::
+                         makeFacet<PoolIndex>(hullFacets[f], approximationPoints);
+        // Discard facets with all-negative normal vectors.
+        if (not facet.hasAllNormalVectorElementsNonPositive())
+          facets.insert(hullFacets[f].id, facet);
+      }
+  };
+
+  // A point's weighted sum. (for the strips' weight vectors, see below)
+  auto weightedSum = [] (const Point & point, 
+                         const std::vector<double> & weights) {
+    double sum = 0.0;
+    for (unsigned int i = 0; i != weights.size(); ++i)
+      sum += weights[i] * point.coordinateUnchecked(i);
+    return sum;
+  };
+
+  updateFacets(0);
+
+  // Pass the interior point to the newPointCallback_ (if any).
+  reportNewPoints(approximationPoints.end() - 1, approximationPoints.end(), 
+                  largestErrorUpperBound());
+
+  while (not budgetExhausted() and not cancelled_) {
+    // Have we reached the required approximation factor? (or are there 
+    // no facets left?)
+    if (facets.empty() or (facets.hasInteriorFacets() and 
+          facets.largestLocalApproximationErrorUpperBound() <= eps)) {
+      // Do the stuck facets' bounds allow us to stop the algorithm?
+      if (largestErrorUpperBound() <= eps)
+        break;
+      // else 
+
+      // Try the weight vectors of the strips along the hull's edges. 
+      // (see utility::generateEdgeWeightVectors()) If none of them gives 
+      // us a new point there is nothing beneath the stuck facets either.
+      // - stuck facets only appear with three objectives (with more 
+      //   objectives they are boundary facets, see Facet::isBoundaryFacet())
+      assert(spaceDimension == 3);
+      std::vector< std::vector<double> > weightVectors = 
+                    pareto_approximator::utility::
+                    generateEdgeWeightVectors(hull, approximationPoints);
+      bool triedEveryStrip = (weightVectors.size() <= remainingCombCalls());
+      if (not triedEveryStrip)
+        weightVectors.resize(remainingCombCalls());
+      std::vector< PointAndSolution<PoolIndex> > newPoints;
+      newPoints = generateNewParetoPoints(weightVectors);
+
+      // Keep the points that are strictly beneath their strip. (a strip's 
+      // weight vector has a zero element, i.e. comb() may return a point 
+      // that only ties with the known points)
+      unsigned int numOldApproximationPoints = approximationPoints.size();
+      for (unsigned int k = 0; k != newPoints.size(); ++k) {
+        const std::vector<double> & weights = weightVectors[k];
+        double value = weightedSum(newPoints[k].point, weights);
+        bool isBeneath = true;
+        for (unsigned int p = 0; 
+             p != numOldApproximationPoints and isBeneath; ++p)
+          isBeneath = (value < weightedSum(approximationPoints[p].point, 
+                                           weights));
+        if (isBeneath and 
+            std::find(approximationPoints.begin(), approximationPoints.end(), 
+                      newPoints[k]) == approximationPoints.end())
+          approximationPoints.push_back(newPoints[k]);
+      }
+
+      if (approximationPoints.size() == numOldApproximationPoints) {
+        if (triedEveryStrip)
+          stuckFacets.clear();
         break;
+      }
       // else 
+
+      updateFacets(numOldApproximationPoints);
+      reportNewPoints(approximationPoints.begin() + numOldApproximationPoints, 
+                      approximationPoints.end(), 
+                      largestErrorUpperBound());
+      continue;
+    }
+    // else 
+
+    // Choose the facet (or facets, if we work in rounds) we will try next.
+    // - we keep the facets' ids
+    std::vector<unsigned int> generatingFacets;
+
+    if (useCombBatches()) {
+      // Working in rounds. Try every facet whose local approximation 
+      // error upper bound is larger than eps, all at once.
+      if (facets.hasInteriorFacets()) {
+        // Largest local approximation error upper bounds first, in case 
+        // there are not enough comb() calls left for all of them.
+        generatingFacets = facets.interiorFacetsAbove(eps);
+      }
+      else {
+        // Only boundary facets left. Try all of them.
+        generatingFacets = facets.boundaryFacets();
+      }
+
+      if (generatingFacets.size() > remainingCombCalls())
+        generatingFacets.resize(remainingCombCalls());
     }
     else {
-      // Choose the boundary facet with the smallest angle.
-      // The angle for a boundary facet is defined as the angle 
-      // between the facet normal vector n and the average of the 
-      // vertex weight vectors w.
-      generatingFacet = pareto_approximator::utility::
-                        chooseBoundaryFacetWithSmallestAngle<S>(
-                                           facets.begin(), facets.end());
-
-      if (generatingFacet == facets.end()) {
-        // There are no more facets. Exit
-        break;
+      // Were there any facets (except boundary facets)? 
+      if (facets.hasInteriorFacets()) {
+        // Choose the facet with largest local approximation error upper 
+        // bound.
+        generatingFacets.push_back(facets.topInteriorFacet());
       }
+      else {
+        // Choose a boundary facet. (all facets left are boundary facets)
+        // - currently the first one, like 
+        //   utility::chooseBoundaryFacetWithSmallestAngle() does
+        generatingFacets.push_back(facets.firstBoundaryFacet());
+      }
+    }
 
-      assert(generatingFacet->isBoundaryFacet());
+    // Make a new Pareto point using each generatingFacet as a generating 
+    // facet.
+    // Reminder: each generatingFacet is actually the id of a facet in 
+    //           "facets" - that is why we use facets.get()
+    // - each facet's vertices are comb()'s hint (see combWithHint())
+    std::vector< std::vector<double> > weightVectors;
+    std::vector< CombHint<S> > hints;
+    for (unsigned int k = 0; k != generatingFacets.size(); ++k) {
+      const Facet<PoolIndex> & facet = facets.get(generatingFacets[k]);
+      weightVectors.push_back(pareto_approximator::utility::
+                              generateNewWeightVector<PoolIndex>(facet));
+      hints.push_back(makeCombHint(facet, weightVectors.back()));
     }
+    std::vector< PointAndSolution<PoolIndex> > newPoints;
+    newPoints = generateNewParetoPoints(weightVectors, hints);
+
+    unsigned int numOldApproximationPoints = approximationPoints.size();
+    for (unsigned int k = 0; k != generatingFacets.size(); ++k) {
+      const PointAndSolution<PoolIndex> & opt = newPoints[k];
+
+      // Is opt an existing point?
+      if ( std::find(approximationPoints.begin(), 
+                     approximationPoints.end(), 
+                     opt) != approximationPoints.end() ) {
+        // Either we have already tried this set of weights (and got opt 
+        // back from the combResults_ memo) or opt has already been found 
+        // using a different weight vector.
+        // - discard generatingFacet and go on (i.e. choose another facet)
+        // - if its normal vector is non-negative we used it as weights, 
+        //   so there is nothing beneath the facet
+        // - else our weights only approximate its slope and (unless it 
+        //   is a boundary facet) its local approximation error upper 
+        //   bound still counts (see "stuckFacets")
+        // - the hull keeps the facet; if a new point removes it later 
+        //   FacetHeap::erase() will find nothing to erase
+        const Facet<PoolIndex> & facet = facets.get(generatingFacets[k]);
+        if (not facet.hasAllNormalVectorElementsNonNegative() and 
+            not facet.isBoundaryFacet())
+          stuckFacets[generatingFacets[k]] = 
+                    stuckFacetErrorUpperBound(facet);
+        facets.erase(generatingFacets[k]);
+        continue;
+      }
+      // else 
 
-    // Make a new Pareto point using generatingFacet as a generating facet.
-    // Reminder: generatingFacet is actually an iterator pointing to 
-    //           the actual facet - that is why we use the * operator
-    PointAndSolution<S> opt = 
-                        generateNewParetoPointUsingFacet(*generatingFacet);
-
-    // Is opt a null instance or an existing point?
-    if ( opt.isNull() or 
-         std::find(approximationPoints.begin(), 
-                   approximationPoints.end(), 
-                   opt) != approximationPoints.end() ) {
-      // Either we have already tried this set of weights
-      // or opt has already been found (using a different weight vector).
-      // - discard generatingFacet and go to the next iteration (i.e. 
-      //   choose another facet)
-      // Reminder: generatingFacet is actually an iterator pointing to one 
-      //           of "facets"'s elements
-      facets.erase(generatingFacet);
-      continue;
+      // opt is a new point - we will add it to the set of approximation 
+      // points 
+      approximationPoints.push_back(opt);
     }
-    // else 
 
-    // opt is a new point - we will add it to the set of approximation 
-    // points and calculate the new convex hull of the set
-    approximationPoints.push_back(opt);
-    facets = pareto_approximator::utility::
-                              computeConvexHullFacets<S>(approximationPoints, 
-                                                         spaceDimension);
-    pareto_approximator::utility::discardUselessFacets<S>(facets);
+    // If we found new points insert them into the convex hull of the set 
+    // of approximation points.
+    if (approximationPoints.size() != numOldApproximationPoints) {
+      updateFacets(numOldApproximationPoints);
+
+      // Pass the new points to the newPointCallback_ (if any).
+      reportNewPoints(approximationPoints.begin() + numOldApproximationPoints, 
+                      approximationPoints.end(), 
+                      largestErrorUpperBound());
+    }
   }
 
+  // The largest local approximation error upper bound of the facets left.
+  approximationErrorUpperBound_ = largestErrorUpperBound();
+
   return approximationPoints;
 }
 
@@ -451,14 +931,14 @@ BaseProblem<S>::doPgen(unsigned int numObjectives, Facet<S> anchorFacet,
  *  \param facet A Facet instance. (Its vertices' weightsUsed 
  *               attributes will be needed if the facet's normal vector 
  *               is not all-positive.)
- *  \return A Pareto optimal point (inside a PointAndSolution<S>  
- *          object) generated using the given facet, i.e. the weights 
- *          generated from the facet, if the weights were not used 
- *          before; a null PointAndSolution<S> object otherwise.
+ *  \return A Pareto optimal point (a reference to a point in 
+ *          pointPool_) generated using the given facet, i.e. the 
+ *          weights generated from the facet. (the point found earlier 
+ *          if the weights were used before)
  *          
  *  This method generates a weight vector using the given facet and 
  *  delegates the jobs of making a Pareto point and updating the 
- *  usedWeightVectors_ attribute to generateNewParetoPoint().
+ *  combResults_ memo to generateNewParetoPoint().
  *  
  *  This method will call:
  *  - pareto_approximator::generateNewWeightVector() (using the given 
@@ -472,14 +952,14 @@ BaseProblem<S>::doPgen(unsigned int numObjectives, Facet<S> anchorFacet,
  *      PointAndSolution and Point
  */
 template <class S> 
-PointAndSolution<S> 
-BaseProblem<S>::generateNewParetoPointUsingFacet(const Facet<S> & facet) 
+PointAndSolution<PoolIndex> 
+BaseProblem<S>::generateNewParetoPointUsingFacet(const Facet<PoolIndex> & facet) 
 {
   // Get a weight vector (using the given facet as a generating facet).
   std::vector<double> weights = pareto_approximator::utility::
-                                generateNewWeightVector<S>(facet);
+                                generateNewWeightVector<PoolIndex>(facet);
 
-  return generateNewParetoPoint(weights);
+  return generateNewParetoPoint(weights, makeCombHint(facet, weights));
 }
 
 
@@ -488,23 +968,31 @@ BaseProblem<S>::generateNewParetoPointUsingFacet(const Facet<S> & facet)
  *         to call comb().
  *
  *  \param weights A vector of weights for comb().
- *  \return A Pareto optimal point (inside a PointAndSolution<S> object) 
- *          generated using the given weights if the weights were not 
- *          used before; a null PointAndSolution<S> object otherwise.
+ *  \param hint The hint for combWithHint(). (see CombHint)
+ *  \return A Pareto optimal point (a reference to a point in pointPool_) 
+ *          generated using the given weights. (the point found earlier 
+ *          if the weights were used before)
  *          
- *  This method will call the user-implemented comb() method (using the 
- *  given weight vector) to make a Pareto point.
+ *  This method will call the user-implemented comb() method (through 
+ *  combWithHint(), using the given weight vector and hint) to make a 
+ *  Pareto point and move it into the pointPool_.
  *  
  *  If the user returns a point that is not strictly positive (i.e. not 
  *  every coordinate is greater than zero) a 
  *  NotStrictlyPositivePointException exception will be thrown.
  *  
  *  Every time the method is called with a weight vector W it checks 
- *  if W has been used before (using the usedWeightVectors_ attribute):
- *  - If they have, it returns a null PointAndSolution instance without 
- *    calling comb().
- *  - If they have not, it calls comb() using the given weights (W) 
- *    and adds W to the usedWeightsVectors_ list. 
+ *  if W has been used before (using the combResults_ memo):
+ *  - If it has, it returns the point comb() returned back then without 
+ *    calling comb() again. (its weightsUsed attribute holds the weights 
+ *    used back then, which match W up to the weight vector tolerance)
+ *  - If it has not, it calls comb() using the given weights (W) and 
+ *    stores the result in the combResults_ memo. 
+ *  
+ *  If comb() returns a null PointAndSolution<S> instance (no solution 
+ *  strictly better than the hint's upper bound, see combWithHint()) the 
+ *  result is the hint's upperBoundVertex(), which is already in the 
+ *  pool. (its weightsUsed are the ones it was found with)
  *  
  *  Possible exceptions:
  *  - May throw a NotStrictlyPositivePointException exception if the 
@@ -515,27 +1003,279 @@ BaseProblem<S>::generateNewParetoPointUsingFacet(const Facet<S> & facet)
  *      PointAndSolution and Point
  */
 template <class S> 
-PointAndSolution<S> 
-BaseProblem<S>::generateNewParetoPoint(const std::vector<double> & weights)
+PointAndSolution<PoolIndex> 
+BaseProblem<S>::generateNewParetoPoint(const std::vector<double> & weights, 
+                                       const CombHint<S> & hint)
 {
   // Check if the given weights have been used before.
-  bool haveUsedTheseWeightsBefore = false;
-  std::list< std::vector<double> >::iterator it;
-  for (it = usedWeightVectors_.begin(); it != usedWeightVectors_.end(); ++it)
-    if ( std::equal(weights.begin(), weights.end(), it->begin()) ) {
-      haveUsedTheseWeightsBefore = true;
-      break;
-    }
+  // - If they have, return the point comb() returned back then.
+  CombResultMemo<PoolIndex>::Key key = combResults_.makeKey(weights);
+  const PointAndSolution<PoolIndex> * memorized = combResults_.find(key);
+  if (memorized != NULL)
+    return *memorized;
+  // else
 
-  // Have the given weights been used before?
-  if (haveUsedTheseWeightsBefore)
-    // Yes, return a null PointAndSolution<S> instance.
-    return PointAndSolution<S>();
+  // Call comb() with the given weights. (through combWithHint())
+  PointAndSolution<S> newPoint = combWithHint(weights.begin(), 
+                                              weights.end(), hint);
+  ++numCombCalls_;
+
+  // No improvement on the hint's upper bound? (see combWithHint())
+  // - the vertex that attains the bound is optimal for these weights too
+  if (newPoint.isNull() and hint.hasUpperBound()) {
+    combResults_.insert(key, hint.upperBoundReference());
+    return hint.upperBoundReference();
+  }
   // else
 
-  // Call comb() with the given weights.
-  PointAndSolution<S> newPoint = comb(weights.begin(), weights.end());
+  // Make sure the user didn't return an invalid point and initialize 
+  // newPoint's weightsUsed and _isNull attributes.
+  completeNewParetoPoint(newPoint, weights);
+
+  // Move it into the pool. (we will only use references to it from now on)
+  PointAndSolution<PoolIndex> reference = pointPool_.add(std::move(newPoint));
+  combResults_.insert(key, reference);
+
+  return reference;
+}
+
+
+/*!
+ *  \brief Generate a new Pareto optimal point for each of the given 
+ *         weight vectors. (using combBatchWithHints())
+ *
+ *  \param weightVectors A vector of weight vectors for comb().
+ *  \param hints Either empty (no hints) or one hint for each weight 
+ *               vector. (see combWithHint())
+ *  \return A vector with one reference to a point in pointPool_ for 
+ *          each of the given weight vectors (in the same order). Each 
+ *          one refers to the Pareto optimal point comb() returned for its 
+ *          weights (now or, if the weights were used before or appear 
+ *          earlier in weightVectors, back then).
+ *  
+ *  Same as calling generateNewParetoPoint() for each weight vector, only 
+ *  all the new weight vectors (and their hints) are passed to 
+ *  combBatchWithHints() at once. (which may run the comb() calls on the 
+ *  thread pool - see setNumThreads())
+ *  
+ *  Only combBatchWithHints() might use the pool's threads. The combResults_ memo 
+ *  (and the pointPool_) is only read and updated here, by the calling 
+ *  thread.
+ *  
+ *  Possible exceptions:
+ *  - May throw a NotStrictlyPositivePointException exception if some 
+ *    point returned by comb() is not strictly positive. 
+ *  - Any exception thrown by comb() will be rethrown (after all the 
+ *    comb() calls have finished).
+ *  
+ *  \sa BaseProblem, comb(), combBatchWithHints() and 
+ *      generateNewParetoPoint()
+ */
+template <class S> 
+std::vector< PointAndSolution<PoolIndex> > 
+BaseProblem<S>::generateNewParetoPoints(
+                  const std::vector< std::vector<double> > & weightVectors, 
+                  const std::vector< CombHint<S> > & hints)
+{
+  assert(hints.empty() or hints.size() == weightVectors.size());
+
+  std::vector< PointAndSolution<PoolIndex> > newPoints(weightVectors.size());
+
+  // Find the weight vectors that have not been used before.
+  // - the ones in the combResults_ memo get the memorized point
+  // - the ones that match an earlier (new) weight vector of the batch 
+  //   will get a reference to the same point (sameAs[i] is the index of 
+  //   that earlier weight vector)
+  std::vector<unsigned int> newWeightVectors;
+  std::vector<CombResultMemo<PoolIndex>::Key> keys;
+  std::vector<unsigned int> sameAs(weightVectors.size(), 
+                                   weightVectors.size());
+  for (unsigned int i = 0; i != weightVectors.size(); ++i) {
+    keys.push_back(combResults_.makeKey(weightVectors[i]));
+    const PointAndSolution<PoolIndex> * memorized = combResults_.find(keys[i]);
+    if (memorized != NULL) {
+      newPoints[i] = *memorized;
+      continue;
+    }
+    // else
+
+    for (unsigned int j = 0; j != newWeightVectors.size(); ++j)
+      if (keys[newWeightVectors[j]] == keys[i]) {
+        sameAs[i] = newWeightVectors[j];
+        break;
+      }
+    if (sameAs[i] == weightVectors.size())
+      newWeightVectors.push_back(i);
+  }
+
+  // Call comb() for each new weight vector. (through combWithHint() or 
+  // combBatchWithHints())
+  numCombCalls_ += newWeightVectors.size();
+  std::vector< PointAndSolution<S> > batchResults;
+  if (newWeightVectors.size() == 1) {
+    unsigned int i = newWeightVectors[0];
+    batchResults.push_back(combWithHint(weightVectors[i].begin(), 
+                                        weightVectors[i].end(), 
+                                        hints.empty() ? CombHint<S>() : 
+                                                        hints[i]));
+  }
+  else if (newWeightVectors.size() > 1) {
+    std::vector< std::vector<double> > batch;
+    std::vector< CombHint<S> > batchHints(newWeightVectors.size());
+    for (unsigned int j = 0; j != newWeightVectors.size(); ++j) {
+      batch.push_back(weightVectors[newWeightVectors[j]]);
+      if (not hints.empty())
+        batchHints[j] = hints[newWeightVectors[j]];
+    }
+    batchResults = combBatchWithHints(batch, batchHints);
+    assert(batchResults.size() == batch.size());
+  }
+
+  // Move the new points into the pool.
+  // - a null point means comb() found no improvement on its hint's upper 
+  //   bound (see combWithHint()); the vertex that attains the bound is 
+  //   already in the pool
+  for (unsigned int j = 0; j != newWeightVectors.size(); ++j) {
+    unsigned int i = newWeightVectors[j];
+    if ( batchResults[j].isNull() and not hints.empty() and 
+         hints[i].hasUpperBound() ) 
+      newPoints[i] = hints[i].upperBoundReference();
+    else {
+      completeNewParetoPoint(batchResults[j], weightVectors[i]);
+      newPoints[i] = pointPool_.add(std::move(batchResults[j]));
+    }
+    combResults_.insert(keys[i], newPoints[i]);
+  }
+  for (unsigned int i = 0; i != weightVectors.size(); ++i)
+    if (sameAs[i] != weightVectors.size())
+      newPoints[i] = newPoints[sameAs[i]];
+
+  return newPoints;
+}
+
+
+//! Make a hint out of a facet's vertices. (references into pointPool_)
+/*!
+ *  \param facet A facet Chord or PGEN is about to try.
+ *  \param weights The weights comb() will be called with. (generated 
+ *                 from the facet)
+ *  \return A hint with a reference to each of the facet's vertices 
+ *          (the points comb() returned, in pointPool_) and an upper 
+ *          bound to comb()'s optimal value.
+ *  
+ *  The bound is the smallest value the weighted sum of the objectives 
+ *  gets at any of the facet's vertices. Each vertex is a feasible 
+ *  solution, so the optimum cannot be any larger. 
+ *  
+ *  (We do not use a tighter bound, e.g. the largest value a point the 
+ *  facet does not eps-dominate may get. Chord's approximation error 
+ *  bounds use the distance of the actual optimum from the facet, which 
+ *  only a complete comb() finds.)
+ *  
+ *  \sa combWithHint() and CombHint
+ */
+template <class S> 
+CombHint<S> 
+BaseProblem<S>::makeCombHint(const Facet<PoolIndex> & facet, 
+                             const std::vector<double> & weights) const
+{
+  CombHint<S> hint;
+  double bound = 0.0;
+  unsigned int boundVertex = 0;
+  typename Facet<PoolIndex>::ConstVertexIterator vi;
+  for (vi = facet.beginVertex(); vi != facet.endVertex(); ++vi) {
+    hint.addVertex(pointPool_.get(*vi));
+
+    // (every vertex passed completeNewParetoPoint()'s checks)
+    assert(vi->point.dimension() == weights.size());
+    double value = 0.0;
+    for (unsigned int i = 0; i != weights.size(); ++i)
+      value += weights[i] * vi->point.coordinateUnchecked(i);
+    if (hint.size() == 1 or value < bound) {
+      bound = value;
+      boundVertex = hint.size() - 1;
+    }
+  }
+  if (not hint.empty())
+    hint.setUpperBound(bound, boundVertex, 
+                       *(facet.beginVertex() + boundVertex));
+
+  return hint;
+}
+
+
+/*!
+ *  \brief Call comb() (or combWithHint(), if there are hints) for each 
+ *         weight vector, on the thread pool if there is one.
+ *
+ *  \param weightVectors A vector of weight vectors.
+ *  \param hints NULL or one hint for each weight vector.
+ *  \return One PointAndSolution<S> object for each weight vector. (in 
+ *          the same order)
+ *  
+ *  If there is more than one thread (see setNumThreads()) the calls run 
+ *  concurrently on the thread pool.
+ *  
+ *  \sa combBatch() and combBatchWithHints()
+ */
+template <class S> 
+std::vector< PointAndSolution<S> > 
+BaseProblem<S>::combEach(
+                  const std::vector< std::vector<double> > & weightVectors, 
+                  const std::vector< CombHint<S> > * hints)
+{
+  std::vector< PointAndSolution<S> > results(weightVectors.size());
+  auto combOne = [this, &weightVectors, hints, &results] (unsigned int i) {
+    if (hints != NULL)
+      results[i] = combWithHint(weightVectors[i].begin(), 
+                                weightVectors[i].end(), (*hints)[i]);
+    else
+      results[i] = comb(weightVectors[i].begin(), weightVectors[i].end());
+  };
+
+  if (threadPool_ and weightVectors.size() > 1) {
+    // Call comb() for each weight vector on the thread pool.
+    // - each task writes to a different element of results
+    std::vector<ThreadPool::Task> tasks;
+    for (unsigned int i = 0; i != weightVectors.size(); ++i) 
+      tasks.push_back([&combOne, i] () { combOne(i); });
+    threadPool_->run(tasks);
+  }
+  else {
+    // Call comb() for each weight vector, one after the other.
+    for (unsigned int i = 0; i != weightVectors.size(); ++i) 
+      combOne(i);
+  }
+
+  return results;
+}
+
 
+/*!
+ *  \brief Check a point returned by comb() and set its weightsUsed and 
+ *         _isNull attributes.
+ *
+ *  \param newPoint The PointAndSolution<S> object comb() returned.
+ *  \param weights The weights comb() was called with.
+ *  
+ *  Possible exceptions:
+ *  - May throw a NotStrictlyPositivePointException exception if the 
+ *    point returned by comb() is not strictly positive. (i.e. if one
+ *    or more of its coordinates is not greater than zero)
+ *  - May throw a DifferentDimensionsException exception if the point 
+ *    returned by comb() does not have one coordinate per objective. 
+ *    (i.e. per weight)
+ *  
+ *  Chord and PGEN use the unchecked Point and Facet methods (e.g. 
+ *  Point::dominatesUnchecked()) on the points that pass these checks.
+ *  
+ *  \sa generateNewParetoPoint() and generateNewParetoPoints()
+ */
+template <class S> 
+void 
+BaseProblem<S>::completeNewParetoPoint(PointAndSolution<S> & newPoint, 
+                                       const std::vector<double> & weights) const
+{
   // Make sure the user didn't return an invalid point:
   // - We are talking about the Point instance contained inside the 
   //   PointAndSolution<S> instance. The PointAndSolution<S> instance's 
@@ -545,16 +1285,315 @@ BaseProblem<S>::generateNewParetoPoint(const std::vector<double> & weights)
   // Is the point returned strictly positive? (it should)
   if (not newPoint.point.isStrictlyPositive()) 
     throw exception_classes::NotStrictlyPositivePointException();
+  // Does it have one coordinate per objective? (it should)
+  if (newPoint.point.dimension() != weights.size())
+    throw exception_classes::DifferentDimensionsException();
   // else
 
   // Initialize newPoint's weightsUsed and _isNull attributes.
   // - So that the user doesn't have to do it inside comb().
   newPoint.weightsUsed.assign(weights.begin(), weights.end());
   newPoint._isNull = false;
-  // Add the newly used weight vector to the usedWeightVectors_ list.
-  usedWeightVectors_.push_front(weights);
+}
+
+
+//! Should Chord and PGEN work in rounds? (see prefersCombBatches())
+/*!
+ *  \return true if there is more than one thread or if the problem 
+ *          prefers combBatch() to separate comb() calls; false otherwise.
+ *  
+ *  \sa prefersCombBatches(), setNumThreads(), doChord() and doPgen()
+ */
+template <class S> 
+bool 
+BaseProblem<S>::useCombBatches() const
+{
+  return getNumThreads() > 1 or prefersCombBatches();
+}
+
+
+/*!
+ *  \brief Pass new points to the newPointCallback_ (if there is one).
+ *
+ *  \param first Iterator to the first of the new points.
+ *  \param last Iterator to the past-the-end new point.
+ *  \param errorUpperBound The current approximation error upper bound.
+ *  
+ *  Sets cancelled_ if the callback returns false. (and stops passing 
+ *  points to it)
+ *  
+ *  \sa computeConvexParetoSet(unsigned int, double, NewPointCallback)
+ */
+template <class S> 
+void 
+BaseProblem<S>::reportNewPoints(
+        typename std::vector< PointAndSolution<PoolIndex> >::const_iterator first, 
+        typename std::vector< PointAndSolution<PoolIndex> >::const_iterator last, 
+        double errorUpperBound)
+{
+  if (not newPointCallback_)
+    return;
+  // else
+
+  // (the facets' bound assumes comb() is exact)
+  errorUpperBound = withCombApproximationDelta(errorUpperBound);
+  for ( ; first != last and not cancelled_; ++first)
+    if (not newPointCallback_(pointPool_.get(*first), errorUpperBound))
+      cancelled_ = true;
+}
+
+
+//! Add comb()'s approximation delta to a facet error upper bound.
+/*!
+ *  \param errorUpperBound A facet's local approximation error upper bound 
+ *                         (or the largest of many), i.e. a bound that 
+ *                         assumes comb() is exact.
+ *  \return The bound for a (1+delta)-approximate comb(), i.e. 
+ *          \f$ (1+errorUpperBound)(1+delta) - 1 \f$. (errorUpperBound 
+ *          itself if comb() is exact)
+ *  
+ *  \sa setCombApproximationDelta() and getApproximationErrorUpperBound()
+ */
+template <class S> 
+double 
+BaseProblem<S>::withCombApproximationDelta(double errorUpperBound) const
+{
+  if (combApproximationDelta_ == 0.0)
+    return errorUpperBound;
+  // else
+
+  return (1.0 + errorUpperBound) * (1.0 + combApproximationDelta_) - 1.0;
+}
+
+
+//! Has computeConvexParetoSet() run out of comb() calls or time?
+/*!
+ *  \return true if the current computeConvexParetoSet() call has made 
+ *          maxCombCalls_ comb() calls or has passed its deadline; false 
+ *          otherwise. (always false if there are no limits)
+ *  
+ *  \sa setMaxCombCalls(), setTimeLimit(), doChord() and doPgen()
+ */
+template <class S> 
+bool 
+BaseProblem<S>::budgetExhausted() const
+{
+  if (remainingCombCalls() == 0)
+    return true;
+  // else
+
+  return timeLimit_ > 0.0 and std::chrono::steady_clock::now() >= deadline_;
+}
+
+
+//! How many more comb() calls can computeConvexParetoSet() make?
+/*!
+ *  \return The number of comb() calls left or the largest unsigned int 
+ *          if there is no limit.
+ *  
+ *  \sa setMaxCombCalls(), doChord() and doPgen()
+ */
+template <class S> 
+unsigned int 
+BaseProblem<S>::remainingCombCalls() const
+{
+  if (maxCombCalls_ == 0)
+    return std::numeric_limits<unsigned int>::max();
+  // else
+
+  // (the anchors may have taken more comb() calls than allowed)
+  if (numCombCalls_ >= maxCombCalls_)
+    return 0;
+  // else
+
+  return maxCombCalls_ - numCombCalls_;
+}
+
+
+//! Set the number of threads computeConvexParetoSet() will use.
+/*!
+ *  \param numThreads The number of threads that will call comb(). Must 
+ *                    be at least 1. (1 is the default)
+ *  
+ *  Makes a new ThreadPool (or drops the current one if numThreads == 1).
+ *  Must not be called while computeConvexParetoSet() is running.
+ *  
+ *  \sa getNumThreads(), computeConvexParetoSet() and ThreadPool
+ */
+template <class S> 
+void 
+BaseProblem<S>::setNumThreads(unsigned int numThreads)
+{
+  assert(numThreads >= 1);
+
+  if (numThreads == numThreads_)
+    return;
+  // else
+
+  numThreads_ = numThreads;
+  if (numThreads_ > 1)
+    threadPool_.reset(new ThreadPool(numThreads_));
+  else
+    threadPool_.reset();
+}
+
+
+//! Get the number of threads computeConvexParetoSet() will use.
+/*!
+ *  \sa setNumThreads()
+ */
+template <class S> 
+unsigned int 
+BaseProblem<S>::getNumThreads() const
+{
+  return numThreads_;
+}
+
+
+//! Set the tolerance used to match weight vectors.
+/*!
+ *  \param tolerance A non-negative number. (0.0 is the default)
+ *  
+ *  Also forgets the points comb() returned so far. (see the declaration 
+ *  for more info)
+ *  
+ *  \sa getWeightVectorTolerance(), computeConvexParetoSet() and 
+ *      CombResultMemo
+ */
+template <class S> 
+void 
+BaseProblem<S>::setWeightVectorTolerance(double tolerance)
+{
+  assert(tolerance >= 0.0);
+
+  combResults_.setTolerance(tolerance);
+}
+
+
+//! Get the tolerance used to match weight vectors.
+/*!
+ *  \sa setWeightVectorTolerance()
+ */
+template <class S> 
+double 
+BaseProblem<S>::getWeightVectorTolerance() const
+{
+  return combResults_.getTolerance();
+}
+
+
+//! Limit the number of comb() calls computeConvexParetoSet() may make.
+/*!
+ *  \param maxCombCalls The maximum number of comb() calls. (0, the 
+ *                      default, means no limit)
+ *  
+ *  \sa getMaxCombCalls(), setTimeLimit() and 
+ *      getApproximationErrorUpperBound()
+ */
+template <class S> 
+void 
+BaseProblem<S>::setMaxCombCalls(unsigned int maxCombCalls)
+{
+  maxCombCalls_ = maxCombCalls;
+}
+
 
-  return newPoint;
+//! Get the maximum number of comb() calls. (0 means no limit)
+/*!
+ *  \sa setMaxCombCalls()
+ */
+template <class S> 
+unsigned int 
+BaseProblem<S>::getMaxCombCalls() const
+{
+  return maxCombCalls_;
+}
+
+
+//! Limit the time computeConvexParetoSet() may take.
+/*!
+ *  \param seconds The time limit (wall-clock time, in seconds). Must be 
+ *                 non-negative. (0.0, the default, means no limit)
+ *  
+ *  \sa getTimeLimit(), setMaxCombCalls() and 
+ *      getApproximationErrorUpperBound()
+ */
+template <class S> 
+void 
+BaseProblem<S>::setTimeLimit(double seconds)
+{
+  assert(seconds >= 0.0);
+
+  timeLimit_ = seconds;
+}
+
+
+//! Get the time limit in seconds. (0.0 means no limit)
+/*!
+ *  \sa setTimeLimit()
+ */
+template <class S> 
+double 
+BaseProblem<S>::getTimeLimit() const
+{
+  return timeLimit_;
+}
+
+
+//! Declare that comb() is only (1+delta)-approximate.
+/*!
+ *  \param delta A non-negative number. (0.0, the default, means comb() 
+ *               is exact)
+ *  
+ *  \sa getCombApproximationDelta(), computeConvexParetoSet() and 
+ *      getApproximationErrorUpperBound()
+ */
+template <class S> 
+void 
+BaseProblem<S>::setCombApproximationDelta(double delta)
+{
+  assert(delta >= 0.0);
+
+  combApproximationDelta_ = delta;
+}
+
+
+//! Get comb()'s approximation delta. (0.0 means comb() is exact)
+/*!
+ *  \sa setCombApproximationDelta()
+ */
+template <class S> 
+double 
+BaseProblem<S>::getCombApproximationDelta() const
+{
+  return combApproximationDelta_;
+}
+
+
+//! Get the number of comb() calls the last computeConvexParetoSet() made.
+/*!
+ *  \sa setMaxCombCalls()
+ */
+template <class S> 
+unsigned int 
+BaseProblem<S>::getNumCombCalls() const
+{
+  return numCombCalls_;
+}
+
+
+/*!
+ *  \brief Get an upper bound to the approximation error of the points 
+ *         the last computeConvexParetoSet() call returned.
+ *  
+ *  \sa computeConvexParetoSet(), setMaxCombCalls(), setTimeLimit(), 
+ *      doChord() and doPgen()
+ */
+template <class S> 
+double 
+BaseProblem<S>::getApproximationErrorUpperBound() const
+{
+  return approximationErrorUpperBound_;
 }
 
 
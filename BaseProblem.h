@@ -10,10 +10,16 @@
 
 
 #include <vector>
-#include <list>
+#include <memory>
+#include <chrono>
+#include <functional>
 
 #include "Facet.h"
 #include "PointAndSolution.h"
+#include "CombResultMemo.h"
+#include "CombHint.h"
+#include "PointPool.h"
+#include "ThreadPool.h"
 
 
 using pareto_approximator::Facet;
@@ -55,12 +61,33 @@ namespace pareto_approximator {
  *  to find an approximation to the problem's Pareto set (or, depending on 
  *  the problem and the approximation parameter, the actual Pareto set).
  *
+ *  computeConvexParetoSet() may call comb() from several threads at 
+ *  once (see setNumThreads()). By default it only uses one thread.
+ *
+ *  computeConvexParetoSet() never copies a solution. Each point comb() 
+ *  returns is moved into a PointPool and Chord and PGEN refer to it by 
+ *  its index; the points computeConvexParetoSet() returns are moved out 
+ *  of the pool. S may be a move-only type.
+ *
  *  \sa BaseProblem(), ~BaseProblem(), comb() and operator()()
  */
 template <class S>
 class BaseProblem 
 {
   public:
+    /*!
+     *  \brief The type of the callback the streaming version of 
+     *         computeConvexParetoSet() calls for each new point.
+     *  
+     *  It gets the new point and the current approximation error upper 
+     *  bound and returns true to let computeConvexParetoSet() go on or 
+     *  false to cancel it.
+     *  
+     *  \sa computeConvexParetoSet(unsigned int, double, NewPointCallback)
+     */
+    typedef std::function<bool (const PointAndSolution<S> & newPoint, 
+                                double errorUpperBound)> NewPointCallback;
+
     //! BaseProblem's default constructor. (empty)
     BaseProblem();
 
@@ -103,6 +130,124 @@ class BaseProblem
     comb(std::vector<double>::const_iterator first, 
          std::vector<double>::const_iterator last) = 0;
 
+    //! Optimize a linear combination of the objectives, warm-started.
+    /*! 
+     *  \param first Iterator to the first weight. (just like comb()'s)
+     *  \param last Iterator to the past-the-end weight.
+     *  \param hint References to the points (and solutions) of the facet 
+     *              Chord or PGEN is trying, i.e. to points comb() returned 
+     *              for nearby weight vectors, and an upper bound to the 
+     *              optimal value. (empty for the anchor points)
+     *  \return Exactly what comb() would have returned for the same 
+     *          weights, or a null PointAndSolution<S> instance if no 
+     *          solution is strictly better than hint.upperBound().
+     *  
+     *  computeConvexParetoSet() always calls combWithHint() (or 
+     *  combBatchWithHints()) instead of calling comb() directly. 
+     *  BaseProblem's combWithHint() ignores the hint and calls comb().
+     *  
+     *  Problems that can reoptimize from a previous solution (e.g. start 
+     *  from a shortest path tree, a feasible LP basis or an upper bound 
+     *  to the optimal value) can override it and use the hint's 
+     *  solutions as warm starts. Nothing is copied; the hint only holds 
+     *  references that are valid until combWithHint() returns. (see 
+     *  CombHint)
+     *  
+     *  Problems that search for the optimum (e.g. Dijkstra or A\*) can 
+     *  prune their search with hint.upperBound(): once nothing left can 
+     *  beat it they can stop and return PointAndSolution<S>() ("no 
+     *  improvement"). BaseProblem then uses hint.upperBoundVertex(), the 
+     *  facet's vertex that attains the bound, which is just as optimal. 
+     *  (see CombHint)
+     *  
+     *  Like comb(), it may be called from several threads at once. (see 
+     *  setNumThreads())
+     *  
+     *  \sa comb(), combBatchWithHints() and CombHint
+     */
+    virtual PointAndSolution<S> 
+    combWithHint(std::vector<double>::const_iterator first, 
+                 std::vector<double>::const_iterator last, 
+                 const CombHint<S> & hint);
+
+    //! Optimize many linear combinations of the objectives at once.
+    /*! 
+     *  \param weightVectors A vector of weight vectors. (each one is a 
+     *                       std::vector<double> of weights w_{i}, just 
+     *                       like the ones comb() gets)
+     *  \return A vector containing one PointAndSolution<S> object for 
+     *          each weight vector (in the same order). Each one must be 
+     *          exactly what comb() would have returned for the 
+     *          corresponding weight vector.
+     *  
+     *  computeConvexParetoSet() calls combBatch() (instead of comb(), 
+     *  through combBatchWithHints()) whenever it has more than one weight 
+     *  vector ready at the same time, e.g. for the anchor points or for 
+     *  all the facets Chord and PGEN have not tried yet. (see 
+     *  prefersCombBatches())
+     *  
+     *  BaseProblem's combBatch() simply calls comb() for each weight 
+     *  vector (on the thread pool if there is more than one thread - see 
+     *  setNumThreads()). Users whose problems can answer many weight 
+     *  vectors in one pass more cheaply than with separate comb() calls 
+     *  (e.g. one multi-weight graph search instead of k Dijkstras) can 
+     *  override it. They should override prefersCombBatches() too.
+     *  
+     *  \sa comb(), prefersCombBatches() and computeConvexParetoSet()
+     */
+    virtual std::vector< PointAndSolution<S> > 
+    combBatch(const std::vector< std::vector<double> > & weightVectors);
+
+    //! Optimize many linear combinations of the objectives, warm-started.
+    /*! 
+     *  \param weightVectors A vector of weight vectors. (just like 
+     *                       combBatch()'s)
+     *  \param hints One hint for each weight vector. (see combWithHint())
+     *  \return Exactly what combBatch() would have returned for the same 
+     *          weight vectors. (or null PointAndSolution<S> instances for 
+     *          the ones with no improvement - see combWithHint())
+     *  
+     *  computeConvexParetoSet() calls combBatchWithHints() whenever it 
+     *  would have called combBatch().
+     *  
+     *  BaseProblem's combBatchWithHints() calls combBatch() (and ignores 
+     *  the hints) if the problem prefers batches (see 
+     *  prefersCombBatches()), so that problems overriding combBatch() keep 
+     *  getting their batches. Otherwise it calls combWithHint() for each 
+     *  weight vector, on the thread pool if there is more than one thread. 
+     *  (see setNumThreads())
+     *  
+     *  Problems that override combBatch() and want the hints should 
+     *  override combBatchWithHints() instead.
+     *  
+     *  \sa combBatch(), combWithHint() and CombHint
+     */
+    virtual std::vector< PointAndSolution<S> > 
+    combBatchWithHints(const std::vector< std::vector<double> > & weightVectors, 
+                       const std::vector< CombHint<S> > & hints);
+
+    //! Should Chord and PGEN collect weight vectors for combBatch()?
+    /*! 
+     *  \return true if the problem's combBatch() is faster than calling 
+     *          comb() for each weight vector separately; false otherwise.
+     *          (BaseProblem's prefersCombBatches() returns false)
+     *  
+     *  If it returns true, or if there is more than one thread (see 
+     *  setNumThreads()), Chord and PGEN work in rounds: on each round 
+     *  they generate a weight vector for every facet they would 
+     *  otherwise try one after the other and pass all of them to 
+     *  combBatch() at once.
+     *  
+     *  Chord finds the same points either way. PGEN may return a 
+     *  different set of points in rounds (usually a few more, since it 
+     *  can no longer choose the next facet after each new point); it is 
+     *  still an (1+eps)-approximate convex Pareto set, with the same 
+     *  approximation error upper bound guarantee.
+     *  
+     *  \sa combBatch(), setNumThreads() and computeConvexParetoSet()
+     */
+    virtual bool prefersCombBatches() const;
+
     //! Compute an (1+eps)-approximate convex Pareto set of the problem.
     /*! 
      *  \param numObjectives The number of objectives to minimize. Note: The 
@@ -127,24 +272,238 @@ class BaseProblem
      *  computeConvexParetoSet() will use the comb() method the user 
      *  implemented. That is why comb() is declared virtual.
      *  
-     *  computeConvexParetoSet() initializes the usedWeightVectors_ 
-     *  attribute to an empty list every time it is called (before it 
-     *  calls any other method).
+     *  computeConvexParetoSet() clears the combResults_ memo every 
+     *  time it is called (before it calls any other method).
      *
      *  \sa BaseProblem, PointAndSolution and Point
      */
     std::vector< PointAndSolution<S> > 
     computeConvexParetoSet(unsigned int numObjectives, double eps=1e-12);
 
+    /*!
+     *  \brief Compute an (1+eps)-approximate convex Pareto set of the 
+     *         problem, passing each new point to a callback as soon as 
+     *         it is found.
+     *  
+     *  \param numObjectives The number of objectives to minimize.
+     *  \param eps The degree of approximation.
+     *  \param newPointCallback Called (on the calling thread) for each 
+     *                          point Chord or PGEN accepts (the anchor 
+     *                          points first), together with the current 
+     *                          approximation error upper bound (see 
+     *                          getApproximationErrorUpperBound(); infinity 
+     *                          if there is no bound yet). If it returns 
+     *                          false computeConvexParetoSet() stops.
+     *  \return Same as computeConvexParetoSet(unsigned int, double). If 
+     *          the callback cancelled the computation: all the points 
+     *          passed to it so far, not filtered.
+     *  
+     *  Lets users start working on the first points (e.g. the anchor 
+     *  points) right away. Points are passed to the callback after each 
+     *  round of comb() calls (i.e. right after each comb() call unless we 
+     *  work in rounds - see prefersCombBatches()).
+     *  
+     *  Some of the points passed to the callback may later turn out to be 
+     *  weakly dominated (only anchor points) and will not be part of the 
+     *  returned set.
+     *  
+     *  \sa computeConvexParetoSet(unsigned int, double) and 
+     *      NewPointCallback
+     */
+    std::vector< PointAndSolution<S> > 
+    computeConvexParetoSet(unsigned int numObjectives, double eps, 
+                           NewPointCallback newPointCallback);
+
+    //! Set the number of threads computeConvexParetoSet() will use.
+    /*!
+     *  \param numThreads The number of threads that will call comb(). 
+     *                    Must be at least 1. (1 is the default)
+     *  
+     *  With more than one thread computeConvexParetoSet() will:
+     *  - Call comb() for all the anchor points concurrently.
+     *  - Try all the facets it has not tried yet at once, i.e. call 
+     *    comb() for all of them concurrently, in rounds. (see 
+     *    prefersCombBatches())
+     *  
+     *  The comb() calls are distributed over a work-stealing ThreadPool 
+     *  with \#numThreads threads (by BaseProblem's combBatch()). For 
+     *  biobjective problems the resulting approximate Pareto set is the 
+     *  same as the one we get using a single thread (only the order in 
+     *  which the points are found differs). For three or more objectives 
+     *  it may differ from the single thread one (see prefersCombBatches()) 
+     *  but it is the same for any number of threads above one.
+     *  
+     *  Users that want more than one thread must make sure that their 
+     *  comb() can safely be called concurrently, i.e. that it does not 
+     *  modify shared state (e.g. edge weights stored in a common graph) 
+     *  without proper synchronization.
+     *  
+     *  \sa getNumThreads(), computeConvexParetoSet() and ThreadPool
+     */
+    void setNumThreads(unsigned int numThreads);
+
+    //! Get the number of threads computeConvexParetoSet() will use.
+    /*!
+     *  \sa setNumThreads()
+     */
+    unsigned int getNumThreads() const;
+
+    //! Set the tolerance used to match weight vectors.
+    /*!
+     *  \param tolerance A non-negative number. (0.0 is the default)
+     *  
+     *  computeConvexParetoSet() never calls comb() twice with the same 
+     *  weights; it reuses the point comb() returned the first time. Two 
+     *  weight vectors count as the same if, after normalizing them (so 
+     *  that their elements sum to 1), their elements round to the same 
+     *  multiples of tolerance. With a tolerance of 0.0 only (normalized) 
+     *  weight vectors that are exactly equal count as the same.
+     *  
+     *  A small tolerance (e.g. 1e-9) saves comb() calls for weight 
+     *  vectors that only differ by floating-point noise. A big tolerance 
+     *  saves more comb() calls but may make the approximation worse.
+     *  
+     *  \sa getWeightVectorTolerance(), computeConvexParetoSet() and 
+     *      CombResultMemo
+     */
+    void setWeightVectorTolerance(double tolerance);
+
+    //! Get the tolerance used to match weight vectors.
+    /*!
+     *  \sa setWeightVectorTolerance()
+     */
+    double getWeightVectorTolerance() const;
+
+    //! Limit the number of comb() calls computeConvexParetoSet() may make.
+    /*!
+     *  \param maxCombCalls The maximum number of comb() calls. (0, the 
+     *                      default, means no limit)
+     *  
+     *  computeConvexParetoSet() always refines the facet with the largest 
+     *  local approximation error upper bound first, so stopping early 
+     *  leaves the approximation equally coarse everywhere instead of 
+     *  refining only a part of it. When it runs out of comb() calls it 
+     *  stops (even if the requested degree of approximation has not been 
+     *  reached) and returns the points it has found so far. 
+     *  getApproximationErrorUpperBound() will tell how good they are.
+     *  
+     *  The anchor points (and, for more than two objectives, the first 
+     *  point PGEN needs in order to make a convex hull) are always 
+     *  computed, even if that takes more comb() calls than allowed. 
+     *  (reused points, see setWeightVectorTolerance(), do not count)
+     *  
+     *  \sa getMaxCombCalls(), setTimeLimit(), getNumCombCalls() and 
+     *      getApproximationErrorUpperBound()
+     */
+    void setMaxCombCalls(unsigned int maxCombCalls);
+
+    //! Get the maximum number of comb() calls. (0 means no limit)
+    /*!
+     *  \sa setMaxCombCalls()
+     */
+    unsigned int getMaxCombCalls() const;
+
+    //! Limit the time computeConvexParetoSet() may take.
+    /*!
+     *  \param seconds The time limit (wall-clock time, in seconds). (0.0, 
+     *                 the default, means no limit)
+     *  
+     *  Just like setMaxCombCalls(), only computeConvexParetoSet() stops 
+     *  when the time is up. A comb() call that has already started will 
+     *  not be interrupted (the time limit is only checked between comb() 
+     *  calls - or between rounds of comb() calls).
+     *  
+     *  \sa getTimeLimit(), setMaxCombCalls() and 
+     *      getApproximationErrorUpperBound()
+     */
+    void setTimeLimit(double seconds);
+
+    //! Get the time limit in seconds. (0.0 means no limit)
+    /*!
+     *  \sa setTimeLimit()
+     */
+    double getTimeLimit() const;
+
+    //! Declare that comb() is only (1+delta)-approximate.
+    /*!
+     *  \param delta A non-negative number. (0.0, the default, means comb() 
+     *               is exact)
+     *  
+     *  An approximate comb() (e.g. A\* with an inflated heuristic or a 
+     *  truncated search) is often much cheaper than an exact one. With 
+     *  delta > 0.0 comb() may return any point p with 
+     *  \f$ w \cdot p \le (1+delta) \cdot \min_{x} w \cdot x \f$ 
+     *  for the weights w it was given. (Problems can declare their delta 
+     *  in their constructor.)
+     *  
+     *  computeConvexParetoSet() accounts for it: the Pareto points may be 
+     *  up to (1+delta) times closer to the origin than the points comb() 
+     *  returns, so Chord and PGEN accept a facet only if it is within 
+     *  \f$ (1+eps)/(1+delta) - 1 \f$ (instead of eps) of comb()'s point. 
+     *  The returned points are still an (1+eps)-approximate convex Pareto 
+     *  set and getApproximationErrorUpperBound() (like the bounds passed 
+     *  to a NewPointCallback) includes delta.
+     *  
+     *  delta should be smaller than eps. Otherwise Chord and PGEN refine 
+     *  the approximation as far as comb() allows (as if eps was 0) and 
+     *  the approximation error upper bound, which is at least delta, 
+     *  cannot get below eps. (computeConvexParetoSet() does not throw)
+     *  
+     *  Only multiplicative deltas, like eps. (an additive delta d can be 
+     *  declared as d divided by the smallest optimal value comb() may 
+     *  get)
+     *  
+     *  \sa getCombApproximationDelta(), computeConvexParetoSet() and 
+     *      getApproximationErrorUpperBound()
+     */
+    void setCombApproximationDelta(double delta);
+
+    //! Get comb()'s approximation delta. (0.0 means comb() is exact)
+    /*!
+     *  \sa setCombApproximationDelta()
+     */
+    double getCombApproximationDelta() const;
+
+    //! Get the number of comb() calls the last computeConvexParetoSet() made.
+    /*!
+     *  \sa setMaxCombCalls()
+     */
+    unsigned int getNumCombCalls() const;
+
+    /*!
+     *  \brief Get an upper bound to the approximation error of the points 
+     *         the last computeConvexParetoSet() call returned.
+     *  
+     *  \return The largest local approximation error upper bound (see 
+     *          Facet::getLocalApproximationErrorUpperBound()) among the 
+     *          facets of the approximation when computeConvexParetoSet() 
+     *          stopped.
+     *  
+     *  If computeConvexParetoSet() ran to completion the bound is at most 
+     *  the eps it was given. If it ran out of comb() calls or time (see 
+     *  setMaxCombCalls() and setTimeLimit()) the bound may be larger.
+     *  
+     *  If comb() is only (1+delta)-approximate (see 
+     *  setCombApproximationDelta()) the bound includes delta: it is 
+     *  \f$ (1+b)(1+delta) - 1 \f$, where b is the facets' largest bound. 
+     *  (at least delta)
+     *  
+     *  For more than two objectives (PGEN) boundary facets have no bound 
+     *  and are ignored, just like PGEN's own stopping rule ignores them.
+     *  
+     *  \sa computeConvexParetoSet(), setMaxCombCalls() and setTimeLimit()
+     */
+    double getApproximationErrorUpperBound() const;
+
   private:
     /*! \brief A function called by computeConvexParetoSet() to do most of 
      *         the work. (for biobjective optimization problems)
      * 
      *  \param anchors The Facet defined by the anchor points.
      *  \param eps The degree of approximation. 
-     *  \return A vector of Pareto optimal points (PointAndSolution instances).
-     *          BaseProblem::computeConvexParetoSet() will filter them to make 
-     *          the (1+eps)-approximate convex Pareto set.
+     *  \return A vector of Pareto optimal points (references to points in 
+     *          pointPool_). BaseProblem::computeConvexParetoSet() will 
+     *          filter them to make the (1+eps)-approximate convex Pareto set.
      *  
      *  Note: doChord() is only called for problems with exactly 2 criteria.
      *  
@@ -152,11 +511,13 @@ class BaseProblem
      *  It's just a routine that BaseProblem::computeConvexParetoSet() uses 
      *  to do most of the work.
      *  
-     *  doChord() has a big while loop that processes facets (from a stack). 
-     *  On each iteration doChord() finds at most one new Pareto optimal point, 
-     *  makes new facets using that point and pushes the new facets on the 
-     *  stack (iff they improve the approximation; if the requested degree of 
-     *  approximation has been met, no new facets are pushed onto the stack).
+     *  doChord() has a big while loop that processes facets (from a 
+     *  priority queue, largest local approximation error upper bound 
+     *  first). On each iteration doChord() finds at most one new Pareto 
+     *  optimal point, makes new facets using that point and pushes the new 
+     *  facets into the queue. It stops when the requested degree of 
+     *  approximation has been met or when it runs out of comb() calls or 
+     *  time. (see setMaxCombCalls() and setTimeLimit())
      *  
      *  Please read "How good is the Chord Algorithm?" by Constantinos 
      *  Daskalakis, Ilias Diakonikolas and Mihalis Yannakakis for in-depth 
@@ -164,8 +525,8 @@ class BaseProblem
      *  
      *  \sa computeConvexParetoSet(), BaseProblem, PointAndSolution and Point
      */
-    std::vector< PointAndSolution<S> > 
-    doChord(Facet<S> anchors, double eps);
+    std::vector< PointAndSolution<PoolIndex> > 
+    doChord(Facet<PoolIndex> anchors, double eps);
 
     /*! \brief A function that uses the PGEN algorithm (Craft et al.) to 
      *         approximate the Pareto set.
@@ -176,9 +537,9 @@ class BaseProblem
      *                       weights.
      *  \param anchors The Facet defined by the anchor points.
      *  \param eps The degree of approximation. 
-     *  \return A vector of Pareto optimal points (PointAndSolution instances).
-     *          BaseProblem::computeConvexParetoSet() will filter them to make 
-     *          the (1+eps)-approximate convex Pareto set.
+     *  \return A vector of Pareto optimal points (references to points in 
+     *          pointPool_). BaseProblem::computeConvexParetoSet() will 
+     *          filter them to make the (1+eps)-approximate convex Pareto set.
      *
      *  Please read "Approximating convex Pareto surfaces in multiobjective 
      *  radiotherapy planning" by David L. Craft et al. (2006) for more 
@@ -186,8 +547,8 @@ class BaseProblem
      *  
      *  \sa computeConvexParetoSet(), BaseProblem, PointAndSolution and Point
      */
-    std::vector< PointAndSolution<S> > 
-    doPgen(unsigned int numObjectives, Facet<S> anchors, double eps);
+    std::vector< PointAndSolution<PoolIndex> > 
+    doPgen(unsigned int numObjectives, Facet<PoolIndex> anchors, double eps);
 
     /*! 
      *  \brief Generate a new Pareto optimal point using the given Facet 
@@ -196,14 +557,14 @@ class BaseProblem
      *  \param facet A Facet instance. (Its vertices' weightsUsed 
      *               attributes will be needed if the facet's normal vector 
      *               is not all-positive.)
-     *  \return A Pareto optimal point (inside a PointAndSolution<S>  
-     *          object) generated using the given facet, i.e. the weights 
-     *          generated from the facet, if the weights were not used 
-     *          before; a null PointAndSolution<S> object otherwise.
+     *  \return A Pareto optimal point (a reference to a point in 
+     *          pointPool_) generated using the given facet, i.e. the 
+     *          weights generated from the facet. (the point found earlier 
+     *          if the weights were used before)
      *          
      *  This method generates a weight vector using the given facet and 
      *  delegates the jobs of making a Pareto point and updating the 
-     *  usedWeightVectors_ attribute to generateNewParetoPoint().
+     *  combResults_ memo to generateNewParetoPoint().
      *  
      *  This method will call:
      *  - pareto_approximator::generateNewWeightVector() (using the given 
@@ -216,56 +577,245 @@ class BaseProblem
      *      pareto_approximator::generateNewWeightVector(), 
      *      PointAndSolution and Point
      */
-    PointAndSolution<S> 
-    generateNewParetoPointUsingFacet(const Facet<S> & facet);
+    PointAndSolution<PoolIndex> 
+    generateNewParetoPointUsingFacet(const Facet<PoolIndex> & facet);
 
     /*!
      *  \brief Generate a new Pareto optimal point using the given weights
      *         to call comb().
      *
      *  \param weights A vector of weights for comb().
-     *  \return A Pareto optimal point (inside a PointAndSolution<S>  
-     *          object) generated using the given weights if the weights 
-     *          were not used before; a null PointAndSolution<S> object 
-     *          otherwise.
+     *  \param hint The hint for combWithHint(). (none by default)
+     *  \return A Pareto optimal point (a reference to a point in 
+     *          pointPool_) generated using the given weights. (the point 
+     *          found earlier if the weights were used before)
      *          
-     *  This method will call the user-implemented comb() method (using 
-     *  the given weight vector) to make a Pareto point.
+     *  This method will call the user-implemented comb() method (through 
+     *  combWithHint(), using the given weight vector) to make a Pareto 
+     *  point and move it into pointPool_.
      *  
      *  Every time the method is called with a weight vector W it 
-     *  checks if W has been used before (using the usedWeightVectors_
-     *  attribute):
-     *  - If they have, it returns a null PointAndSolution instance 
-     *    without calling comb().
-     *  - If they have not, it calls comb() using the given weights (W) 
-     *    and adds W to the usedWeightsVectors_ list. 
+     *  checks if W has been used before (using the combResults_ memo):
+     *  - If it has, it returns the point comb() returned back then 
+     *    without calling comb() again.
+     *  - If it has not, it calls comb() using the given weights (W) 
+     *    and stores the result in the combResults_ memo. 
+     *  
+     *  If comb() finds no improvement on the hint's upper bound (see 
+     *  combWithHint()) the result is the hint's upperBoundVertex(), which 
+     *  is already in pointPool_.
      *  
      *  \sa BaseProblem, comb(), generateNewParetoPointUsingFacet(), 
      *      PointAndSolution and Point
      */
-    PointAndSolution<S> 
-    generateNewParetoPoint(const std::vector<double> & weights);
+    PointAndSolution<PoolIndex> 
+    generateNewParetoPoint(const std::vector<double> & weights, 
+                           const CombHint<S> & hint=CombHint<S>());
+
+    /*!
+     *  \brief Generate a new Pareto optimal point for each of the given 
+     *         weight vectors. (using combBatch())
+     *
+     *  \param weightVectors A vector of weight vectors for comb().
+     *  \param hints Either empty (no hints) or one hint for each weight 
+     *               vector. (see combWithHint())
+     *  \return A vector with one reference to a point in pointPool_ for 
+     *          each of the given weight vectors (in the same order). Each 
+     *          one refers to the Pareto optimal point comb() returned for 
+     *          its weights (now or, if the weights were used before or 
+     *          appear earlier in weightVectors, back then).
+     *  
+     *  Same as calling generateNewParetoPoint() for each weight vector, 
+     *  only all the new weight vectors are passed to combBatchWithHints() 
+     *  at once.
+     *  
+     *  \sa BaseProblem, comb(), combBatchWithHints() and 
+     *      generateNewParetoPoint()
+     */
+    std::vector< PointAndSolution<PoolIndex> > 
+    generateNewParetoPoints(
+                const std::vector< std::vector<double> > & weightVectors, 
+                const std::vector< CombHint<S> > & hints=
+                                             std::vector< CombHint<S> >());
+
+    //! Make a hint out of a facet's vertices. (references into pointPool_)
+    /*!
+     *  \sa combWithHint() and CombHint
+     */
+    CombHint<S> makeCombHint(const Facet<PoolIndex> & facet, 
+                             const std::vector<double> & weights) const;
+
+    /*!
+     *  \brief Call comb() (or combWithHint(), if there are hints) for 
+     *         each weight vector, on the thread pool if there is one.
+     *  
+     *  \param weightVectors A vector of weight vectors.
+     *  \param hints NULL or one hint for each weight vector.
+     *  
+     *  \sa combBatch() and combBatchWithHints()
+     */
+    std::vector< PointAndSolution<S> > 
+    combEach(const std::vector< std::vector<double> > & weightVectors, 
+             const std::vector< CombHint<S> > * hints);
+
+    //! Add comb()'s approximation delta to a facet error upper bound.
+    /*!
+     *  \sa setCombApproximationDelta()
+     */
+    double withCombApproximationDelta(double errorUpperBound) const;
+
+    //! Should Chord and PGEN work in rounds? (see prefersCombBatches())
+    bool useCombBatches() const;
+
+    //! Has computeConvexParetoSet() run out of comb() calls or time?
+    bool budgetExhausted() const;
+
+    //! How many more comb() calls can computeConvexParetoSet() make?
+    unsigned int remainingCombCalls() const;
+
+    /*!
+     *  \brief Pass new points to the newPointCallback_ (if there is one).
+     *
+     *  \param first Iterator to the first of the new points. (references 
+     *               to points in pointPool_)
+     *  \param last Iterator to the past-the-end new point.
+     *  \param errorUpperBound The current approximation error upper bound.
+     *  
+     *  Sets cancelled_ if the callback returns false. (and stops passing 
+     *  points to it)
+     *  
+     *  \sa computeConvexParetoSet(unsigned int, double, NewPointCallback)
+     */
+    void reportNewPoints(
+        typename std::vector< PointAndSolution<PoolIndex> >::const_iterator first, 
+        typename std::vector< PointAndSolution<PoolIndex> >::const_iterator last, 
+        double errorUpperBound);
+
+    /*!
+     *  \brief Check a point returned by comb() and set its weightsUsed 
+     *         and _isNull attributes.
+     *
+     *  \param newPoint The PointAndSolution<S> object comb() returned.
+     *  \param weights The weights comb() was called with.
+     *  
+     *  Possible exceptions:
+     *  - May throw a NotStrictlyPositivePointException exception if the 
+     *    point returned by comb() is not strictly positive.
+     *  
+     *  \sa generateNewParetoPoint() and generateNewParetoPoints()
+     */
+    void completeNewParetoPoint(PointAndSolution<S> & newPoint, 
+                                const std::vector<double> & weights) const;
+
+    /*! 
+     *  \brief The points (and solutions) comb() returned during the 
+     *         current computeConvexParetoSet() call.
+     *  
+     *  Everything else (combResults_, the facets, the lists of points 
+     *  Chord and PGEN keep) only holds references to them. (see 
+     *  PointPool)
+     *  
+     *  Cleared at the start and at the end of every 
+     *  computeConvexParetoSet() call. (the points it returns are moved out 
+     *  of it)
+     *  
+     *  \sa computeConvexParetoSet(), generateNewParetoPoint() and 
+     *      generateNewParetoPoints()
+     */
+    PointPool<S> pointPool_;
 
     /*! 
-     *  \brief A list of already used weight vectors so that we never
-     *         call comb() with the same weights a second time.
+     *  \brief The points comb() returned so far (references to points in 
+     *         pointPool_), keyed by the weights comb() was called with, so 
+     *         that we never call comb() with the same weights a second 
+     *         time.
      *  
      *  Every time generateNewParetoPoint() is called with a weight vector 
-     *  W it checks usedWeightVectors_ for W.
-     *  - If W has been used before, it will not call comb().
-     *  - If it has not, it calls comb() using W as weights and adds W
-     *    to this list. 
+     *  W it looks W up in combResults_.
+     *  - If W has been used before, it will not call comb(); it will 
+     *    return the point stored in combResults_ instead.
+     *  - If it has not, it calls comb() using W as weights and stores 
+     *    the result in combResults_. (the generating facet's vertex that 
+     *    attains the upper bound if comb() found no improvement on it - 
+     *    see combWithHint() - so its weightsUsed may not match W)
      *  
      *  Places where it is used (and how it is used):
-     *  - Initialized to an empty list inside (the constructor and)
-     *    BaseProblem::computeConvexParetoSet(). 
+     *  - Cleared inside BaseProblem::computeConvexParetoSet(). 
      *  - Maintained inside the BaseProblem::generateNewParetoPoint() 
-     *    method.
+     *    and BaseProblem::generateNewParetoPoints() methods.
      *  
-     *  \sa BaseProblem, computeConvexParetoSet() and 
-     *      generateNewParetoPoint()
+     *  \sa BaseProblem, computeConvexParetoSet(), 
+     *      generateNewParetoPoint(), setWeightVectorTolerance() and 
+     *      CombResultMemo
+     */
+    CombResultMemo<PoolIndex> combResults_;
+
+    //! The number of threads computeConvexParetoSet() will use.
+    /*!
+     *  \sa setNumThreads() and getNumThreads()
+     */
+    unsigned int numThreads_;
+
+    //! The pool of threads that run comb(). (NULL if numThreads_ == 1)
+    /*!
+     *  A shared pointer so that BaseProblem objects stay copyable. (the 
+     *  copies will share the pool, which is fine - ThreadPool::run() 
+     *  may be called from more than one thread)
+     *  
+     *  \sa setNumThreads() and generateNewParetoPoints()
+     */
+    std::shared_ptr<ThreadPool> threadPool_;
+
+    //! The maximum number of comb() calls. (0 means no limit)
+    /*!
+     *  \sa setMaxCombCalls()
+     */
+    unsigned int maxCombCalls_;
+
+    //! The time limit in seconds. (0.0 means no limit)
+    /*!
+     *  \sa setTimeLimit()
+     */
+    double timeLimit_;
+
+    //! comb()'s approximation delta. (0.0 means comb() is exact)
+    /*!
+     *  \sa setCombApproximationDelta()
+     */
+    double combApproximationDelta_;
+
+    //! When the current computeConvexParetoSet() call must stop.
+    /*!
+     *  Only meaningful if timeLimit_ > 0.0.
+     *  
+     *  \sa setTimeLimit() and budgetExhausted()
+     */
+    std::chrono::steady_clock::time_point deadline_;
+
+    //! The number of comb() calls made by the last computeConvexParetoSet().
+    /*!
+     *  \sa getNumCombCalls() and generateNewParetoPoints()
+     */
+    unsigned int numCombCalls_;
+
+    //! The callback of the current computeConvexParetoSet() call. (if any)
+    /*!
+     *  \sa computeConvexParetoSet(unsigned int, double, NewPointCallback) 
+     *      and reportNewPoints()
+     */
+    NewPointCallback newPointCallback_;
+
+    //! Has the newPointCallback_ cancelled the current computation?
+    /*!
+     *  \sa reportNewPoints()
+     */
+    bool cancelled_;
+
+    //! The error bound reached by the last computeConvexParetoSet() call.
+    /*!
+     *  \sa getApproximationErrorUpperBound(), doChord() and doPgen()
      */
-    std::list< std::vector<double> > usedWeightVectors_;
+    double approximationErrorUpperBound_;
 };
 
 
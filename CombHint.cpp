@@ -0,0 +1,217 @@
+/*! \file CombHint.cpp
+ *  \brief The implementation of the CombHint<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` CombHint.h. In fact CombHint.h will `include`
+ *  CombHint.cpp because it describes a class template (which doesn't
+ *  allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Constructor. Makes an empty hint.
+template <class S>
+CombHint<S>::CombHint() : 
+    upperBound_(std::numeric_limits<double>::infinity()), 
+    upperBoundVertex_(0) { }
+
+
+//! Destructor. (empty)
+template <class S>
+CombHint<S>::~CombHint() { }
+
+
+//! Add a reference to a point. (not a copy)
+/*!
+ *  \param vertex A point comb() returned. It must outlive the hint.
+ */
+template <class S>
+void
+CombHint<S>::addVertex(const PointAndSolution<S> & vertex)
+{
+  vertices_.push_back(&vertex);
+}
+
+
+//! The number of points in the hint.
+template <class S>
+unsigned int
+CombHint<S>::size() const
+{
+  return vertices_.size();
+}
+
+
+//! Is the hint empty?
+template <class S>
+bool
+CombHint<S>::empty() const
+{
+  return vertices_.empty();
+}
+
+
+//! Get the k'th point. (0 <= k < size())
+/*!
+ *  \param k The point's position in the hint. (only assert()ed)
+ *  \return The k'th point, its solution and the weights comb() was
+ *          called with. (see PointAndSolution)
+ */
+template <class S>
+const PointAndSolution<S> &
+CombHint<S>::vertex(unsigned int k) const
+{
+  assert(k < vertices_.size());
+
+  return *vertices_[k];
+}
+
+
+//! Get the point found with the weights closest to the given ones.
+/*!
+ *  \param first Iterator to the first of the weights. (e.g. the ones
+ *               comb() was given)
+ *  \param last Iterator to the past-the-end weight.
+ *  \return The point whose weightsUsed are closest to the given weights
+ *          (the first one, if more than one are equally close) after
+ *          normalizing both so that their elements sum to 1. (Manhattan
+ *          distance)
+ *
+ *  The hint must not be empty. (only assert()ed)
+ */
+template <class S>
+const PointAndSolution<S> &
+CombHint<S>::closestVertex(std::vector<double>::const_iterator first,
+                           std::vector<double>::const_iterator last) const
+{
+  assert(not vertices_.empty());
+
+  double sum = 0.0;
+  for (std::vector<double>::const_iterator it = first; it != last; ++it)
+    sum += std::abs(*it);
+
+  unsigned int closest = 0;
+  double closestDistance = 0.0;
+  for (unsigned int k = 0; k != vertices_.size(); ++k) {
+    const std::vector<double> & weightsUsed = vertices_[k]->weightsUsed;
+    assert(weightsUsed.size() == (unsigned int) std::distance(first, last));
+    double sumUsed = 0.0;
+    for (unsigned int i = 0; i != weightsUsed.size(); ++i)
+      sumUsed += std::abs(weightsUsed[i]);
+
+    double distance = 0.0;
+    std::vector<double>::const_iterator it = first;
+    for (unsigned int i = 0; i != weightsUsed.size(); ++i, ++it)
+      distance += std::abs( (sum > 0.0 ? *it / sum : *it) -
+                            (sumUsed > 0.0 ? weightsUsed[i] / sumUsed :
+                                             weightsUsed[i]) );
+    if (k == 0 or distance < closestDistance) {
+      closest = k;
+      closestDistance = distance;
+    }
+  }
+
+  return *vertices_[closest];
+}
+
+
+//! Set the upper bound to comb()'s optimal value.
+/*!
+ *  \param bound The value of comb()'s linear combination at the k'th 
+ *               point. (no other point of the hint may have a smaller 
+ *               one)
+ *  \param k The position of the point that attains the bound. (only 
+ *           assert()ed)
+ *  \param reference The k'th point's reference into the pool. (see 
+ *                   PointPool)
+ *  
+ *  BaseProblem sets the bound when it makes the hint. (see 
+ *  BaseProblem::combWithHint())
+ */
+template <class S>
+void
+CombHint<S>::setUpperBound(double bound, unsigned int k, 
+                           const PointAndSolution<PoolIndex> & reference)
+{
+  assert(k < vertices_.size());
+
+  upperBound_ = bound;
+  upperBoundVertex_ = k;
+  upperBoundReference_ = reference;
+}
+
+
+//! Is there an upper bound to comb()'s optimal value?
+template <class S>
+bool
+CombHint<S>::hasUpperBound() const
+{
+  return upperBound_ != std::numeric_limits<double>::infinity();
+}
+
+
+//! An upper bound to the optimal value of comb()'s linear combination.
+/*!
+ *  \return The smallest value the linear combination of the objectives 
+ *          (using comb()'s weights) gets at any of the hint's points, 
+ *          i.e. the value of a solution comb() already knows. Infinity 
+ *          if there is no bound. (see hasUpperBound())
+ *  
+ *  If no solution is strictly better than the bound comb() may return 
+ *  a null PointAndSolution<S> instance. (see CombHint)
+ */
+template <class S>
+double
+CombHint<S>::upperBound() const
+{
+  return upperBound_;
+}
+
+
+//! The point that attains upperBound(). (there must be a bound)
+/*!
+ *  \return The point (and solution) whose value is upperBound(). It is 
+ *          what BaseProblem uses if comb() returns a null 
+ *          PointAndSolution<S> instance. (only assert()ed)
+ */
+template <class S>
+const PointAndSolution<S> &
+CombHint<S>::upperBoundVertex() const
+{
+  assert(hasUpperBound());
+
+  return *vertices_[upperBoundVertex_];
+}
+
+
+//! The pool reference to upperBoundVertex(). (for BaseProblem)
+template <class S>
+const PointAndSolution<PoolIndex> &
+CombHint<S>::upperBoundReference() const
+{
+  assert(hasUpperBound());
+
+  return upperBoundReference_;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,125 @@
+/*! \file CombHint.h
+ *  \brief The declaration of the CombHint<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_COMB_HINT_H
+#define PARETO_APPROXIMATOR_COMB_HINT_H
+
+
+#include <vector>
+
+#include "PointAndSolution.h"
+#include "PointPool.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! What Chord and PGEN already know when they call comb().
+/*!
+ *  When Chord or PGEN call comb() for a facet, the facet's vertices are
+ *  points comb() returned earlier, for nearby weight vectors. Their
+ *  solutions make good warm starts for the new comb() call (e.g. an
+ *  initial shortest path tree, a feasible LP basis or an upper bound to
+ *  the optimal value). A CombHint holds references to them: their
+ *  points, solutions and the weights they were found with. (see
+ *  PointAndSolution)
+ *
+ *  Nothing is copied: the references point into the pool of points
+ *  BaseProblem keeps (see PointPool) and are valid for the duration of
+ *  the BaseProblem::combWithHint() (or BaseProblem::combBatchWithHints())
+ *  call the hint is passed to. Problems must not keep them.
+ *
+ *  A hint from Chord or PGEN also holds an upper bound to the optimal 
+ *  value of comb()'s linear combination: the smallest value any of the 
+ *  facet's vertices gets. (see upperBound()) A comb() implementation 
+ *  that finds out that nothing is better than that (e.g. a shortest path 
+ *  search whose queue reached the bound before the target) may stop 
+ *  early and return a null PointAndSolution<S> instance (i.e. 
+ *  PointAndSolution<S>()) meaning "no improvement". BaseProblem will use 
+ *  the vertex that attains the bound (see upperBoundVertex()) instead. 
+ *  
+ *  The anchor points' comb() calls get empty hints. (and no bound)
+ *
+ *  \sa BaseProblem::combWithHint() and BaseProblem::combBatchWithHints()
+ */
+template <class S>
+class CombHint
+{
+  public:
+    //! Constructor. Makes an empty hint.
+    CombHint();
+
+    //! Destructor. (empty)
+    ~CombHint();
+
+    //! Add a reference to a point. (not a copy)
+    void addVertex(const PointAndSolution<S> & vertex);
+
+    //! The number of points in the hint.
+    unsigned int size() const;
+
+    //! Is the hint empty?
+    bool empty() const;
+
+    //! Get the k'th point. (0 <= k < size())
+    const PointAndSolution<S> & vertex(unsigned int k) const;
+
+    //! Get the point found with the weights closest to the given ones.
+    const PointAndSolution<S> &
+    closestVertex(std::vector<double>::const_iterator first,
+                  std::vector<double>::const_iterator last) const;
+
+    //! Set the upper bound to comb()'s optimal value.
+    void setUpperBound(double bound, unsigned int k, 
+                       const PointAndSolution<PoolIndex> & reference);
+
+    //! Is there an upper bound to comb()'s optimal value?
+    bool hasUpperBound() const;
+
+    //! An upper bound to the optimal value of comb()'s linear combination.
+    double upperBound() const;
+
+    //! The point that attains upperBound(). (there must be a bound)
+    const PointAndSolution<S> & upperBoundVertex() const;
+
+    //! The pool reference to upperBoundVertex(). (for BaseProblem)
+    const PointAndSolution<PoolIndex> & upperBoundReference() const;
+
+  private:
+    //! The points. (in the pool, see PointPool)
+    std::vector<const PointAndSolution<S> *> vertices_;
+
+    //! The upper bound. (infinity if there is none)
+    double upperBound_;
+
+    //! The position of the point that attains the upper bound.
+    unsigned int upperBoundVertex_;
+
+    //! The pool reference to the point that attains the upper bound.
+    PointAndSolution<PoolIndex> upperBoundReference_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "CombHint.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_COMB_HINT_H
@@ -0,0 +1,177 @@
+/*! \file CombResultMemo.cpp
+ *  \brief The implementation of the CombResultMemo<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` CombResultMemo.h. In fact CombResultMemo.h will
+ *  `include` CombResultMemo.cpp because it describes a class template
+ *  (which doesn't allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <cmath>
+#include <cstring>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Constructor. Makes an empty memo.
+/*!
+ *  \param tolerance The tolerance used to quantize weight vectors. Must
+ *                   be non-negative. (see CombResultMemo)
+ */
+template <class S>
+CombResultMemo<S>::CombResultMemo(double tolerance) : results_(),
+                                                      tolerance_(tolerance)
+{
+  assert(tolerance >= 0.0);
+}
+
+
+//! Destructor. (empty)
+template <class S>
+CombResultMemo<S>::~CombResultMemo() { }
+
+
+//! Get the memo's tolerance.
+template <class S>
+double
+CombResultMemo<S>::getTolerance() const
+{
+  return tolerance_;
+}
+
+
+//! Set the memo's tolerance. (also clears the memo)
+/*!
+ *  \param tolerance The tolerance used to quantize weight vectors. Must
+ *                   be non-negative. (see CombResultMemo)
+ *
+ *  Keys made with the old tolerance would mean nothing with the new one,
+ *  that is why the memo is cleared.
+ */
+template <class S>
+void
+CombResultMemo<S>::setTolerance(double tolerance)
+{
+  assert(tolerance >= 0.0);
+
+  tolerance_ = tolerance;
+  clear();
+}
+
+
+//! Make the (quantized) key of a weight vector.
+/*!
+ *  \param weights A weight vector. (non-negative elements, not all zero)
+ *  \return The key of the weight vector.
+ *
+ *  The weight vector is normalized (L1-norm) and each element is rounded
+ *  to the nearest multiple of the tolerance. If the tolerance is 0.0 the
+ *  key is made of the bits of the normalized elements.
+ *
+ *  \sa CombResultMemo
+ */
+template <class S>
+typename CombResultMemo<S>::Key
+CombResultMemo<S>::makeKey(const std::vector<double> & weights) const
+{
+  double sum = 0.0;
+  for (unsigned int i = 0; i != weights.size(); ++i)
+    sum += std::abs(weights[i]);
+  if (sum == 0.0)
+    sum = 1.0;
+
+  Key key(weights.size());
+  for (unsigned int i = 0; i != weights.size(); ++i) {
+    // adding 0.0 turns -0.0 into 0.0
+    double w = weights[i] / sum + 0.0;
+    if (tolerance_ > 0.0)
+      key[i] = std::llround(w / tolerance_);
+    else
+      std::memcpy(&key[i], &w, sizeof(w));
+  }
+
+  return key;
+}
+
+
+//! Find the comb() result stored for the given key.
+/*!
+ *  \param key A key made by makeKey().
+ *  \return A pointer to the stored PointAndSolution<S> object or NULL if
+ *          there is none. (the pointer stays valid until clear() or
+ *          setTolerance() are called)
+ */
+template <class S>
+const PointAndSolution<S> *
+CombResultMemo<S>::find(const Key & key) const
+{
+  typename std::unordered_map<Key, PointAndSolution<S>, KeyHash>::
+                                       const_iterator it = results_.find(key);
+  if (it == results_.end())
+    return NULL;
+  // else
+  return &(it->second);
+}
+
+
+//! Store a comb() result under the given key.
+/*!
+ *  \param key A key made by makeKey().
+ *  \param result The PointAndSolution<S> object comb() returned.
+ *
+ *  If there already is a result stored under the key it is kept.
+ */
+template <class S>
+void
+CombResultMemo<S>::insert(const Key & key, const PointAndSolution<S> & result)
+{
+  results_.insert(std::make_pair(key, result));
+}
+
+
+//! The number of stored comb() results.
+template <class S>
+unsigned int
+CombResultMemo<S>::size() const
+{
+  return results_.size();
+}
+
+
+//! Remove every stored comb() result.
+template <class S>
+void
+CombResultMemo<S>::clear()
+{
+  results_.clear();
+}
+
+
+//! Hash function for keys. (boost::hash_combine's mixing)
+template <class S>
+std::size_t
+CombResultMemo<S>::KeyHash::operator()(const Key & key) const
+{
+  std::size_t seed = key.size();
+  for (unsigned int i = 0; i != key.size(); ++i)
+    seed ^= std::hash<long long>()(key[i]) + 0x9e3779b9 +
+            (seed << 6) + (seed >> 2);
+  return seed;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
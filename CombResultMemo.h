@@ -0,0 +1,106 @@
+/*! \file CombResultMemo.h
+ *  \brief The declaration of the CombResultMemo<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_COMB_RESULT_MEMO_H
+#define PARETO_APPROXIMATOR_COMB_RESULT_MEMO_H
+
+
+#include <vector>
+#include <unordered_map>
+
+#include "PointAndSolution.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A hash table of comb() results, keyed by (quantized) weight vectors.
+/*!
+ *  BaseProblem uses a CombResultMemo so that it never calls comb() twice
+ *  with (almost) the same weights. Instead it reuses the PointAndSolution<S>
+ *  object comb() returned the first time.
+ *
+ *  Each weight vector is normalized (so that w and c*w, c > 0, which have
+ *  the same optimal solutions, are the same key) and then quantized:
+ *  every element is rounded to the nearest multiple of the memo's
+ *  tolerance. Weight vectors that round to the same multiples share an
+ *  entry; e.g. weight vectors that only differ by floating-point noise.
+ *  A tolerance of 0.0 means that only (normalized) weight vectors that
+ *  are exactly equal share an entry.
+ *
+ *  Lookups and insertions take (expected) constant time.
+ *
+ *  \sa BaseProblem and BaseProblem::setWeightVectorTolerance()
+ */
+template <class S>
+class CombResultMemo
+{
+  public:
+    //! The type of a (quantized) key.
+    typedef std::vector<long long> Key;
+
+    //! Constructor. Makes an empty memo.
+    explicit CombResultMemo(double tolerance=0.0);
+
+    //! Destructor. (empty)
+    ~CombResultMemo();
+
+    //! Get the memo's tolerance.
+    double getTolerance() const;
+
+    //! Set the memo's tolerance. (also clears the memo)
+    void setTolerance(double tolerance);
+
+    //! Make the (quantized) key of a weight vector.
+    Key makeKey(const std::vector<double> & weights) const;
+
+    //! Find the comb() result stored for the given key.
+    const PointAndSolution<S> * find(const Key & key) const;
+
+    //! Store a comb() result under the given key.
+    void insert(const Key & key, const PointAndSolution<S> & result);
+
+    //! The number of stored comb() results.
+    unsigned int size() const;
+
+    //! Remove every stored comb() result.
+    void clear();
+
+  private:
+    //! Hash function for keys.
+    struct KeyHash
+    {
+      std::size_t operator()(const Key & key) const;
+    };
+
+    //! The stored comb() results.
+    std::unordered_map<Key, PointAndSolution<S>, KeyHash> results_;
+
+    //! The tolerance used to quantize weight vectors.
+    double tolerance_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "CombResultMemo.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_COMB_RESULT_MEMO_H
@@ -0,0 +1,475 @@
+/*! \file ConvexHull.cpp
+ *  \brief The implementation of the ConvexHull class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` ConvexHull.h. In fact, ConvexHull.h will `include`
+ *  ConvexHull.cpp because we want a header-only code base. (that is also
+ *  why every method is declared inline)
+ */
+
+
+#include <assert.h>
+#include <cmath>
+#include <map>
+#include <algorithm>
+#include <utility>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+// An unnamed namespace containing helper functions.
+namespace {
+
+
+//! The part of a vector that is orthogonal to an orthonormal basis.
+/*!
+ *  \param basis An orthonormal basis (a vector of unit length vectors).
+ *  \param v The vector.
+ *  \return v minus its projection on the basis' span.
+ *
+ *  (modified Gram-Schmidt, twice for numerical stability)
+ */
+std::vector<double>
+orthogonalPart(const std::vector< std::vector<double> > & basis,
+               std::vector<double> v)
+{
+  for (unsigned int pass = 0; pass != 2; ++pass)
+    for (unsigned int b = 0; b != basis.size(); ++b) {
+      double dot = 0.0;
+      for (unsigned int i = 0; i != v.size(); ++i)
+        dot += v[i] * basis[b][i];
+      for (unsigned int i = 0; i != v.size(); ++i)
+        v[i] -= dot * basis[b][i];
+    }
+
+  return v;
+}
+
+
+//! The length (L2-norm) of a vector.
+double
+length(const std::vector<double> & v)
+{
+  double result = 0.0;
+  for (unsigned int i = 0; i != v.size(); ++i)
+    result += v[i] * v[i];
+
+  return std::sqrt(result);
+}
+
+
+//! Try to extend an orthonormal basis with a vector.
+/*!
+ *  \param basis An orthonormal basis (a vector of unit length vectors).
+ *  \param v The vector.
+ *  \param tolerance How long the part of v that is orthogonal to the
+ *                   basis must be.
+ *  \return true if the part of v that is orthogonal to the basis is
+ *          longer than tolerance (and was added to the basis, normalized);
+ *          false otherwise.
+ */
+bool
+extendOrthonormalBasis(std::vector< std::vector<double> > & basis,
+                       const std::vector<double> & v, double tolerance)
+{
+  std::vector<double> u = orthogonalPart(basis, v);
+  double uLength = length(u);
+  if (uLength <= tolerance)
+    return false;
+  // else
+
+  for (unsigned int i = 0; i != u.size(); ++i)
+    u[i] /= uLength;
+  basis.push_back(u);
+
+  return true;
+}
+
+
+}  // namespace
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Constructor. Makes an empty hull.
+/*!
+ *  \param spaceDimension The dimension of the space the points will live
+ *                        in. (at least 2)
+ *
+ *  \sa ConvexHull
+ */
+inline
+ConvexHull::ConvexHull(unsigned int spaceDimension) :
+                                spaceDimension_(spaceDimension), 
+                                nextFacetId_(0), scale_(0.0)
+{
+  assert(spaceDimension >= 2);
+}
+
+
+//! Destructor. (empty)
+inline
+ConvexHull::~ConvexHull() { }
+
+
+//! The dimension of the space the points live in.
+inline
+unsigned int
+ConvexHull::spaceDimension() const
+{
+  return spaceDimension_;
+}
+
+
+//! The number of points added so far. (extreme or not)
+inline
+unsigned int
+ConvexHull::numPoints() const
+{
+  return points_.size();
+}
+
+
+//! Add a point and update the hull.
+/*!
+ *  \param p The point. (must have dimension spaceDimension())
+ *  \return The point's index.
+ *
+ *  If the point is inside the hull (or on its boundary) the hull does not
+ *  change. Otherwise the facets it can see are replaced by new facets
+ *  that have it as a vertex.
+ *
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if the given point is a
+ *    null Point instance.
+ *  - May throw a DifferentDimensionsException exception if the given
+ *    point's dimension is not spaceDimension().
+ *
+ *  \sa ConvexHull
+ */
+inline
+unsigned int
+ConvexHull::addPoint(const Point & p)
+{
+  if (p.isNull())
+    throw exception_classes::NullObjectException();
+  if (p.dimension() != spaceDimension())
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  std::vector<double> coordinates(spaceDimension());
+  for (unsigned int i = 0; i != spaceDimension(); ++i) {
+    coordinates[i] = p[i];
+    scale_ = std::max(scale_, std::abs(coordinates[i]));
+  }
+  points_.push_back(coordinates);
+  unsigned int index = points_.size() - 1;
+
+  if (isFullDimensional())
+    insertPoint(index);
+  else
+    tryToMakeInitialSimplex();
+
+  return index;
+}
+
+
+//! Does the hull have d + 1 affinely independent points (and facets)?
+inline
+bool
+ConvexHull::isFullDimensional() const
+{
+  return not facets_.empty();
+}
+
+
+//! Get the hull's facets.
+/*!
+ *  \return The hull's facets. (empty if the hull is not full-dimensional)
+ *
+ *  The reference is valid until the next call to addPoint().
+ */
+inline
+const std::vector<ConvexHull::HullFacet> &
+ConvexHull::getFacets() const
+{
+  return facets_;
+}
+
+
+//! Get the indices of the hull's extreme points. (sorted)
+/*!
+ *  \return The indices of the hull's vertices, in increasing order.
+ *          (empty if the hull is not full-dimensional)
+ */
+inline
+std::vector<unsigned int>
+ConvexHull::getExtremePointIndices() const
+{
+  std::vector<unsigned int> indices;
+  for (unsigned int f = 0; f != facets_.size(); ++f)
+    indices.insert(indices.end(), facets_[f].vertices.begin(),
+                   facets_[f].vertices.end());
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+  return indices;
+}
+
+
+//! The id the next new facet will get.
+/*!
+ *  Every facet made after a call to nextFacetId() will have an id that is 
+ *  not smaller than the returned value.
+ */
+inline
+unsigned int
+ConvexHull::nextFacetId() const
+{
+  return nextFacetId_;
+}
+
+
+//! Get (and forget) the ids of the facets removed since the last call.
+/*!
+ *  \return The ids of the facets removed (by addPoint()) since the last 
+ *          call, in the order they were removed. Facets that were made 
+ *          and removed again in the meantime are included.
+ */
+inline
+std::vector<unsigned int>
+ConvexHull::takeRemovedFacetIds()
+{
+  std::vector<unsigned int> removedFacetIds;
+  removedFacetIds.swap(removedFacetIds_);
+
+  return removedFacetIds;
+}
+
+
+//! Try to make the initial simplex out of the points added so far.
+/*!
+ *  Looks for d + 1 affinely independent points. If it finds them it makes
+ *  the d + 1 facets of their simplex and then inserts all the other
+ *  points, one by one.
+ *
+ *  \sa addPoint() and insertPoint()
+ */
+inline
+void
+ConvexHull::tryToMakeInitialSimplex()
+{
+  // Pick the points greedily: a point is picked if it is not (almost) in
+  // the affine hull of the points picked before it.
+  std::vector<unsigned int> simplex(1, 0);
+  std::vector< std::vector<double> > basis;
+  for (unsigned int i = 1; i != points_.size() and
+                           simplex.size() != spaceDimension() + 1; ++i) {
+    std::vector<double> v(spaceDimension());
+    for (unsigned int j = 0; j != spaceDimension(); ++j)
+      v[j] = points_[i][j] - points_[0][j];
+    if (extendOrthonormalBasis(basis, v, tolerance()))
+      simplex.push_back(i);
+  }
+
+  if (simplex.size() != spaceDimension() + 1)
+    // not full-dimensional yet
+    return;
+  // else
+
+  // The simplex's centroid stays strictly inside the hull forever.
+  interiorPoint_.assign(spaceDimension(), 0.0);
+  for (unsigned int k = 0; k != simplex.size(); ++k)
+    for (unsigned int j = 0; j != spaceDimension(); ++j)
+      interiorPoint_[j] += points_[simplex[k]][j] / simplex.size();
+
+  // Each facet of the simplex consists of all but one of its vertices.
+  for (unsigned int k = 0; k != simplex.size(); ++k) {
+    std::vector<unsigned int> vertices(simplex);
+    vertices.erase(vertices.begin() + k);
+    facets_.push_back(makeFacet(vertices));
+  }
+
+  // Insert the rest of the points.
+  for (unsigned int i = 0; i != points_.size(); ++i)
+    if (std::find(simplex.begin(), simplex.end(), i) == simplex.end())
+      insertPoint(i);
+}
+
+
+//! Insert point "index" into the (full-dimensional) hull.
+/*!
+ *  \param index The index of the point.
+ *
+ *  Finds the facets the point can see (the point is strictly above their
+ *  hyperplanes), removes them and connects the point to each ridge on
+ *  the horizon, i.e. each ridge of exactly one of the visible facets.
+ *  (every ridge belongs to exactly two facets) The other facets are not 
+ *  changed.
+ *
+ *  \sa addPoint()
+ */
+inline
+void
+ConvexHull::insertPoint(unsigned int index)
+{
+  assert(isFullDimensional());
+
+  std::vector<bool> isVisible(facets_.size(), false);
+  std::map<std::vector<unsigned int>, unsigned int> ridgeCounts;
+  bool seesSomeFacet = false;
+  for (unsigned int f = 0; f != facets_.size(); ++f) {
+    if (signedDistance(facets_[f], index) <= tolerance())
+      continue;
+    // else
+
+    isVisible[f] = true;
+    seesSomeFacet = true;
+    for (unsigned int k = 0; k != spaceDimension(); ++k) {
+      std::vector<unsigned int> ridge(facets_[f].vertices);
+      ridge.erase(ridge.begin() + k);
+      std::sort(ridge.begin(), ridge.end());
+      ++ridgeCounts[ridge];
+    }
+  }
+
+  if (not seesSomeFacet)
+    // the point is inside the hull (or on its boundary)
+    return;
+  // else
+
+  // Remove the visible facets. (keeping the others in order)
+  unsigned int numKeptFacets = 0;
+  for (unsigned int f = 0; f != facets_.size(); ++f) {
+    if (isVisible[f]) {
+      removedFacetIds_.push_back(facets_[f].id);
+      continue;
+    }
+    // else
+
+    if (numKeptFacets != f)
+      facets_[numKeptFacets] = std::move(facets_[f]);
+    ++numKeptFacets;
+  }
+  facets_.resize(numKeptFacets);
+
+  std::map<std::vector<unsigned int>, unsigned int>::const_iterator ri;
+  for (ri = ridgeCounts.begin(); ri != ridgeCounts.end(); ++ri)
+    if (ri->second == 1) {
+      // a ridge on the horizon
+      std::vector<unsigned int> vertices(ri->first);
+      vertices.push_back(index);
+      facets_.push_back(makeFacet(vertices));
+    }
+}
+
+
+//! Make a facet through the given points. (normal facing outwards)
+/*!
+ *  \param vertices The indices of the facet's d vertices. (must be
+ *                  affinely independent)
+ *  \return The facet. (with a new id)
+ *
+ *  The normal is the (normalized) part of some unit vector that is
+ *  orthogonal to the facet's edges (we use the unit vector that gives the
+ *  longest one, for numerical stability) and
+ *  is oriented so that interiorPoint_ is behind the facet.
+ */
+inline
+ConvexHull::HullFacet
+ConvexHull::makeFacet(const std::vector<unsigned int> & vertices)
+{
+  assert(vertices.size() == spaceDimension());
+
+  const std::vector<double> & origin = points_[vertices[0]];
+
+  // an orthonormal basis of the facet's edges
+  std::vector< std::vector<double> > basis;
+  for (unsigned int k = 1; k != vertices.size(); ++k) {
+    std::vector<double> edge(spaceDimension());
+    for (unsigned int j = 0; j != spaceDimension(); ++j)
+      edge[j] = points_[vertices[k]][j] - origin[j];
+    extendOrthonormalBasis(basis, edge, 0.0);
+  }
+  assert(basis.size() == spaceDimension() - 1);
+
+  // the normal
+  std::vector<double> normal;
+  double normalLength = 0.0;
+  for (unsigned int k = 0; k != spaceDimension(); ++k) {
+    std::vector<double> unitVector(spaceDimension(), 0.0);
+    unitVector[k] = 1.0;
+    std::vector<double> candidate = orthogonalPart(basis, unitVector);
+    double candidateLength = length(candidate);
+    if (candidateLength > normalLength) {
+      normalLength = candidateLength;
+      normal = candidate;
+    }
+  }
+  assert(normalLength > 0.0);
+  for (unsigned int j = 0; j != spaceDimension(); ++j)
+    normal[j] /= normalLength;
+
+  HullFacet facet;
+  facet.id = nextFacetId_++;
+  facet.vertices = vertices;
+  facet.normal = normal;
+  facet.offset = 0.0;
+  for (unsigned int j = 0; j != spaceDimension(); ++j)
+    facet.offset += normal[j] * origin[j];
+
+  // Make the normal face outwards.
+  double interiorSide = -facet.offset;
+  for (unsigned int j = 0; j != spaceDimension(); ++j)
+    interiorSide += normal[j] * interiorPoint_[j];
+  if (interiorSide > 0.0) {
+    for (unsigned int j = 0; j != spaceDimension(); ++j)
+      facet.normal[j] = -facet.normal[j];
+    facet.offset = -facet.offset;
+  }
+
+  return facet;
+}
+
+
+//! The signed distance of point "index" from the facet's hyperplane.
+/*!
+ *  \return Positive if the point is in front of (outside) the facet,
+ *          negative if it is behind it.
+ */
+inline
+double
+ConvexHull::signedDistance(const HullFacet & facet, unsigned int index) const
+{
+  double distance = -facet.offset;
+  for (unsigned int j = 0; j != spaceDimension(); ++j)
+    distance += facet.normal[j] * points_[index][j];
+
+  return distance;
+}
+
+
+//! Points closer than this to a hyperplane count as on it.
+/*!
+ *  Relative to the largest absolute coordinate, so that the hull does
+ *  not depend on the points' units.
+ */
+inline
+double
+ConvexHull::tolerance() const
+{
+  return 1e-10 * (scale_ > 0.0 ? scale_ : 1.0);
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,154 @@
+/*! \file ConvexHull.h
+ *  \brief The declaration of the ConvexHull class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_CONVEX_HULL_H
+#define PARETO_APPROXIMATOR_CONVEX_HULL_H
+
+
+#include <vector>
+
+#include "Point.h"
+#include "DifferentDimensionsException.h"
+#include "NullObjectException.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! The convex hull of a set of points in d-dimensional space.
+/*!
+ *  A simple in-process replacement for qhull's qconvex. (no external
+ *  program, no temporary files) The hull is built incrementally
+ *  (beneath-beyond): each new point removes the facets it can see and
+ *  makes a new facet out of each ridge on the horizon and itself.
+ *
+ *  Every facet is a simplex, i.e. it has exactly d vertices. Flat faces
+ *  with more than d vertices are split into several coplanar facets.
+ *  (like qconvex's "Qt" option does)
+ *
+ *  Points are identified by their index, i.e. the order in which they
+ *  were added (starting at 0). Facets are identified by their id; every
+ *  new facet gets the next id (starting at 0) and keeps it until a point
+ *  that can see it removes it. Facets a point cannot see are not touched
+ *  at all, so a user that keeps its own data about each facet (e.g. PGEN)
+ *  can update it incrementally: drop the data of the facets in 
+ *  takeRemovedFacetIds() and make data for the facets whose id is not 
+ *  smaller than the nextFacetId() of before the insertions.
+ *
+ *  The hull only has facets once it is full-dimensional (i.e. once it has
+ *  d + 1 affinely independent points). Points added before that are kept
+ *  and inserted as soon as the hull can be started.
+ *
+ *  A ConvexHull instance only touches its own data so different instances
+ *  can be used from different threads at the same time.
+ *
+ *  \sa utility::computeConvexHullFacets() and utility::computeConvexHull()
+ */
+class ConvexHull
+{
+  public:
+    //! A facet of the convex hull.
+    struct HullFacet
+    {
+      //! The facet's id. (unique, never reused)
+      unsigned int id;
+      //! The indices of the facet's d vertices.
+      std::vector<unsigned int> vertices;
+      //! The facet's (unit length) normal vector. (pointing outwards)
+      std::vector<double> normal;
+      //! The facet's offset, i.e. normal * x = offset for each x on the facet.
+      double offset;
+    };
+
+    //! Constructor. Makes an empty hull.
+    explicit ConvexHull(unsigned int spaceDimension);
+
+    //! Destructor. (empty)
+    ~ConvexHull();
+
+    //! The dimension of the space the points live in.
+    unsigned int spaceDimension() const;
+
+    //! The number of points added so far. (extreme or not)
+    unsigned int numPoints() const;
+
+    //! Add a point and update the hull.
+    unsigned int addPoint(const Point & p);
+
+    //! Does the hull have d + 1 affinely independent points (and facets)?
+    bool isFullDimensional() const;
+
+    //! Get the hull's facets.
+    const std::vector<HullFacet> & getFacets() const;
+
+    //! Get the indices of the hull's extreme points. (sorted)
+    std::vector<unsigned int> getExtremePointIndices() const;
+
+    //! The id the next new facet will get.
+    unsigned int nextFacetId() const;
+
+    //! Get (and forget) the ids of the facets removed since the last call.
+    std::vector<unsigned int> takeRemovedFacetIds();
+
+  private:
+    //! Try to make the initial simplex out of the points added so far.
+    void tryToMakeInitialSimplex();
+
+    //! Insert point "index" into the (full-dimensional) hull.
+    void insertPoint(unsigned int index);
+
+    //! Make a facet through the given points. (normal facing outwards)
+    HullFacet makeFacet(const std::vector<unsigned int> & vertices);
+
+    //! The signed distance of point "index" from the facet's hyperplane.
+    double signedDistance(const HullFacet & facet, unsigned int index) const;
+
+    //! Points closer than this to a hyperplane count as on it.
+    double tolerance() const;
+
+    //! The dimension of the space the points live in.
+    unsigned int spaceDimension_;
+
+    //! The coordinates of all the points added so far.
+    std::vector< std::vector<double> > points_;
+
+    //! The hull's facets. (empty until the hull is full-dimensional)
+    std::vector<HullFacet> facets_;
+
+    //! The id the next new facet will get.
+    unsigned int nextFacetId_;
+
+    //! The ids of the facets removed since the last takeRemovedFacetIds().
+    std::vector<unsigned int> removedFacetIds_;
+
+    //! A point strictly inside the hull. (used to orient the facets)
+    std::vector<double> interiorPoint_;
+
+    //! The largest absolute coordinate so far. (see tolerance())
+    double scale_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We will #include the implementation here because we want to make a
+// header-only code base.
+#include "ConvexHull.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_CONVEX_HULL_H
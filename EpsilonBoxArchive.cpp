@@ -0,0 +1,381 @@
+/*! \file EpsilonBoxArchive.cpp
+ *  \brief The implementation of the EpsilonBoxArchive<T> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` EpsilonBoxArchive.h. In fact EpsilonBoxArchive.h will
+ *  `include` EpsilonBoxArchive.cpp because it describes a class template
+ *  (which doesn't allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <cmath>
+#include <functional>
+
+#include "DifferentDimensionsException.h"
+#include "NegativeApproximationRatioException.h"
+#include "NotPositivePointException.h"
+#include "NotStrictlyPositivePointException.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Make an empty archive with the given boxes.
+/*!
+ *  \param eps The box size. (\f$ \epsilon > 0 \f$)
+ *  \param boxType The kind of boxes. (additive or multiplicative)
+ *
+ *  Possible exceptions:
+ *  - May throw a NegativeApproximationRatioException exception if eps is
+ *    not positive.
+ */
+template <class T>
+EpsilonBoxArchive<T>::EpsilonBoxArchive(double eps, BoxType boxType) :
+                  eps_(eps), boxType_(boxType)
+{
+  if (not (eps > 0.0))
+    throw exception_classes::NegativeApproximationRatioException();
+}
+
+
+//! Iteration constructor.
+/*!
+ *  \param first An input iterator to the first T instance.
+ *  \param last An input iterator to the past-the-end T instance.
+ *  \param eps The box size. (\f$ \epsilon > 0 \f$)
+ *  \param boxType The kind of boxes. (additive or multiplicative)
+ *
+ *  Inserts the elements in [first, last) one by one.
+ *
+ *  \sa EpsilonBoxArchive and insert()
+ */
+template <class T>
+template <class InputIterator>
+EpsilonBoxArchive<T>::EpsilonBoxArchive(InputIterator first,
+                                        InputIterator last, double eps,
+                                        BoxType boxType) :
+                  eps_(eps), boxType_(boxType)
+{
+  if (not (eps > 0.0))
+    throw exception_classes::NegativeApproximationRatioException();
+  // else
+
+  insert(first, last);
+}
+
+
+//! Destructor. (all the contained elements' destructors will be called)
+template <class T>
+EpsilonBoxArchive<T>::~EpsilonBoxArchive() { }
+
+
+//! Return iterator to beginning.
+template <class T>
+typename EpsilonBoxArchive<T>::iterator
+EpsilonBoxArchive<T>::begin() const
+{
+  return elements_.begin();
+}
+
+
+//! Return iterator to end.
+template <class T>
+typename EpsilonBoxArchive<T>::iterator
+EpsilonBoxArchive<T>::end() const
+{
+  return elements_.end();
+}
+
+
+//! Test whether container is empty.
+template <class T>
+bool
+EpsilonBoxArchive<T>::empty() const
+{
+  return elements_.empty();
+}
+
+
+//! Returns the number of elements in the container.
+template <class T>
+typename EpsilonBoxArchive<T>::size_type
+EpsilonBoxArchive<T>::size() const
+{
+  return elements_.size();
+}
+
+
+//! The box size.
+template <class T>
+double
+EpsilonBoxArchive<T>::eps() const
+{
+  return eps_;
+}
+
+
+//! The kind of boxes.
+template <class T>
+typename EpsilonBoxArchive<T>::BoxType
+EpsilonBoxArchive<T>::boxType() const
+{
+  return boxType_;
+}
+
+
+//! Insert element.
+/*!
+ *  \param t The T instance to insert.
+ *  \return true if the element was actually inserted; false otherwise.
+ *
+ *  Looks t's box up in the hash table:
+ *  - If some element is in the same box, t either takes its place or is
+ *    rejected. (keepsBox())
+ *  - Otherwise t is rejected if some element's box dominates t's box,
+ *    else it is inserted and the elements whose boxes t's box dominates
+ *    are erased.
+ *
+ *  \sa EpsilonBoxArchive
+ */
+template <class T>
+bool
+EpsilonBoxArchive<T>::insert(const T & t)
+{
+  std::vector<double> position = positionOf(t);
+  Box box = boxAt(position);
+  typename std::unordered_map<Box, unsigned int, BoxHash>::const_iterator
+        found = boxIndex_.find(box);
+  if (found != boxIndex_.end()) {
+    if (keepsBox(found->second, t, position))
+      return false;
+    // else
+    elements_[found->second] = t;
+    return true;
+  }
+  // else
+
+  Point boxCorner(box.cbegin(), box.cend());
+  if (boxBlock_.someDominates(boxCorner))
+    return false;
+  // else
+
+  // erase from the back, so that the indices stay valid
+  std::vector<unsigned int> dominated = boxBlock_.dominatedBy(boxCorner);
+  for (unsigned int k = dominated.size(); k != 0; --k)
+    erase(dominated[k - 1]);
+
+  boxIndex_[box] = elements_.size();
+  elements_.push_back(t);
+  boxes_.push_back(box);
+  boxBlock_.push_back(boxCorner);
+
+  return true;
+}
+
+
+//! Insert elements.
+/*!
+ *  \param first An input iterator to the first T instance.
+ *  \param last An input iterator to the past-the-end T instance.
+ *  \return true if at least one element was actually inserted;
+ *          false otherwise.
+ *
+ *  Inserts the elements in [first, last) one by one.
+ *
+ *  \sa EpsilonBoxArchive and insert()
+ */
+template <class T>
+template <class InputIterator>
+bool
+EpsilonBoxArchive<T>::insert(InputIterator first, InputIterator last)
+{
+  bool insertedAtLeastOneElement = false;
+  for ( ; first != last; ++first)
+    insertedAtLeastOneElement |= this->insert(*first);
+
+  return insertedAtLeastOneElement;
+}
+
+
+//! Would the given instance be rejected?
+/*!
+ *  \param t A T instance.
+ *  \return true if insert(t) would not insert t; false otherwise.
+ *
+ *  Throws like insert().
+ *
+ *  \sa EpsilonBoxArchive
+ */
+template <class T>
+bool
+EpsilonBoxArchive<T>::dominates(const T & t) const
+{
+  std::vector<double> position = positionOf(t);
+  Box box = boxAt(position);
+  typename std::unordered_map<Box, unsigned int, BoxHash>::const_iterator
+        found = boxIndex_.find(box);
+  if (found != boxIndex_.end())
+    return keepsBox(found->second, t, position);
+  // else
+
+  return boxBlock_.someDominates(Point(box.cbegin(), box.cend()));
+}
+
+
+//! Clear content.
+template <class T>
+void
+EpsilonBoxArchive<T>::clear()
+{
+  elements_.clear();
+  boxes_.clear();
+  boxBlock_ = PointBlock();
+  boxIndex_.clear();
+}
+
+
+//! Hashes a Box.
+template <class T>
+std::size_t
+EpsilonBoxArchive<T>::BoxHash::operator() (const Box & box) const
+{
+  std::size_t seed = box.size();
+  for (unsigned int i = 0; i != box.size(); ++i)
+    seed ^= std::hash<double>()(box[i]) + 0x9e3779b9 +
+            (seed << 6) + (seed >> 2);
+
+  return seed;
+}
+
+
+//! Check t's point and compute its position in box units.
+/*!
+ *  The i'th coordinate of the result is \f$ p_{i} / \epsilon \f$
+ *  (additive boxes) or \f$ \log p_{i} / \log(1 + \epsilon) \f$
+ *  (multiplicative boxes), where p is t's point; its box is the result
+ *  rounded down.
+ *
+ *  Throws like insert().
+ */
+template <class T>
+std::vector<double>
+EpsilonBoxArchive<T>::positionOf(const T & t) const
+{
+  const auto & p = NonDominatedSetPoint<T>::point(t);
+  if (not empty() and p.dimension() != boxes_.front().size())
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  std::vector<double> position(p.dimension());
+  if (boxType_ == AdditiveBoxes)
+    for (unsigned int i = 0; i != p.dimension(); ++i) {
+      if (p[i] < 0.0)
+        throw exception_classes::NotPositivePointException();
+      position[i] = p[i] / eps_;
+    }
+  else {
+    const double logBase = std::log1p(eps_);
+    for (unsigned int i = 0; i != p.dimension(); ++i) {
+      if (p[i] <= 0.0)
+        throw exception_classes::NotStrictlyPositivePointException();
+      position[i] = std::log(p[i]) / logBase;
+    }
+  }
+
+  return position;
+}
+
+
+//! The box at the given position. (rounded down)
+template <class T>
+typename EpsilonBoxArchive<T>::Box
+EpsilonBoxArchive<T>::boxAt(const std::vector<double> & position)
+{
+  // (adding 0.0 turns -0.0 into 0.0, which hashes the same as 0.0)
+  Box box(position.size());
+  for (unsigned int i = 0; i != position.size(); ++i)
+    box[i] = std::floor(position[i]) + 0.0;
+
+  return box;
+}
+
+
+//! Does p weakly dominate q? (\f$ p_{i} \le q_{i} \f$ for all i)
+template <class T>
+bool
+EpsilonBoxArchive<T>::isLessOrEqual(const T & p, const T & q)
+{
+  const auto & pp = NonDominatedSetPoint<T>::point(p);
+  const auto & qq = NonDominatedSetPoint<T>::point(q);
+  for (unsigned int i = 0; i != pp.dimension(); ++i)
+    if (pp[i] > qq[i])
+      return false;
+
+  return true;
+}
+
+
+//! Does the k'th element stay if t (at position) goes to its box?
+/*!
+ *  The element stays if it dominates t. Otherwise, t takes its place if
+ *  it dominates the element or, if neither dominates the other, if it is
+ *  closer to the box's lower corner. (Euclidean distance, in box units)
+ */
+template <class T>
+bool
+EpsilonBoxArchive<T>::keepsBox(unsigned int k, const T & t,
+                               const std::vector<double> & position) const
+{
+  const T & element = elements_[k];
+  if (isLessOrEqual(element, t))
+    return true;
+  if (isLessOrEqual(t, element))
+    return false;
+  // else
+
+  std::vector<double> elementPosition = positionOf(element);
+  double elementDistance = 0.0;
+  double distance = 0.0;
+  for (unsigned int i = 0; i != position.size(); ++i) {
+    double d = elementPosition[i] - boxes_[k][i];
+    elementDistance += d * d;
+    d = position[i] - boxes_[k][i];
+    distance += d * d;
+  }
+
+  return elementDistance <= distance;
+}
+
+
+//! Erase the k'th element. (the last element takes its place)
+template <class T>
+void
+EpsilonBoxArchive<T>::erase(unsigned int k)
+{
+  assert(k < elements_.size());
+
+  boxIndex_.erase(boxes_[k]);
+  if (k + 1 != elements_.size()) {
+    elements_[k] = elements_.back();
+    boxes_[k].swap(boxes_.back());
+    boxIndex_[boxes_[k]] = k;
+  }
+  elements_.pop_back();
+  boxes_.pop_back();
+  boxBlock_.erase(k);
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,224 @@
+/*! \file EpsilonBoxArchive.h
+ *  \brief The definition of the EpsilonBoxArchive<T> class template. (an
+ *         archive keeping at most one point per epsilon box)
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef EPSILON_BOX_ARCHIVE_H
+#define EPSILON_BOX_ARCHIVE_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "Point.h"
+#include "PointBlock.h"
+#include "NonDominatedSet.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! An archive of eps-non-dominated points, at most one per epsilon box.
+/*!
+ *  A NonDominatedSet keeps every non-dominated point it is given, so on
+ *  dense Pareto fronts it can grow without bound. An EpsilonBoxArchive
+ *  splits the space into boxes and keeps at most one point per box
+ *  instead:
+ *  - additive boxes: point p is in box b with
+ *    \f$ b_{i} = \lfloor p_{i} / \epsilon \rfloor \f$,
+ *  - multiplicative boxes: point p is in box b with
+ *    \f$ b_{i} = \lfloor \log p_{i} / \log(1 + \epsilon) \rfloor \f$.
+ *
+ *  It is the archive described in: M. Laumanns, L. Thiele, K. Deb and
+ *  E. Zitzler, "Combining convergence and diversity in evolutionary
+ *  multiobjective optimization", Evolutionary Computation, 2002:
+ *  - a point whose box is dominated by some element's box is rejected,
+ *  - a point whose box dominates some elements' boxes replaces them,
+ *  - of two points in the same box the archive keeps the one that
+ *    dominates the other or, if neither does, the one closer to the
+ *    box's lower corner. (the old one on ties)
+ *
+ *  So, for every point ever inserted, some element eps-dominates it
+ *  (Point::dominatesAdditive() or Point::dominatesMultiplicative(),
+ *  depending on the boxes) and the elements' boxes are mutually
+ *  non-dominated. The archive never holds more elements than there are
+ *  mutually non-dominated boxes (e.g. \f$ (K / \epsilon)^{d-1} \f$
+ *  additive boxes for d-dimensional points with coordinates in [0, K)),
+ *  however many points go through it.
+ *
+ *  T must be Point, FixedPoint<N> or PointAndSolution<S>. (see
+ *  NonDominatedSetPoint) The box of a point is found in O(1) (expected)
+ *  time with a hash table; the elements' boxes are kept in a PointBlock
+ *  for the box dominance checks.
+ *
+ *  The elements are not kept in any particular order.
+ *
+ *  \sa NonDominatedSet, NonDominatedSetPoint and PointBlock
+ */
+template <class T>
+class EpsilonBoxArchive
+{
+  public:
+    //! The two kinds of boxes.
+    enum BoxType
+    {
+      //! Boxes of side eps. (see Point::dominatesAdditive())
+      AdditiveBoxes,
+      //! Boxes of side log(1 + eps) in log space.
+      //! (see Point::dominatesMultiplicative())
+      MultiplicativeBoxes
+    };
+
+    //! Random access iterator to the archive's elements.
+    typedef typename std::vector<T>::const_iterator iterator;
+
+    //! Constant random access iterator to the archive's elements.
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    //! Unsigned integral type (usually same as size_t).
+    typedef typename std::vector<T>::size_type size_type;
+
+    //! Make an empty archive with the given boxes.
+    /*!
+     *  \param eps The box size. (\f$ \epsilon > 0 \f$)
+     *  \param boxType The kind of boxes. (additive or multiplicative)
+     *
+     *  Possible exceptions:
+     *  - May throw a NegativeApproximationRatioException exception if
+     *    eps is not positive.
+     */
+    explicit EpsilonBoxArchive(double eps, BoxType boxType=AdditiveBoxes);
+
+    //! Iteration constructor.
+    template <class InputIterator>
+    EpsilonBoxArchive(InputIterator first, InputIterator last, double eps,
+                      BoxType boxType=AdditiveBoxes);
+
+    //! Destructor. (all the contained elements' destructors will be called)
+    ~EpsilonBoxArchive();
+
+    //! Return iterator to beginning.
+    iterator begin() const;
+
+    //! Return iterator to end.
+    iterator end() const;
+
+    //! Test whether container is empty.
+    bool empty() const;
+
+    //! Returns the number of elements in the container.
+    size_type size() const;
+
+    //! The box size.
+    double eps() const;
+
+    //! The kind of boxes.
+    BoxType boxType() const;
+
+    //! Insert element.
+    /*!
+     *  \param t The T instance to insert.
+     *  \return true if the element was actually inserted; false otherwise.
+     *
+     *  See EpsilonBoxArchive for which elements are inserted and which
+     *  elements they replace.
+     *
+     *  Possible exceptions:
+     *  - May throw a NullObjectException exception if t (or its point)
+     *    is null.
+     *  - May throw a DifferentDimensionsException exception if the
+     *    archive is not empty and t's dimension is not its elements'.
+     *  - May throw a NotPositivePointException exception if the boxes
+     *    are additive and t's point is not positive.
+     *  - May throw a NotStrictlyPositivePointException exception if the
+     *    boxes are multiplicative and t's point is not strictly positive.
+     *
+     *  \sa EpsilonBoxArchive
+     */
+    bool insert(const T & t);
+
+    //! Insert elements.
+    template <class InputIterator>
+    bool insert(InputIterator first, InputIterator last);
+
+    //! Would the given instance be rejected?
+    /*!
+     *  \param t A T instance.
+     *  \return true if insert(t) would not insert t; false otherwise.
+     *
+     *  Throws like insert().
+     *
+     *  \sa EpsilonBoxArchive
+     */
+    bool dominates(const T & t) const;
+
+    //! Clear content.
+    void clear();
+
+  private:
+    //! A box's coordinates. (integers)
+    typedef std::vector<double> Box;
+
+    //! Hashes a Box.
+    struct BoxHash
+    {
+      std::size_t operator() (const Box & box) const;
+    };
+
+    //! Check t's point and compute its position in box units.
+    std::vector<double> positionOf(const T & t) const;
+
+    //! The box at the given position. (rounded down)
+    static Box boxAt(const std::vector<double> & position);
+
+    //! Does p weakly dominate q? (\f$ p_{i} \le q_{i} \f$ for all i)
+    static bool isLessOrEqual(const T & p, const T & q);
+
+    //! Does the k'th element stay if t (at position) goes to its box?
+    bool keepsBox(unsigned int k, const T & t,
+                  const std::vector<double> & position) const;
+
+    //! Erase the k'th element. (the last element takes its place)
+    void erase(unsigned int k);
+
+    //! The box size.
+    double eps_;
+
+    //! The kind of boxes.
+    BoxType boxType_;
+
+    //! The elements.
+    std::vector<T> elements_;
+
+    //! boxes_[k] is elements_[k]'s box.
+    std::vector<Box> boxes_;
+
+    //! The elements' boxes, for the box dominance checks. (k'th is boxes_[k])
+    PointBlock boxBlock_;
+
+    //! Maps every element's box to the element's index.
+    std::unordered_map<Box, unsigned int, BoxHash> boxIndex_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "EpsilonBoxArchive.cpp"
+
+
+#endif  // EPSILON_BOX_ARCHIVE_H
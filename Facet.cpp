@@ -12,6 +12,8 @@
 #include <assert.h>
 #include <iterator>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <armadillo>
 
 
@@ -93,7 +95,9 @@ Facet<S>::Facet(
   computeAndSetFacetNormal(preferPositiveNormalVector);
 
   // Compute and set the facet's offset.
-  b_ = arma::dot( arma::vec(normal_), vertices_[0].point.toVec() );
+  b_ = 0.0;
+  for (unsigned int i = 0; i != spaceDimension_; ++i)
+    b_ += normal_[i] * vertices_[0].point[i];
 
   // Compute and set the facet's localApproximationErrorUpperBound_ and 
   // isBoundaryFacet_ attributes.
@@ -171,7 +175,9 @@ Facet<S>::Facet(
   normal_.assign(firstElemOfFacetNormal, lastElemOfFacetNormal);
 
   // Compute and set the facet's offset.
-  b_ = arma::dot( arma::vec(normal_), vertices_[0].point.toVec() );
+  b_ = 0.0;
+  for (unsigned int i = 0; i != spaceDimension_; ++i)
+    b_ += normal_[i] * vertices_[0].point[i];
 
   // Compute and set the facet's localApproximationErrorUpperBound_ and 
   // isBoundaryFacet_ attributes.
@@ -205,6 +211,10 @@ Facet<S>::spaceDimension() const
  *  do not intersect in a unique point. Check the documentation of Facet 
  *  for more info.)
  *  
+ *  In four or more dimensions facets whose normal vectors have 
+ *  negative elements are boundary facets too. (They do not face the 
+ *  Pareto set, so their Lower Distal Point, if any, tells us nothing.)
+ *  
  *  \sa Facet and Facet<S>::computeLowerDistalPoint()
  */
 template <class S> 
@@ -400,6 +410,12 @@ template <class S>
 Point 
 Facet<S>::computeLowerDistalPoint() const
 {
+  // - For 2 and 3 dimensions solve the (tiny) system in closed form.
+  //   (no heap allocations, no /dev/null stream, no LAPACK call)
+  if (spaceDimension() == 2 or spaceDimension() == 3)
+    return computeLowerDistalPointInClosedForm();
+  // else
+
   // open a stream to /dev/null (will redirect error messages there)
   // - will redirect error messages there
   std::ofstream f("/dev/null");
@@ -501,10 +517,15 @@ Facet<S>::euclideanDistance(const Point & p) const
   if (spaceDimension() != p.dimension())
     throw exception_classes::DifferentDimensionsException();
 
-  double normOfNormalVector = arma::norm(arma::vec(normal_), 2);
+  double dotProduct = 0.0;
+  double squaredNormOfNormalVector = 0.0;
+  for (unsigned int i = 0; i != spaceDimension(); ++i) {
+    dotProduct += normal_[i] * p[i];
+    squaredNormOfNormalVector += normal_[i] * normal_[i];
+  }
 
-  return std::abs( (arma::dot(arma::vec(normal_), p.toVec()) - b()) / 
-                   normOfNormalVector );
+  return std::abs( (dotProduct - b()) / 
+                   std::sqrt(squaredNormOfNormalVector) );
 }
 
 
@@ -554,25 +575,11 @@ Facet<S>::ratioDistance(const Point & p) const
     throw exception_classes::NotStrictlyPositivePointException();
   // else
 
-  assert(spaceDimension() > 0);
-
-  double dotProduct  = 0.0;
-  double facetOffset = b();      // the facet's offset from the origin
-  for (unsigned int i=0; i!=spaceDimension(); ++i) {
-    dotProduct  += normal_[i] * p[i];
-  }
-
-  double result;
-  if (dotProduct == facetOffset)
-    // the point is on the facet
-    // it's okay even if dotProduct == 0.0
-    result = 0.0;
-  else if (dotProduct == 0.0)
+  double result = ratioDistanceUnchecked(p);
+  if (std::isinf(result))
     // multiplying the point by a constant moves it in a direction 
     // parallel to the hyperplane
     throw exception_classes::InfiniteRatioDistanceException();
-  else
-    result = std::max( (facetOffset - dotProduct) / dotProduct, 0.0 );
 
   return result;
 }
@@ -620,23 +627,87 @@ Facet<S>::additiveDistance(const Point & p) const
     throw exception_classes::NotPositivePointException();
   // else
 
-  assert(spaceDimension() > 0);
+  return additiveDistanceUnchecked(p);
+}
+
+
+//! Compute many points' ratio distances from the facet's hyperplane.
+/*!
+ *  \param points A block of strictly positive points.
+ *  \return The k'th element is ratioDistance(points.point(k)).
+ *  
+ *  Computes all the dot products with the facet's normal vector at 
+ *  once (PointBlock::dotProducts()). The points are not checked for 
+ *  positivity.
+ *  
+ *  Possible exceptions:
+ *  - May throw a DifferentDimensionsException exception if the block 
+ *    is not empty and its points and the hyperplane belong in spaces 
+ *    of different dimensions.
+ *  - May throw an InfiniteRatioDistanceException exception if some 
+ *    point is not on the hyperplane but its dot product with the 
+ *    facet's normal vector is 0.0. (see ratioDistance())
+ *
+ *  \sa ratioDistance(), PointBlock and Facet
+ */
+template <class S> 
+std::vector<double> 
+Facet<S>::ratioDistances(const PointBlock & points) const
+{
+  // (PointBlock::dotProducts() checks the dimensions)
+  std::vector<double> result = points.dotProducts(normal_);
+
+  double facetOffset = b();      // the facet's offset from the origin
+  std::vector<double>::iterator it;
+  for (it = result.begin(); it != result.end(); ++it) {
+    double dotProduct = *it;
+    if (dotProduct == facetOffset)
+      // the point is on the facet
+      *it = 0.0;
+    else if (dotProduct == 0.0)
+      throw exception_classes::InfiniteRatioDistanceException();
+    else
+      *it = std::max( (facetOffset - dotProduct) / dotProduct, 0.0 );
+  }
+
+  return result;
+}
+
+
+//! Compute many points' additive distances from the facet's hyperplane.
+/*!
+ *  \param points A block of positive points.
+ *  \return The k'th element is additiveDistance(points.point(k)).
+ *  
+ *  Computes all the dot products with the facet's normal vector at 
+ *  once (PointBlock::dotProducts()). The points are not checked for 
+ *  positivity.
+ *  
+ *  Possible exceptions:
+ *  - May throw a DifferentDimensionsException exception if the block 
+ *    is not empty and its points and the hyperplane belong in spaces 
+ *    of different dimensions.
+ *
+ *  \sa additiveDistance(), PointBlock and Facet
+ */
+template <class S> 
+std::vector<double> 
+Facet<S>::additiveDistances(const PointBlock & points) const
+{
+  // (PointBlock::dotProducts() checks the dimensions)
+  std::vector<double> result = points.dotProducts(normal_);
 
   double sumOfFacetNormal = 0.0;
-  double dotProduct       = 0.0;
-  for (unsigned int i=0; i!=spaceDimension(); ++i) {
+  for (unsigned int i=0; i!=spaceDimension(); ++i)
     sumOfFacetNormal += normal_[i];
-    dotProduct       += normal_[i] * p[i];
-  }
+  assert(result.empty() or sumOfFacetNormal != 0.0);
 
-  // - To calculate the result we take advantage of the fact that point 
-  //   (p + \f$\epsilon\f$) will be lying on H (the hyperplane).
-  // - sumOfFacetNormal should not be 0.0 - it can only be 0.0 if 
-  //   the facet's normal vector is all zero (not a valid facet)
-  //   (we assume the facet has an all-positive normal vector; 
-  //   if not, there is no point in calling this method)
-  assert(sumOfFacetNormal != 0.0);
-  return std::max( (b() - dotProduct) / sumOfFacetNormal, 0.0 );
+  double facetOffset = b();
+  std::vector<double>::iterator it;
+  for (it = result.begin(); it != result.end(); ++it)
+    *it = std::max( (facetOffset - *it) / sumOfFacetNormal, 0.0 );
+
+  return result;
 }
 
 
@@ -714,10 +785,7 @@ Facet<S>::dominatesAdditive(const Point & p, double eps) const
     throw exception_classes::NotPositivePointException();
   // else
 
-  if (additiveDistance(p) <= eps)
-    return true;
-  else
-    return false;
+  return dominatesAdditiveUnchecked(p, eps);
 }
 
 
@@ -760,10 +828,142 @@ Facet<S>::dominatesMultiplicative(const Point & p, double eps) const
     throw exception_classes::NegativeApproximationRatioException();
   // else
 
-  if (ratioDistance(p) <= eps)
-    return true;
+  return dominatesMultiplicativeUnchecked(p, eps);
+}
+
+
+//! distance() without the checks.
+/*!
+ *  p must be non-null, positive and of the facet's dimension. (only 
+ *  assert()ed)
+ *  
+ *  \sa distance() and additiveDistanceUnchecked()
+ */
+template <class S> 
+double 
+Facet<S>::distanceUnchecked(const Point & p) const
+{
+  return additiveDistanceUnchecked(p);
+}
+
+
+//! ratioDistance() without the checks.
+/*!
+ *  \param p A Point instance. (stricty positive)
+ *  \return The point's ratio distance from the hyperplane on which the 
+ *          facet lies or \f$ +\infty \f$ if the point's coordinate 
+ *          vector is perpendicular to the facet's normal vector.
+ *  
+ *  p must be non-null, strictly positive and of the facet's dimension. 
+ *  (only assert()ed)
+ *  
+ *  \sa ratioDistance()
+ */
+template <class S> 
+double 
+Facet<S>::ratioDistanceUnchecked(const Point & p) const
+{
+  assert(spaceDimension() > 0);
+  assert(not p.isNull() and p.dimension() == spaceDimension());
+
+  const double * normal = normal_.data();
+  double dotProduct  = 0.0;
+  double facetOffset = b();      // the facet's offset from the origin
+  for (unsigned int i = 0; i != normal_.size(); ++i)
+    dotProduct += normal[i] * p.coordinateUnchecked(i);
+
+  if (dotProduct == facetOffset)
+    // the point is on the facet
+    // it's okay even if dotProduct == 0.0
+    return 0.0;
+  else if (dotProduct == 0.0)
+    // multiplying the point by a constant moves it in a direction 
+    // parallel to the hyperplane
+    return std::numeric_limits<double>::infinity();
   else
-    return false;
+    return std::max( (facetOffset - dotProduct) / dotProduct, 0.0 );
+}
+
+
+//! additiveDistance() without the checks.
+/*!
+ *  p must be non-null, positive and of the facet's dimension. (only 
+ *  assert()ed)
+ *  
+ *  \sa additiveDistance()
+ */
+template <class S> 
+double 
+Facet<S>::additiveDistanceUnchecked(const Point & p) const
+{
+  assert(spaceDimension() > 0);
+  assert(not p.isNull() and p.dimension() == spaceDimension());
+
+  const double * normal = normal_.data();
+  double sumOfFacetNormal = 0.0;
+  double dotProduct       = 0.0;
+  for (unsigned int i = 0; i != normal_.size(); ++i) {
+    sumOfFacetNormal += normal[i];
+    dotProduct       += normal[i] * p.coordinateUnchecked(i);
+  }
+
+  // - To calculate the result we take advantage of the fact that point 
+  //   (p + \f$\epsilon\f$) will be lying on H (the hyperplane).
+  // - sumOfFacetNormal should not be 0.0 - it can only be 0.0 if 
+  //   the facet's normal vector is all zero (not a valid facet)
+  //   (we assume the facet has an all-positive normal vector; 
+  //   if not, there is no point in calling this method)
+  assert(sumOfFacetNormal != 0.0);
+  return std::max( (b() - dotProduct) / sumOfFacetNormal, 0.0 );
+}
+
+
+//! dominates() without the checks.
+/*!
+ *  Currently using the additive error measure, like dominates().
+ *  
+ *  \sa dominates() and dominatesAdditiveUnchecked()
+ */
+template <class S> 
+bool 
+Facet<S>::dominatesUnchecked(const Point & p, double eps) const
+{
+  return dominatesAdditiveUnchecked(p, eps);
+}
+
+
+//! dominatesAdditive() without the checks.
+/*!
+ *  p must be non-null, positive and of the facet's dimension and eps 
+ *  must not be negative. (only assert()ed)
+ *  
+ *  \sa dominatesAdditive()
+ */
+template <class S> 
+bool 
+Facet<S>::dominatesAdditiveUnchecked(const Point & p, double eps) const
+{
+  assert(eps >= 0.0);
+
+  return additiveDistanceUnchecked(p) <= eps;
+}
+
+
+//! dominatesMultiplicative() without the checks.
+/*!
+ *  p must be non-null, strictly positive and of the facet's dimension 
+ *  and eps must not be negative. (only assert()ed)
+ *  
+ *  \sa dominatesMultiplicative()
+ */
+template <class S> 
+bool 
+Facet<S>::dominatesMultiplicativeUnchecked(const Point & p, 
+                                           double eps) const
+{
+  assert(eps >= 0.0);
+
+  return ratioDistanceUnchecked(p) <= eps;
 }
 
 
@@ -904,6 +1104,47 @@ Facet<S>::isCoplanarWith(const Point & p) const
 template <class S> 
 void 
 Facet<S>::computeAndSetFacetNormal(bool preferPositiveNormalVector) 
+{
+  // - For 2 and 3 dimensions the determinants below are a 2D perpendicular 
+  //   and a cross product of the facet's edges. Compute them directly.
+  if (spaceDimension() == 2) {
+    const Point & p = vertices_[0].point;
+    const Point & q = vertices_[1].point;
+    normal_.push_back(q[1] - p[1]);
+    normal_.push_back(p[0] - q[0]);
+  }
+  else if (spaceDimension() == 3) {
+    const Point & p = vertices_[0].point;
+    const Point & q = vertices_[1].point;
+    const Point & r = vertices_[2].point;
+    double u[3] = { q[0] - p[0], q[1] - p[1], q[2] - p[2] };
+    double v[3] = { r[0] - p[0], r[1] - p[1], r[2] - p[2] };
+    normal_.push_back(u[1] * v[2] - u[2] * v[1]);
+    normal_.push_back(u[2] * v[0] - u[0] * v[2]);
+    normal_.push_back(u[0] * v[1] - u[1] * v[0]);
+  }
+  else
+    computeAndSetFacetNormalWithArmadillo();
+
+  if (preferPositiveNormalVector && hasAllNormalVectorElementsNonPositive())
+    reverseNormalVectorSign();
+}
+
+
+/*!
+ *  \brief Compute (and set) the facet's normal vector using Armadillo. 
+ *         (any dimension)
+ *  
+ *  Element i of the normal vector is the determinant of the matrix 
+ *  whose rows are the facet's vertices, with column i replaced by ones.
+ *  
+ *  Used by Facet<S>::computeAndSetFacetNormal() for 4 or more dimensions.
+ *  
+ *  \sa Facet
+ */
+template <class S> 
+void 
+Facet<S>::computeAndSetFacetNormalWithArmadillo() 
 {
   // fill a matrix will each point's coordinates
   arma::mat M;
@@ -919,9 +1160,85 @@ Facet<S>::computeAndSetFacetNormal(bool preferPositiveNormalVector)
     normal_.push_back(arma::det(M.cols(0, M.n_cols - 2)));
     M.swap_cols(i, M.n_cols - 1);
   }
+}
 
-  if (preferPositiveNormalVector && hasAllNormalVectorElementsNonPositive())
-    reverseNormalVectorSign();
+
+/*!
+ *  \brief Compute the facet's Lower Distal Point (LDP) in closed form. 
+ *         (2 or 3 dimensions only)
+ *  
+ *  \return The facet's Lower Distal Point (Point instance) if one 
+ *          exists, a null Point instance otherwise.
+ *  
+ *  Solves the same system as Facet<S>::computeLowerDistalPoint() using 
+ *  Cramer's rule. For 3 dimensions, with w_{i} the rows of the system: 
+ *  \f$ x = ( b_{1} (w_{2} \times w_{3}) + b_{2} (w_{3} \times w_{1}) + 
+ *  b_{3} (w_{1} \times w_{2}) ) / (w_{1} \cdot (w_{2} \times w_{3})) \f$.
+ *  
+ *  The system has no unique solution if its determinant is zero 
+ *  relative to the product of the rows' lengths (i.e. up to rounding 
+ *  errors).
+ *  
+ *  \sa Facet and Facet<S>::computeLowerDistalPoint()
+ */
+template <class S> 
+Point 
+Facet<S>::computeLowerDistalPointInClosedForm() const
+{
+  assert(spaceDimension() == 2 or spaceDimension() == 3);
+
+  // fill in matrix W and vector b
+  double W[3][3];
+  double b[3];
+  double productOfRowLengths = 1.0;
+  for (unsigned int i = 0; i != spaceDimension(); ++i) {
+    // make sure the weightsUsed field of the current vertex is not empty
+    assert(vertices_[i].weightsUsed.size() == spaceDimension());
+
+    double squaredRowLength = 0.0;
+    b[i] = 0.0;
+    for (unsigned int j = 0; j != spaceDimension(); ++j) {
+      W[i][j] = vertices_[i].weightsUsed[j];
+      b[i] += W[i][j] * vertices_[i].point[j];
+      squaredRowLength += W[i][j] * W[i][j];
+    }
+    productOfRowLengths *= std::sqrt(squaredRowLength);
+  }
+
+  double determinant;
+  double x[3];
+  if (spaceDimension() == 2) {
+    determinant = W[0][0] * W[1][1] - W[0][1] * W[1][0];
+    x[0] = b[0] * W[1][1] - W[0][1] * b[1];
+    x[1] = W[0][0] * b[1] - b[0] * W[1][0];
+  }
+  else {
+    // the cofactors, i.e. the cross products of pairs of rows
+    double c[3][3];
+    for (unsigned int i = 0; i != 3; ++i) {
+      const double * u = W[(i + 1) % 3];
+      const double * v = W[(i + 2) % 3];
+      c[i][0] = u[1] * v[2] - u[2] * v[1];
+      c[i][1] = u[2] * v[0] - u[0] * v[2];
+      c[i][2] = u[0] * v[1] - u[1] * v[0];
+    }
+    determinant = W[0][0] * c[0][0] + W[0][1] * c[0][1] + W[0][2] * c[0][2];
+    for (unsigned int j = 0; j != 3; ++j)
+      x[j] = b[0] * c[0][j] + b[1] * c[1][j] + b[2] * c[2][j];
+  }
+
+  if (std::abs(determinant) <= 
+      std::numeric_limits<double>::epsilon() * productOfRowLengths)
+    // either no solution or an infinite number of solutions 
+    // - return a null Point instance 
+    return Point();
+  // else
+
+  // unique solution
+  // - return it as a Point instance
+  for (unsigned int j = 0; j != spaceDimension(); ++j)
+    x[j] /= determinant;
+  return Point(x, x + spaceDimension());
 }
 
 
@@ -942,6 +1259,24 @@ template <class S>
 void 
 Facet<S>::computeAndSetLocalApproximationErrorUpperBoundAndIsBoundaryFacet()
 {
+  // - In four or more dimensions a facet whose normal vector has 
+  //   negative elements does not face the Pareto set (only facets with 
+  //   non-negative normal vectors can support the lower envelope). Its 
+  //   LDP, if any, means nothing and is often huge, because its vertices' 
+  //   hyperplanes are (almost) parallel. It is a boundary facet.
+  // - In two and three dimensions such facets keep their LDP. PGEN 
+  //   refines them using their normal vectors with the negative elements 
+  //   set to zero as weights, which leads it to the Pareto points near 
+  //   the anchor points. (see utility::generateNewWeightVector())
+  if (spaceDimension() >= 4 and 
+      not hasAllNormalVectorElementsNonNegative()) {
+    isBoundaryFacet_ = true;
+    // localApproximationErrorUpperBound_ is not valid now:
+    localApproximationErrorUpperBound_ = -3.0;
+    return;
+  }
+  // else
+
   // - First find the facet's Lower Distal Point (LDP).
   Point lowerDistalPoint = computeLowerDistalPoint();
 
@@ -12,6 +12,7 @@
 
 #include "Point.h"
 #include "PointAndSolution.h"
+#include "PointBlock.h"
 #include "DifferentDimensionsException.h"
 #include "NullObjectException.h"
 #include "NotStrictlyPositivePointException.h"
@@ -212,6 +213,10 @@ class Facet
      *  do not intersect in a unique point. Check the documentation of Facet 
      *  for more info.)
      *  
+     *  In four or more dimensions facets whose normal vectors have 
+     *  negative elements are boundary facets too. (They do not face the 
+     *  Pareto set, so their Lower Distal Point, if any, tells us nothing.)
+     *  
      *  \sa Facet and Facet<S>::computeLowerDistalPoint()
      */
     bool isBoundaryFacet() const;
@@ -468,6 +473,45 @@ class Facet
      */
     double additiveDistance(const Point & p) const;
 
+    //! Compute many points' ratio distances from the facet's hyperplane.
+    /*!
+     *  \param points A block of strictly positive points.
+     *  \return The k'th element is ratioDistance(points.point(k)).
+     *  
+     *  Computes all the dot products with the facet's normal vector at 
+     *  once (PointBlock::dotProducts()). The points are not checked for 
+     *  positivity.
+     *  
+     *  Possible exceptions:
+     *  - May throw a DifferentDimensionsException exception if the block 
+     *    is not empty and its points and the hyperplane belong in spaces 
+     *    of different dimensions.
+     *  - May throw an InfiniteRatioDistanceException exception if some 
+     *    point is not on the hyperplane but its dot product with the 
+     *    facet's normal vector is 0.0. (see ratioDistance())
+     *
+     *  \sa ratioDistance(), PointBlock and Facet
+     */
+    std::vector<double> ratioDistances(const PointBlock & points) const;
+
+    //! Compute many points' additive distances from the facet's hyperplane.
+    /*!
+     *  \param points A block of positive points.
+     *  \return The k'th element is additiveDistance(points.point(k)).
+     *  
+     *  Computes all the dot products with the facet's normal vector at 
+     *  once (PointBlock::dotProducts()). The points are not checked for 
+     *  positivity.
+     *  
+     *  Possible exceptions:
+     *  - May throw a DifferentDimensionsException exception if the block 
+     *    is not empty and its points and the hyperplane belong in spaces 
+     *    of different dimensions.
+     *
+     *  \sa additiveDistance(), PointBlock and Facet
+     */
+    std::vector<double> additiveDistances(const PointBlock & points) const;
+
     //! Check if the Facet approximately dominates the given point.
     /*!
      *  \param p A Point instance. (must be positive if we are using the 
@@ -551,6 +595,60 @@ class Facet
      */
     bool dominatesMultiplicative(const Point & p, double eps=0.0) const;
 
+    //! distance() without the checks.
+    /*!
+     *  Same as distance(), only it does not check its argument and never 
+     *  throws: p must be non-null, positive and of the facet's dimension. 
+     *  (only assert()ed) Meant for Chord's and PGEN's internal loops, 
+     *  where that is already known.
+     *  
+     *  \sa distance() and additiveDistanceUnchecked()
+     */
+    double distanceUnchecked(const Point & p) const;
+
+    //! ratioDistance() without the checks.
+    /*!
+     *  \param p A Point instance. (stricty positive)
+     *  \return The point's ratio distance from the hyperplane on which the 
+     *          facet lies or \f$ +\infty \f$ if the point's coordinate 
+     *          vector is perpendicular to the facet's normal vector.
+     *  
+     *  Same as ratioDistance(), only it does not check its argument and 
+     *  never throws: p must be non-null, strictly positive and of the 
+     *  facet's dimension. (only assert()ed)
+     *  
+     *  \sa ratioDistance()
+     */
+    double ratioDistanceUnchecked(const Point & p) const;
+
+    //! additiveDistance() without the checks.
+    /*!
+     *  Same as additiveDistance(), only it does not check its argument and 
+     *  never throws: p must be non-null, positive and of the facet's 
+     *  dimension. (only assert()ed)
+     *  
+     *  \sa additiveDistance()
+     */
+    double additiveDistanceUnchecked(const Point & p) const;
+
+    //! dominates() without the checks. (see distanceUnchecked())
+    bool dominatesUnchecked(const Point & p, double eps=0.0) const;
+
+    //! dominatesAdditive() without the checks. (see distanceUnchecked())
+    bool dominatesAdditiveUnchecked(const Point & p, double eps=0.0) const;
+
+    //! dominatesMultiplicative() without the checks.
+    /*!
+     *  Same as dominatesMultiplicative(), only it does not check its 
+     *  arguments and never throws: p must be non-null, strictly positive 
+     *  and of the facet's dimension and eps must not be negative. (only 
+     *  assert()ed)
+     *  
+     *  \sa dominatesMultiplicative() and ratioDistanceUnchecked()
+     */
+    bool dominatesMultiplicativeUnchecked(const Point & p, 
+                                          double eps=0.0) const;
+
     //! Check if every element of the facet's normal vector is non-positive.
     /*!
      *  \return true if every element of the facet's normal vector 
@@ -631,6 +729,28 @@ class Facet
      */
     void computeAndSetFacetNormal(bool preferPositiveNormalVector);
 
+    /*!
+     *  \brief Compute (and set) the facet's normal vector using Armadillo. 
+     *         (any dimension)
+     *  
+     *  Used by Facet<S>::computeAndSetFacetNormal() for 4 or more 
+     *  dimensions. (2 and 3 dimensions are handled in closed form)
+     *  
+     *  \sa Facet
+     */
+    void computeAndSetFacetNormalWithArmadillo();
+
+    /*!
+     *  \brief Compute the facet's Lower Distal Point (LDP) in closed form. 
+     *         (2 or 3 dimensions only)
+     *  
+     *  Used by Facet<S>::computeLowerDistalPoint() for 2 and 3 dimensions. 
+     *  Uses Cramer's rule; no heap allocations.
+     *  
+     *  \sa Facet and Facet<S>::computeLowerDistalPoint()
+     */
+    Point computeLowerDistalPointInClosedForm() const;
+
     /*! \brief Compute (and set) the facet's isBoundaryFacet_ and 
      *         localApproximationErrorUpperBound_ attributes.
      *  
@@ -709,6 +829,10 @@ class Facet
      *  do not intersect in a unique point. Check the documentation of Facet 
      *  for more info.)
      *  
+     *  In four or more dimensions facets whose normal vectors have 
+     *  negative elements are boundary facets too. (They do not face the 
+     *  Pareto set, so their Lower Distal Point, if any, tells us nothing.)
+     *  
      *  \sa Facet and Facet<S>::computeLowerDistalPoint()
      */
     bool isBoundaryFacet_;
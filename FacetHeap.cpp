@@ -0,0 +1,340 @@
+/*! \file FacetHeap.cpp
+ *  \brief The implementation of the FacetHeap<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` FacetHeap.h. In fact FacetHeap.h will `include`
+ *  FacetHeap.cpp because it describes a class template (which doesn't
+ *  allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <algorithm>
+#include <utility>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Constructor. Makes an empty heap.
+template <class S>
+FacetHeap<S>::FacetHeap() { }
+
+
+//! Destructor. (empty)
+template <class S>
+FacetHeap<S>::~FacetHeap() { }
+
+
+//! Is the heap empty?
+template <class S>
+bool
+FacetHeap<S>::empty() const
+{
+  return facets_.empty();
+}
+
+
+//! The number of facets in the heap. (interior and boundary)
+template <class S>
+unsigned int
+FacetHeap<S>::size() const
+{
+  return facets_.size();
+}
+
+
+//! Is there a facet with the given id in the heap?
+template <class S>
+bool
+FacetHeap<S>::contains(unsigned int id) const
+{
+  return facets_.find(id) != facets_.end();
+}
+
+
+//! Get the facet with the given id.
+/*!
+ *  \param id The facet's id. (the facet must be in the heap)
+ *  \return A reference to the facet. (valid until the facet is erased)
+ */
+template <class S>
+const Facet<S> &
+FacetHeap<S>::get(unsigned int id) const
+{
+  assert(contains(id));
+
+  return facets_.find(id)->second;
+}
+
+
+//! Insert a facet.
+/*!
+ *  \param id The facet's id. (must not be in the heap already)
+ *  \param facet The facet.
+ *
+ *  O(log n) time.
+ */
+template <class S>
+void
+FacetHeap<S>::insert(unsigned int id, const Facet<S> & facet)
+{
+  assert(not contains(id));
+
+  facets_.insert(std::make_pair(id, facet));
+
+  if (facet.isBoundaryFacet()) {
+    boundaryFacets_.insert(id);
+    return;
+  }
+  // else
+
+  HeapEntry entry;
+  entry.bound = facet.getLocalApproximationErrorUpperBound();
+  entry.id = id;
+  heap_.push_back(entry);
+  heapPositions_[id] = heap_.size() - 1;
+  siftUp(heap_.size() - 1);
+}
+
+
+//! Erase the facet with the given id. (if there is one)
+/*!
+ *  \param id The facet's id.
+ *  \return true if there was a facet with the given id; false otherwise.
+ *
+ *  O(log n) time.
+ */
+template <class S>
+bool
+FacetHeap<S>::erase(unsigned int id)
+{
+  if (facets_.erase(id) == 0)
+    return false;
+  // else
+
+  if (boundaryFacets_.erase(id) != 0)
+    return true;
+  // else
+
+  // Move the last heap entry to the erased entry's place and fix the heap.
+  std::unordered_map<unsigned int, unsigned int>::iterator it;
+  it = heapPositions_.find(id);
+  assert(it != heapPositions_.end());
+  unsigned int position = it->second;
+  heapPositions_.erase(it);
+
+  HeapEntry last = heap_.back();
+  heap_.pop_back();
+  if (position != heap_.size()) {
+    place(last, position);
+    siftUp(position);
+    siftDown(heapPositions_[last.id]);
+  }
+
+  return true;
+}
+
+
+//! Are there any interior (i.e. non-boundary) facets?
+template <class S>
+bool
+FacetHeap<S>::hasInteriorFacets() const
+{
+  return not heap_.empty();
+}
+
+
+//! The id of the interior facet with the largest bound.
+/*!
+ *  \return The id of the interior facet with the largest local
+ *          approximation error upper bound. (the smallest such id if
+ *          there are several)
+ *
+ *  There must be at least one interior facet. O(1) time.
+ */
+template <class S>
+unsigned int
+FacetHeap<S>::topInteriorFacet() const
+{
+  assert(hasInteriorFacets());
+
+  return heap_.front().id;
+}
+
+
+//! The largest bound of the interior facets. (0.0 if there are none)
+/*!
+ *  \return The largest local approximation error upper bound of the
+ *          interior facets or 0.0 if there are none. O(1) time.
+ */
+template <class S>
+double
+FacetHeap<S>::largestLocalApproximationErrorUpperBound() const
+{
+  if (heap_.empty())
+    return 0.0;
+  // else
+  return heap_.front().bound;
+}
+
+
+//! The ids of the interior facets whose bound is larger than "bound".
+/*!
+ *  \param bound A local approximation error upper bound.
+ *  \return The ids of the interior facets whose local approximation
+ *          error upper bound is larger than "bound", in the order
+ *          topInteriorFacet() would return them. (i.e. largest bound
+ *          first)
+ *
+ *  Only visits the part of the heap above "bound", i.e. O(k log k) time
+ *  for k facets returned.
+ */
+template <class S>
+std::vector<unsigned int>
+FacetHeap<S>::interiorFacetsAbove(double bound) const
+{
+  std::vector<HeapEntry> entries;
+  std::vector<unsigned int> positionsToVisit;
+  if (not heap_.empty())
+    positionsToVisit.push_back(0);
+  while (not positionsToVisit.empty()) {
+    unsigned int position = positionsToVisit.back();
+    positionsToVisit.pop_back();
+    if (heap_[position].bound <= bound)
+      // neither this entry nor any entry below it is above "bound"
+      continue;
+    // else
+
+    entries.push_back(heap_[position]);
+    for (unsigned int child = 2 * position + 1;
+         child <= 2 * position + 2 and child < heap_.size(); ++child)
+      positionsToVisit.push_back(child);
+  }
+
+  std::sort(entries.begin(), entries.end(), comesBefore);
+  std::vector<unsigned int> ids;
+  ids.reserve(entries.size());
+  for (unsigned int i = 0; i != entries.size(); ++i)
+    ids.push_back(entries[i].id);
+
+  return ids;
+}
+
+
+//! Are there any boundary facets?
+template <class S>
+bool
+FacetHeap<S>::hasBoundaryFacets() const
+{
+  return not boundaryFacets_.empty();
+}
+
+
+//! The id of the first (smallest id) boundary facet.
+/*!
+ *  There must be at least one boundary facet. O(1) time.
+ */
+template <class S>
+unsigned int
+FacetHeap<S>::firstBoundaryFacet() const
+{
+  assert(hasBoundaryFacets());
+
+  return *boundaryFacets_.begin();
+}
+
+
+//! The ids of all the boundary facets. (in increasing order)
+template <class S>
+std::vector<unsigned int>
+FacetHeap<S>::boundaryFacets() const
+{
+  return std::vector<unsigned int>(boundaryFacets_.begin(),
+                                   boundaryFacets_.end());
+}
+
+
+//! Should heap entry "a" be closer to the top than heap entry "b"?
+/*!
+ *  \return true if "a" has a larger bound than "b" or the same bound and
+ *          a smaller id; false otherwise.
+ */
+template <class S>
+bool
+FacetHeap<S>::comesBefore(const HeapEntry & a, const HeapEntry & b)
+{
+  if (a.bound != b.bound)
+    return a.bound > b.bound;
+  // else
+  return a.id < b.id;
+}
+
+
+//! Move the entry at heap position "position" up, to its place.
+template <class S>
+void
+FacetHeap<S>::siftUp(unsigned int position)
+{
+  HeapEntry entry = heap_[position];
+  while (position != 0) {
+    unsigned int parent = (position - 1) / 2;
+    if (not comesBefore(entry, heap_[parent]))
+      break;
+    // else
+
+    place(heap_[parent], position);
+    position = parent;
+  }
+  place(entry, position);
+}
+
+
+//! Move the entry at heap position "position" down, to its place.
+template <class S>
+void
+FacetHeap<S>::siftDown(unsigned int position)
+{
+  HeapEntry entry = heap_[position];
+  while (true) {
+    unsigned int child = 2 * position + 1;
+    if (child >= heap_.size())
+      break;
+    // else
+
+    if (child + 1 < heap_.size() and comesBefore(heap_[child + 1],
+                                                 heap_[child]))
+      ++child;
+    if (not comesBefore(heap_[child], entry))
+      break;
+    // else
+
+    place(heap_[child], position);
+    position = child;
+  }
+  place(entry, position);
+}
+
+
+//! Put "entry" at heap position "position". (updating heapPositions_)
+template <class S>
+void
+FacetHeap<S>::place(const HeapEntry & entry, unsigned int position)
+{
+  heap_[position] = entry;
+  heapPositions_[entry.id] = position;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
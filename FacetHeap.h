@@ -0,0 +1,142 @@
+/*! \file FacetHeap.h
+ *  \brief The declaration of the FacetHeap<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_FACET_HEAP_H
+#define PARETO_APPROXIMATOR_FACET_HEAP_H
+
+
+#include <vector>
+#include <set>
+#include <unordered_map>
+
+#include "Facet.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! The facets PGEN has yet to try, ordered for quick selection.
+/*!
+ *  Each facet is identified by an id chosen by the user (PGEN uses the
+ *  ConvexHull facet ids).
+ *
+ *  Non-boundary (interior) facets are kept in an indexed binary max-heap,
+ *  ordered by their local approximation error upper bounds (ties are
+ *  broken in favour of the smaller id). Boundary facets, which have no
+ *  local approximation error upper bound, are kept in a separate queue,
+ *  ordered by id.
+ *
+ *  Inserting or erasing a facet takes O(log n) time, finding the
+ *  interior facet with the largest local approximation error upper bound
+ *  or the first boundary facet takes O(1) time.
+ *
+ *  \sa Facet, ConvexHull and BaseProblem::doPgen()
+ */
+template <class S>
+class FacetHeap
+{
+  public:
+    //! Constructor. Makes an empty heap.
+    FacetHeap();
+
+    //! Destructor. (empty)
+    ~FacetHeap();
+
+    //! Is the heap empty?
+    bool empty() const;
+
+    //! The number of facets in the heap. (interior and boundary)
+    unsigned int size() const;
+
+    //! Is there a facet with the given id in the heap?
+    bool contains(unsigned int id) const;
+
+    //! Get the facet with the given id.
+    const Facet<S> & get(unsigned int id) const;
+
+    //! Insert a facet.
+    void insert(unsigned int id, const Facet<S> & facet);
+
+    //! Erase the facet with the given id. (if there is one)
+    bool erase(unsigned int id);
+
+    //! Are there any interior (i.e. non-boundary) facets?
+    bool hasInteriorFacets() const;
+
+    //! The id of the interior facet with the largest bound.
+    unsigned int topInteriorFacet() const;
+
+    //! The largest bound of the interior facets. (0.0 if there are none)
+    double largestLocalApproximationErrorUpperBound() const;
+
+    //! The ids of the interior facets whose bound is larger than "bound".
+    std::vector<unsigned int> interiorFacetsAbove(double bound) const;
+
+    //! Are there any boundary facets?
+    bool hasBoundaryFacets() const;
+
+    //! The id of the first (smallest id) boundary facet.
+    unsigned int firstBoundaryFacet() const;
+
+    //! The ids of all the boundary facets. (in increasing order)
+    std::vector<unsigned int> boundaryFacets() const;
+
+  private:
+    //! An element of the heap.
+    struct HeapEntry
+    {
+      //! The facet's local approximation error upper bound.
+      double bound;
+      //! The facet's id.
+      unsigned int id;
+    };
+
+    //! Should heap entry "a" be closer to the top than heap entry "b"?
+    static bool comesBefore(const HeapEntry & a, const HeapEntry & b);
+
+    //! Move the entry at heap position "position" up, to its place.
+    void siftUp(unsigned int position);
+
+    //! Move the entry at heap position "position" down, to its place.
+    void siftDown(unsigned int position);
+
+    //! Put "entry" at heap position "position". (updating heapPositions_)
+    void place(const HeapEntry & entry, unsigned int position);
+
+    //! All the facets, by id.
+    std::unordered_map< unsigned int, Facet<S> > facets_;
+
+    //! The interior facets' max-heap.
+    std::vector<HeapEntry> heap_;
+
+    //! The position of each interior facet in heap_, by id.
+    std::unordered_map<unsigned int, unsigned int> heapPositions_;
+
+    //! The boundary facets' ids.
+    std::set<unsigned int> boundaryFacets_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "FacetHeap.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_FACET_HEAP_H
@@ -0,0 +1,253 @@
+/*! \file FixedPoint.cpp
+ *  \brief The implementation of the FixedPoint<N> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` FixedPoint.h. In fact FixedPoint.h will `include`
+ *  FixedPoint.cpp because it describes a class template (which doesn't
+ *  allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <vector>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Make the origin. (all coordinates 0.0)
+template <unsigned int N>
+FixedPoint<N>::FixedPoint()
+{
+  coordinates_.fill(0.0);
+}
+
+
+//! A 2-dimensional FixedPoint constructor. (N must be 2)
+template <unsigned int N>
+FixedPoint<N>::FixedPoint(double x, double y)
+{
+  static_assert(N == 2, "FixedPoint<N>(x, y) needs N == 2");
+
+  coordinates_[0] = x;
+  coordinates_[1] = y;
+}
+
+
+//! A 3-dimensional FixedPoint constructor. (N must be 3)
+template <unsigned int N>
+FixedPoint<N>::FixedPoint(double x, double y, double z)
+{
+  static_assert(N == 3, "FixedPoint<N>(x, y, z) needs N == 3");
+
+  coordinates_[0] = x;
+  coordinates_[1] = y;
+  coordinates_[2] = z;
+}
+
+
+//! A 4-dimensional FixedPoint constructor. (N must be 4)
+template <unsigned int N>
+FixedPoint<N>::FixedPoint(double x, double y, double z, double w)
+{
+  static_assert(N == 4, "FixedPoint<N>(x, y, z, w) needs N == 4");
+
+  coordinates_[0] = x;
+  coordinates_[1] = y;
+  coordinates_[2] = z;
+  coordinates_[3] = w;
+}
+
+
+//! Make a FixedPoint with the given coordinates.
+template <unsigned int N>
+FixedPoint<N>::FixedPoint(const std::array<double, N> & coordinates) :
+                                                coordinates_(coordinates) { }
+
+
+//! Make a FixedPoint with the same coordinates as a Point.
+/*!
+ *  \param p An N-dimensional Point instance.
+ *
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if p is null.
+ *  - May throw a DifferentDimensionsException exception if p is not
+ *    N-dimensional.
+ */
+template <unsigned int N>
+FixedPoint<N>::FixedPoint(const Point & p)
+{
+  if (p.isNull())
+    throw exception_classes::NullObjectException();
+  if (p.dimension() != N)
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  for (unsigned int i = 0; i != N; ++i)
+    coordinates_[i] = p[i];
+}
+
+
+//! The dimension of the space the point belongs to. (N)
+template <unsigned int N>
+unsigned int
+FixedPoint<N>::dimension()
+{
+  return N;
+}
+
+
+//! Get the i'th coordinate. (no bounds checking)
+template <unsigned int N>
+double
+FixedPoint<N>::operator[] (unsigned int i) const
+{
+  assert(i < N);
+
+  return coordinates_[i];
+}
+
+
+//! Get a reference to the i'th coordinate. (no bounds checking)
+template <unsigned int N>
+double &
+FixedPoint<N>::operator[] (unsigned int i)
+{
+  assert(i < N);
+
+  return coordinates_[i];
+}
+
+
+//! Get all the coordinates.
+template <unsigned int N>
+const std::array<double, N> &
+FixedPoint<N>::coordinates() const
+{
+  return coordinates_;
+}
+
+
+//! Are all the coordinates equal?
+template <unsigned int N>
+bool
+FixedPoint<N>::operator== (const FixedPoint & p) const
+{
+  return coordinates_ == p.coordinates_;
+}
+
+
+//! Is some coordinate different?
+template <unsigned int N>
+bool
+FixedPoint<N>::operator!= (const FixedPoint & p) const
+{
+  return coordinates_ != p.coordinates_;
+}
+
+
+//! Compare lexicographically. (like Point::operator<())
+template <unsigned int N>
+bool
+FixedPoint<N>::operator< (const FixedPoint & p) const
+{
+  return coordinates_ < p.coordinates_;
+}
+
+
+//! Add two points coordinate-wise.
+template <unsigned int N>
+FixedPoint<N>
+FixedPoint<N>::operator+ (const FixedPoint & p) const
+{
+  FixedPoint result(*this);
+  result += p;
+  return result;
+}
+
+
+//! Subtract two points coordinate-wise.
+template <unsigned int N>
+FixedPoint<N>
+FixedPoint<N>::operator- (const FixedPoint & p) const
+{
+  FixedPoint result(*this);
+  for (unsigned int i = 0; i != N; ++i)
+    result.coordinates_[i] -= p.coordinates_[i];
+  return result;
+}
+
+
+//! Add a point coordinate-wise to the current instance.
+template <unsigned int N>
+FixedPoint<N> &
+FixedPoint<N>::operator+= (const FixedPoint & p)
+{
+  for (unsigned int i = 0; i != N; ++i)
+    coordinates_[i] += p.coordinates_[i];
+  return *this;
+}
+
+
+//! Check if the current point (p) eps-dominates the given point (q).
+/*!
+ *  \param q A FixedPoint instance.
+ *  \param eps An additive approximation factor. (default 0.0)
+ *  \return true if \f$ p_{i} \le q_{i} + \epsilon \f$ for all i; false
+ *          otherwise.
+ *
+ *  Same as Point::dominates() (the additive variant), only it does not
+ *  check its arguments and checks all N coordinates (no early exits, so
+ *  the compiler can unroll the loop and drop the branches).
+ */
+template <unsigned int N>
+bool
+FixedPoint<N>::dominates(const FixedPoint & q, double eps) const
+{
+  bool result = true;
+  for (unsigned int i = 0; i != N; ++i)
+    result &= (coordinates_[i] <= q.coordinates_[i] + eps);
+  return result;
+}
+
+
+//! Make a Point with the same coordinates.
+template <unsigned int N>
+Point
+FixedPoint<N>::toPoint() const
+{
+  std::vector<double> coordinates(coordinates_.begin(), coordinates_.end());
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+//! Return a string representation of the point. (see Point::str())
+template <unsigned int N>
+std::string
+FixedPoint<N>::str(bool rawCoordinates) const
+{
+  return toPoint().str(rawCoordinates);
+}
+
+
+//! The FixedPoint output stream operator. (like Point's)
+template <unsigned int N>
+std::ostream &
+operator<< (std::ostream & out, const FixedPoint<N> & p)
+{
+  return out << p.str(true);
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,152 @@
+/*! \file FixedPoint.h
+ *  \brief The declaration of the FixedPoint<N> class template. (a point
+ *         whose dimension is known at compile time)
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_FIXED_POINT_H
+#define PARETO_APPROXIMATOR_FIXED_POINT_H
+
+
+#include <array>
+#include <string>
+#include <iostream>
+
+#include "Point.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A point in N-dimensional space, N known at compile time.
+/*!
+ *  A Point keeps its coordinates in a std::vector<double>, so every
+ *  Point constructor, operator+() and operator-() allocates memory.
+ *  FixedPoint<N> keeps its N coordinates in a std::array<double, N>
+ *  instead and never allocates. Use it on hot paths where the number
+ *  of objectives is fixed (e.g. 2, 3 or 4), like the label sets of a
+ *  multiobjective shortest path search; convert to and from Point
+ *  (toPoint() and FixedPoint(const Point &)) at the boundaries.
+ *
+ *  Unlike Point:
+ *  - There are no null FixedPoint instances. (the default constructor
+ *    makes the origin)
+ *  - The methods do not check their arguments (they cannot be null or
+ *    of a different dimension). dominates() does not check that the
+ *    points are positive either.
+ *
+ *  FixedPoint<N> has the operators and the dominates() method
+ *  NonDominatedSet needs, i.e. NonDominatedSet< FixedPoint<N> > works.
+ *
+ *  \sa Point and NonDominatedSet
+ */
+template <unsigned int N>
+class FixedPoint
+{
+  public:
+    //! Make the origin. (all coordinates 0.0)
+    FixedPoint();
+
+    //! A 2-dimensional FixedPoint constructor. (N must be 2)
+    FixedPoint(double x, double y);
+
+    //! A 3-dimensional FixedPoint constructor. (N must be 3)
+    FixedPoint(double x, double y, double z);
+
+    //! A 4-dimensional FixedPoint constructor. (N must be 4)
+    FixedPoint(double x, double y, double z, double w);
+
+    //! Make a FixedPoint with the given coordinates.
+    explicit FixedPoint(const std::array<double, N> & coordinates);
+
+    //! Make a FixedPoint with the same coordinates as a Point.
+    /*!
+     *  \param p An N-dimensional Point instance.
+     *
+     *  Possible exceptions:
+     *  - May throw a NullObjectException exception if p is null.
+     *  - May throw a DifferentDimensionsException exception if p is
+     *    not N-dimensional.
+     */
+    explicit FixedPoint(const Point & p);
+
+    //! The dimension of the space the point belongs to. (N)
+    static unsigned int dimension();
+
+    //! Get the i'th coordinate. (no bounds checking)
+    double operator[] (unsigned int i) const;
+
+    //! Get a reference to the i'th coordinate. (no bounds checking)
+    double & operator[] (unsigned int i);
+
+    //! Get all the coordinates.
+    const std::array<double, N> & coordinates() const;
+
+    //! Are all the coordinates equal?
+    bool operator== (const FixedPoint & p) const;
+
+    //! Is some coordinate different?
+    bool operator!= (const FixedPoint & p) const;
+
+    //! Compare lexicographically. (like Point::operator<())
+    bool operator< (const FixedPoint & p) const;
+
+    //! Add two points coordinate-wise.
+    FixedPoint operator+ (const FixedPoint & p) const;
+
+    //! Subtract two points coordinate-wise.
+    FixedPoint operator- (const FixedPoint & p) const;
+
+    //! Add a point coordinate-wise to the current instance.
+    FixedPoint & operator+= (const FixedPoint & p);
+
+    //! Check if the current point (p) eps-dominates the given point (q).
+    /*!
+     *  \param q A FixedPoint instance.
+     *  \param eps An additive approximation factor. (default 0.0)
+     *  \return true if \f$ p_{i} \le q_{i} + \epsilon \f$ for all i;
+     *          false otherwise.
+     *
+     *  Same as Point::dominates() (the additive variant), only it does
+     *  not check its arguments and has no early exits.
+     */
+    bool dominates(const FixedPoint & q, double eps=0.0) const;
+
+    //! Make a Point with the same coordinates.
+    Point toPoint() const;
+
+    //! Return a string representation of the point. (see Point::str())
+    std::string str(bool rawCoordinates=false) const;
+
+  private:
+    //! The point's coordinates.
+    std::array<double, N> coordinates_;
+};
+
+
+//! The FixedPoint output stream operator. (like Point's)
+template <unsigned int N>
+std::ostream & operator<< (std::ostream & out, const FixedPoint<N> & p);
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "FixedPoint.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_FIXED_POINT_H
@@ -0,0 +1,300 @@
+/*! \file FlatNonDominatedSet.cpp
+ *  \brief The implementation of the FlatNonDominatedSet<T> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` FlatNonDominatedSet.h. In fact FlatNonDominatedSet.h
+ *  will `include` FlatNonDominatedSet.cpp because it describes a class
+ *  template (which doesn't allow us to split declaration from
+ *  definition).
+ */
+
+
+#include <assert.h>
+#include <algorithm>
+
+#include "DifferentDimensionsException.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Default constructor. Makes an empty set.
+template <class T>
+FlatNonDominatedSet<T>::FlatNonDominatedSet() : dimension_(0),
+                                                isSorted_(true)
+{ }
+
+
+//! Iteration constructor. (see NonDominatedSet's)
+template <class T>
+template <class InputIterator>
+FlatNonDominatedSet<T>::FlatNonDominatedSet(InputIterator first,
+                                            InputIterator last) :
+                  dimension_(0), isSorted_(true)
+{
+  insert(first, last);
+}
+
+
+//! Destructor. (all the contained elements' destructors will be called)
+template <class T>
+FlatNonDominatedSet<T>::~FlatNonDominatedSet() { }
+
+
+//! Return iterator to beginning. (sorts the elements if needed)
+template <class T>
+typename FlatNonDominatedSet<T>::iterator
+FlatNonDominatedSet<T>::begin() const
+{
+  sort();
+  return elements_.begin();
+}
+
+
+//! Return iterator to end. (sorts the elements if needed)
+template <class T>
+typename FlatNonDominatedSet<T>::iterator
+FlatNonDominatedSet<T>::end() const
+{
+  sort();
+  return elements_.end();
+}
+
+
+//! Test whether container is empty.
+template <class T>
+bool
+FlatNonDominatedSet<T>::empty() const
+{
+  return elements_.empty();
+}
+
+
+//! Returns the number of elements in the container.
+template <class T>
+typename FlatNonDominatedSet<T>::size_type
+FlatNonDominatedSet<T>::size() const
+{
+  return elements_.size();
+}
+
+
+//! Insert element.
+/*!
+ *  \param t The T instance to insert.
+ *  \return true if the element was actually inserted (was not
+ *          dominated); false otherwise.
+ *
+ *  Goes through the elements from the last to the first, erasing the
+ *  ones t dominates, and stops if some element dominates t. (no element
+ *  can have been erased by then, since the elements do not dominate
+ *  each other)
+ *
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if t (or its point) is
+ *    null.
+ *  - May throw a DifferentDimensionsException exception if the set is
+ *    not empty and t's dimension is not its elements'.
+ *  - May throw whatever NonDominatedSetPoint<T>::checkQuery() throws.
+ *
+ *  \sa FlatNonDominatedSet
+ */
+template <class T>
+bool
+FlatNonDominatedSet<T>::insert(const T & t)
+{
+  checkQuery(t);
+  const auto & q = NonDominatedSetPoint<T>::point(t);
+  for (unsigned int k = elements_.size(); k != 0; --k) {
+    if (isLessOrEqual(k - 1, q))
+      return false;
+    // else
+    if (isGreaterOrEqual(k - 1, q))
+      erase(k - 1);
+  }
+
+  if (isSorted_ and not elements_.empty() and not (elements_.back() < t))
+    isSorted_ = false;
+  dimension_ = q.dimension();
+  elements_.push_back(t);
+
+  return true;
+}
+
+
+//! Insert elements. (see NonDominatedSet's)
+template <class T>
+template <class InputIterator>
+bool
+FlatNonDominatedSet<T>::insert(InputIterator first, InputIterator last)
+{
+  bool insertedAtLeastOneElement = false;
+  for ( ; first != last; ++first)
+    insertedAtLeastOneElement |= this->insert(*first);
+
+  return insertedAtLeastOneElement;
+}
+
+
+//! Check if some element in the set dominates the given instance.
+/*!
+ *  \param t A T instance.
+ *  \return true if some element in the set dominates t; false otherwise.
+ *
+ *  Throws like insert().
+ *
+ *  \sa FlatNonDominatedSet
+ */
+template <class T>
+bool
+FlatNonDominatedSet<T>::dominates(const T & t) const
+{
+  checkQuery(t);
+  const auto & q = NonDominatedSetPoint<T>::point(t);
+  for (unsigned int k = 0; k != elements_.size(); ++k)
+    if (isLessOrEqual(k, q))
+      return true;
+
+  return false;
+}
+
+
+//! Clear content.
+template <class T>
+void
+FlatNonDominatedSet<T>::clear()
+{
+  elements_.clear();
+  dimension_ = 0;
+  isSorted_ = true;
+}
+
+
+//! Get iterator to element. (sorts the elements if needed)
+/*!
+ *  \param t A T instance.
+ *  \return An iterator to the T element which is equal to t if one
+ *          exists; an iterator to the past-the-end element otherwise.
+ */
+template <class T>
+typename FlatNonDominatedSet<T>::iterator
+FlatNonDominatedSet<T>::find(const T & t) const
+{
+  sort();
+  iterator it = std::lower_bound(elements_.begin(), elements_.end(), t);
+  if (it != elements_.end() and *it == t)
+    return it;
+  // else
+
+  return elements_.end();
+}
+
+
+//! Check t against the set's dimension. (and NonDominatedSetPoint's checks)
+/*!
+ *  \param t A T instance.
+ *
+ *  Throws like insert().
+ */
+template <class T>
+void
+FlatNonDominatedSet<T>::checkQuery(const T & t) const
+{
+  const auto & p = NonDominatedSetPoint<T>::point(t);
+  if (dimension_ != 0 and p.dimension() != dimension_)
+    throw exception_classes::DifferentDimensionsException();
+  NonDominatedSetPoint<T>::checkQuery(t);
+}
+
+
+//! Does the k'th element weakly dominate q? (\f$ p_{i} \le q_{i} \f$)
+template <class T>
+template <class P>
+bool
+FlatNonDominatedSet<T>::isLessOrEqual(unsigned int k, const P & q) const
+{
+  const P & p = NonDominatedSetPoint<T>::point(elements_[k]);
+  for (unsigned int i = 0; i != dimension_; ++i)
+    if (coordinate(p, i) > coordinate(q, i))
+      return false;
+
+  return true;
+}
+
+
+//! Does q weakly dominate the k'th element? (\f$ q_{i} \le p_{i} \f$)
+template <class T>
+template <class P>
+bool
+FlatNonDominatedSet<T>::isGreaterOrEqual(unsigned int k, const P & q) const
+{
+  const P & p = NonDominatedSetPoint<T>::point(elements_[k]);
+  for (unsigned int i = 0; i != dimension_; ++i)
+    if (coordinate(q, i) > coordinate(p, i))
+      return false;
+
+  return true;
+}
+
+
+//! A Point's i'th coordinate. (no bounds checking)
+template <class T>
+double
+FlatNonDominatedSet<T>::coordinate(const Point & p, unsigned int i)
+{
+  return p.coordinateUnchecked(i);
+}
+
+
+//! A FixedPoint<N>'s i'th coordinate. (no bounds checking)
+template <class T>
+template <unsigned int N>
+double
+FlatNonDominatedSet<T>::coordinate(const FixedPoint<N> & p, unsigned int i)
+{
+  return p[i];
+}
+
+
+//! Erase the k'th element. (the last element takes its place)
+template <class T>
+void
+FlatNonDominatedSet<T>::erase(unsigned int k)
+{
+  assert(k < elements_.size());
+
+  const unsigned int last = elements_.size() - 1;
+  if (k != last) {
+    elements_[k] = elements_[last];
+    isSorted_ = false;
+  }
+  elements_.pop_back();
+}
+
+
+//! Sort the elements if they are not sorted.
+template <class T>
+void
+FlatNonDominatedSet<T>::sort() const
+{
+  if (isSorted_)
+    return;
+  // else
+
+  std::sort(elements_.begin(), elements_.end());
+  isSorted_ = true;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
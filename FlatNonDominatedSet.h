@@ -0,0 +1,176 @@
+/*! \file FlatNonDominatedSet.h
+ *  \brief The definition of the FlatNonDominatedSet<T> class template. (a
+ *         NonDominatedSet kept in contiguous arrays)
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef FLAT_NON_DOMINATED_SET_H
+#define FLAT_NON_DOMINATED_SET_H
+
+#include <vector>
+
+#include "Point.h"
+#include "FixedPoint.h"
+#include "NonDominatedSet.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A container that only keeps non-dominated points, in contiguous arrays.
+/*!
+ *  FlatNonDominatedSet<T> has the same interface (and keeps the same
+ *  elements) as NonDominatedSet<T>, so the two can be swapped. T must be
+ *  Point, FixedPoint<N> or PointAndSolution<S>. (see NonDominatedSetPoint)
+ *
+ *  NonDominatedSet<T> keeps its elements in the nodes of a std::set, so 
+ *  comparing a new point against every element chases pointers all over 
+ *  the heap. FlatNonDominatedSet<T> keeps its elements in one 
+ *  std::vector instead:
+ *  - insert() and dominates() scan that vector, i.e. (for FixedPoint<N> 
+ *    elements, which keep their coordinates inline) one contiguous array 
+ *    of coordinates,
+ *  - an element is erased by moving the last element into its place,
+ *  - the elements are sorted (with T::operator<()) only when someone
+ *    asks for them, i.e. when begin(), end() or find() is called.
+ *
+ *  Useful for many small sets, e.g. the labels of every vertex in a
+ *  label-correcting search, where a std::set node (plus its allocation)
+ *  takes more memory than the point it holds.
+ *
+ *  Note that begin(), end() and find() may reorder the elements, so
+ *  every iterator is invalidated by insert(), clear() and the first
+ *  begin(), end() or find() call after an insert().
+ *
+ *  \sa NonDominatedSet and NonDominatedSetPoint
+ */
+template <class T>
+class FlatNonDominatedSet
+{
+  public:
+    //! Random access iterator to the set's contents.
+    typedef typename std::vector<T>::const_iterator iterator;
+
+    //! Constant random access iterator to the set's contents.
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    //! Unsigned integral type (usually same as size_t).
+    typedef typename std::vector<T>::size_type size_type;
+
+    //! Default constructor. Makes an empty set.
+    FlatNonDominatedSet();
+
+    //! Iteration constructor. (see NonDominatedSet's)
+    template <class InputIterator>
+    FlatNonDominatedSet(InputIterator first, InputIterator last);
+
+    //! Destructor. (all the contained elements' destructors will be called)
+    ~FlatNonDominatedSet();
+
+    //! Return iterator to beginning. (sorts the elements if needed)
+    iterator begin() const;
+
+    //! Return iterator to end. (sorts the elements if needed)
+    iterator end() const;
+
+    //! Test whether container is empty.
+    bool empty() const;
+
+    //! Returns the number of elements in the container.
+    size_type size() const;
+
+    //! Insert element.
+    /*!
+     *  \param t The T instance to insert.
+     *  \return true if the element was actually inserted (was not
+     *          dominated); false otherwise.
+     *
+     *  Same as NonDominatedSet::insert().
+     *
+     *  \sa FlatNonDominatedSet
+     */
+    bool insert(const T & t);
+
+    //! Insert elements. (see NonDominatedSet's)
+    template <class InputIterator>
+    bool insert(InputIterator first, InputIterator last);
+
+    //! Check if some element in the set dominates the given instance.
+    /*!
+     *  \param t A T instance.
+     *  \return true if some element in the set dominates t; false otherwise.
+     *
+     *  Same as NonDominatedSet::dominates().
+     *
+     *  \sa FlatNonDominatedSet
+     */
+    bool dominates(const T & t) const;
+
+    //! Clear content.
+    void clear();
+
+    //! Get iterator to element. (sorts the elements if needed)
+    /*!
+     *  \param t A T instance.
+     *  \return An iterator to the T element which is equal to t if one
+     *          exists; an iterator to the past-the-end element otherwise.
+     */
+    iterator find(const T & t) const;
+
+  private:
+    //! Check t against the set's dimension. (and NonDominatedSetPoint's checks)
+    void checkQuery(const T & t) const;
+
+    //! Does the k'th element weakly dominate q? (\f$ p_{i} \le q_{i} \f$)
+    template <class P>
+    bool isLessOrEqual(unsigned int k, const P & q) const;
+
+    //! Does q weakly dominate the k'th element? (\f$ q_{i} \le p_{i} \f$)
+    template <class P>
+    bool isGreaterOrEqual(unsigned int k, const P & q) const;
+
+    //! A Point's i'th coordinate. (no bounds checking)
+    static double coordinate(const Point & p, unsigned int i);
+
+    //! A FixedPoint<N>'s i'th coordinate. (no bounds checking)
+    template <unsigned int N>
+    static double coordinate(const FixedPoint<N> & p, unsigned int i);
+
+    //! Erase the k'th element. (the last element takes its place)
+    void erase(unsigned int k);
+
+    //! Sort the elements if they are not sorted.
+    void sort() const;
+
+    //! The elements. (sorted only if isSorted_)
+    mutable std::vector<T> elements_;
+
+    //! The elements' dimension. (0 if the set is empty)
+    unsigned int dimension_;
+
+    //! Are elements_ sorted?
+    mutable bool isSorted_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "FlatNonDominatedSet.cpp"
+
+
+#endif  // FLAT_NON_DOMINATED_SET_H
@@ -0,0 +1,672 @@
+/*! \file HullVertices.cpp
+ *  \brief The implementation of findConvexHullVertices() and
+ *         findLowerConvexEnvelopeVertices().
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` HullVertices.h. In fact, HullVertices.h will `include`
+ *  HullVertices.cpp because we want a header-only code base. (that is
+ *  also why every function is declared inline)
+ */
+
+
+#include <assert.h>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <unordered_map>
+
+#include "ThreadPool.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+// An unnamed namespace containing the hull helpers.
+namespace {
+
+
+//! The parallel hull gives every thread at least this many points.
+const unsigned int minHullPointsPerThread = 4096;
+
+
+//! Points closer than this to a hyperplane count as on it.
+/*!
+ *  Relative to the largest absolute coordinate of the given points, like
+ *  ConvexHull::tolerance().
+ */
+inline
+double
+hullTolerance(const std::vector<double> & coordinates,
+              unsigned int dimension,
+              const std::vector<unsigned int> & points)
+{
+  double scale = 0.0;
+  for (unsigned int k = 0; k != points.size(); ++k)
+    for (unsigned int i = 0; i != dimension; ++i)
+      scale = std::max(scale,
+                       std::fabs(coordinates[points[k] * dimension + i]));
+
+  return 1e-10 * (scale > 0.0 ? scale : 1.0);
+}
+
+
+//! Is point p lexicographically less than point q?
+inline
+bool
+isLexicographicallyLess(const std::vector<double> & coordinates,
+                        unsigned int dimension, unsigned int p, unsigned int q)
+{
+  return std::lexicographical_compare(
+              coordinates.begin() + p * dimension,
+              coordinates.begin() + (p + 1) * dimension,
+              coordinates.begin() + q * dimension,
+              coordinates.begin() + (q + 1) * dimension);
+}
+
+
+//! The vertices of the convex hull of some points in the plane.
+/*!
+ *  \param coordinates The points' coordinates. (see findConvexHullVertices())
+ *  \param points The indices of the points to use. (increasing)
+ *  \param vertices Will contain the (increasing) indices of the hull's
+ *                  vertices.
+ *  \return false if the points are collinear (vertices is left empty);
+ *          true otherwise.
+ *
+ *  Andrew's monotone chain algorithm: sorts the points lexicographically,
+ *  then builds the lower hull left-to-right and the upper hull
+ *  right-to-left, popping every point where the chain does not turn
+ *  counter-clockwise.
+ */
+inline
+bool
+monotoneChain(const std::vector<double> & coordinates,
+              std::vector<unsigned int> points,
+              std::vector<unsigned int> & vertices)
+{
+  vertices.clear();
+  const double tolerance = hullTolerance(coordinates, 2, points);
+
+  // (std::unique keeps the first of several equal points, and the sort
+  // is stable, so that is the one with the smallest index)
+  std::stable_sort(points.begin(), points.end(),
+                   [&coordinates](unsigned int p, unsigned int q)
+                   { return isLexicographicallyLess(coordinates, 2, p, q); });
+  points.erase(std::unique(points.begin(), points.end(),
+                           [&coordinates](unsigned int p, unsigned int q)
+                           {
+                             return coordinates[2 * p] == coordinates[2 * q] and
+                                    coordinates[2 * p + 1] ==
+                                    coordinates[2 * q + 1];
+                           }),
+               points.end());
+  if (points.size() < 3)
+    return false;
+  // else
+
+  // Does o -> a -> b turn counter-clockwise? (a is farther than tolerance
+  // from the line through o and b, on its left)
+  auto isLeftTurn = [&coordinates, tolerance](unsigned int o, unsigned int a,
+                                              unsigned int b)
+  {
+    double ax = coordinates[2 * a] - coordinates[2 * o];
+    double ay = coordinates[2 * a + 1] - coordinates[2 * o + 1];
+    double bx = coordinates[2 * b] - coordinates[2 * o];
+    double by = coordinates[2 * b + 1] - coordinates[2 * o + 1];
+    return bx * ay - by * ax < - tolerance * std::sqrt(bx * bx + by * by);
+  };
+
+  std::vector<unsigned int> hull(2 * points.size());
+  unsigned int k = 0;
+  for (unsigned int j = 0; j != points.size(); ++j) {
+    while (k >= 2 and not isLeftTurn(hull[k - 2], hull[k - 1], points[j]))
+      --k;
+    hull[k++] = points[j];
+  }
+  for (unsigned int j = points.size() - 1, lowerSize = k + 1; j != 0; --j) {
+    while (k >= lowerSize and
+           not isLeftTurn(hull[k - 2], hull[k - 1], points[j - 1]))
+      --k;
+    hull[k++] = points[j - 1];
+  }
+  // (the last point is the first one again)
+  hull.resize(k - 1);
+  if (hull.size() < 3)
+    return false;
+  // else
+
+  vertices.swap(hull);
+  std::sort(vertices.begin(), vertices.end());
+  return true;
+}
+
+
+//! Computes the convex hull of some points in space. (Quickhull)
+/*!
+ *  Points are referred to by their index. Every facet is a triangle whose
+ *  vertices are in counter-clockwise order when seen from outside the
+ *  hull, so that each directed edge belongs to exactly one facet and the
+ *  facet across edge (a, b) is the one that owns edge (b, a).
+ *
+ *  Starts from a tetrahedron and repeatedly takes a facet with points
+ *  outside it, finds its farthest outside point (the eye), replaces the
+ *  facets the eye can see with a cone of facets from their horizon to
+ *  the eye and hands the visible facets' outside points to the new
+ *  facets. Facets are taken in the order they were made, so the result
+ *  only depends on the points.
+ */
+class QuickHull
+{
+  public:
+    //! Make a hull computer for the given points. (3 coordinates each)
+    explicit QuickHull(const std::vector<double> & coordinates) :
+                          coordinates_(coordinates), tolerance_(0.0) { }
+
+    //! Compute the hull's vertices. (see monotoneChain())
+    bool run(const std::vector<unsigned int> & points,
+             std::vector<unsigned int> & vertices);
+
+  private:
+    //! A triangular facet and the points outside it.
+    struct Face
+    {
+      //! The vertices. (counter-clockwise, seen from outside)
+      unsigned int vertices[3];
+      //! The outward unit normal vector.
+      double normal[3];
+      //! The normal vector times (any of) the vertices.
+      double offset;
+      //! The (increasing) indices of the points assigned to this facet.
+      std::vector<unsigned int> outside;
+      //! Is the facet still on the hull?
+      bool isAlive;
+      //! Can the current eye see the facet?
+      bool isVisible;
+    };
+
+    //! The i'th coordinate of point p.
+    double x(unsigned int p, unsigned int i) const
+    {
+      return coordinates_[3 * p + i];
+    }
+
+    //! The signed distance of point p from the face's plane.
+    double distance(const Face & face, unsigned int p) const
+    {
+      return face.normal[0] * x(p, 0) + face.normal[1] * x(p, 1) +
+             face.normal[2] * x(p, 2) - face.offset;
+    }
+
+    //! The key of the directed edge (a, b).
+    static unsigned long long edge(unsigned int a, unsigned int b)
+    {
+      return (static_cast<unsigned long long>(a) << 32) | b;
+    }
+
+    //! Find four points that span space. (false if there are none)
+    bool findSimplex(const std::vector<unsigned int> & points,
+                     unsigned int simplex[4]) const;
+
+    //! Make facet (a, b, c).
+    void addFace(unsigned int a, unsigned int b, unsigned int c);
+
+    //! Give each point to the first facet (from firstFace on) it is outside.
+    void assign(const std::vector<unsigned int> & points,
+                unsigned int firstFace);
+
+    //! Add the farthest point outside facet f to the hull.
+    void addEye(unsigned int f);
+
+    //! The points' coordinates.
+    const std::vector<double> & coordinates_;
+
+    //! Points closer than this to a facet's plane are not outside it.
+    double tolerance_;
+
+    //! All the facets ever made. (dead ones included)
+    std::vector<Face> faces_;
+
+    //! The facet that owns each directed edge. (live facets only)
+    std::unordered_map<unsigned long long, unsigned int> edgeFaces_;
+};
+
+
+//! Compute the hull's vertices. (see monotoneChain())
+/*!
+ *  \param points The indices of the points to use. (increasing)
+ *  \param vertices Will contain the (increasing) indices of the hull's
+ *                  vertices.
+ *  \return false if the points are coplanar (vertices is left empty);
+ *          true otherwise.
+ */
+inline
+bool
+QuickHull::run(const std::vector<unsigned int> & points,
+               std::vector<unsigned int> & vertices)
+{
+  vertices.clear();
+  faces_.clear();
+  edgeFaces_.clear();
+  tolerance_ = hullTolerance(coordinates_, 3, points);
+
+  unsigned int simplex[4];
+  if (not findSimplex(points, simplex))
+    return false;
+  // else
+
+  unsigned int a = simplex[0], b = simplex[1], c = simplex[2], d = simplex[3];
+  addFace(a, b, c);
+  addFace(b, a, d);
+  addFace(c, b, d);
+  addFace(a, c, d);
+
+  std::vector<unsigned int> rest;
+  rest.reserve(points.size());
+  for (unsigned int k = 0; k != points.size(); ++k)
+    if (std::find(simplex, simplex + 4, points[k]) == simplex + 4)
+      rest.push_back(points[k]);
+  assign(rest, 0);
+
+  // (addEye() appends the new facets, so this goes through them too)
+  for (unsigned int f = 0; f != faces_.size(); ++f)
+    if (faces_[f].isAlive and not faces_[f].outside.empty())
+      addEye(f);
+
+  for (unsigned int f = 0; f != faces_.size(); ++f)
+    if (faces_[f].isAlive)
+      vertices.insert(vertices.end(), faces_[f].vertices,
+                      faces_[f].vertices + 3);
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                 vertices.end());
+
+  return true;
+}
+
+
+//! Find four points that span space. (false if there are none)
+/*!
+ *  Takes the lexicographically smallest point, the point farthest from
+ *  it, the point farthest from the line through those two and the point
+ *  farthest from the plane through those three (the first one of several
+ *  equally far points), ordered so that the fourth point is below
+ *  (inside) facet (simplex[0], simplex[1], simplex[2]).
+ */
+inline
+bool
+QuickHull::findSimplex(const std::vector<unsigned int> & points,
+                       unsigned int simplex[4]) const
+{
+  if (points.size() < 4)
+    return false;
+  // else
+
+  unsigned int a = points[0];
+  for (unsigned int k = 1; k != points.size(); ++k)
+    if (isLexicographicallyLess(coordinates_, 3, points[k], a))
+      a = points[k];
+
+  unsigned int b = a;
+  double best = 0.0;
+  for (unsigned int k = 0; k != points.size(); ++k) {
+    double d = 0.0;
+    for (unsigned int i = 0; i != 3; ++i)
+      d += (x(points[k], i) - x(a, i)) * (x(points[k], i) - x(a, i));
+    if (d > best) {
+      best = d;
+      b = points[k];
+    }
+  }
+  if (std::sqrt(best) <= tolerance_)
+    return false;
+  // else
+
+  double u[3], v[3], n[3];
+  for (unsigned int i = 0; i != 3; ++i)
+    u[i] = x(b, i) - x(a, i);
+  const double uLength = std::sqrt(best);
+  unsigned int c = a;
+  best = 0.0;
+  for (unsigned int k = 0; k != points.size(); ++k) {
+    for (unsigned int i = 0; i != 3; ++i)
+      v[i] = x(points[k], i) - x(a, i);
+    n[0] = u[1] * v[2] - u[2] * v[1];
+    n[1] = u[2] * v[0] - u[0] * v[2];
+    n[2] = u[0] * v[1] - u[1] * v[0];
+    double d = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) / uLength;
+    if (d > best) {
+      best = d;
+      c = points[k];
+    }
+  }
+  if (best <= tolerance_)
+    return false;
+  // else
+
+  for (unsigned int i = 0; i != 3; ++i)
+    v[i] = x(c, i) - x(a, i);
+  n[0] = u[1] * v[2] - u[2] * v[1];
+  n[1] = u[2] * v[0] - u[0] * v[2];
+  n[2] = u[0] * v[1] - u[1] * v[0];
+  const double nLength = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+  unsigned int d = a;
+  double dDistance = 0.0;
+  best = 0.0;
+  for (unsigned int k = 0; k != points.size(); ++k) {
+    double distance = 0.0;
+    for (unsigned int i = 0; i != 3; ++i)
+      distance += n[i] * (x(points[k], i) - x(a, i));
+    distance /= nLength;
+    if (std::fabs(distance) > best) {
+      best = std::fabs(distance);
+      dDistance = distance;
+      d = points[k];
+    }
+  }
+  if (best <= tolerance_)
+    return false;
+  // else
+
+  // n is facet (a, b, c)'s normal vector; it must face away from d
+  if (dDistance > 0.0)
+    std::swap(b, c);
+  simplex[0] = a;
+  simplex[1] = b;
+  simplex[2] = c;
+  simplex[3] = d;
+
+  return true;
+}
+
+
+//! Make facet (a, b, c).
+inline
+void
+QuickHull::addFace(unsigned int a, unsigned int b, unsigned int c)
+{
+  Face face;
+  face.vertices[0] = a;
+  face.vertices[1] = b;
+  face.vertices[2] = c;
+  double u[3], v[3];
+  for (unsigned int i = 0; i != 3; ++i) {
+    u[i] = x(b, i) - x(a, i);
+    v[i] = x(c, i) - x(a, i);
+  }
+  face.normal[0] = u[1] * v[2] - u[2] * v[1];
+  face.normal[1] = u[2] * v[0] - u[0] * v[2];
+  face.normal[2] = u[0] * v[1] - u[1] * v[0];
+  double length = std::sqrt(face.normal[0] * face.normal[0] +
+                            face.normal[1] * face.normal[1] +
+                            face.normal[2] * face.normal[2]);
+  face.offset = 0.0;
+  for (unsigned int i = 0; i != 3; ++i) {
+    if (length > 0.0)
+      face.normal[i] /= length;
+    face.offset += face.normal[i] * x(a, i);
+  }
+  face.isAlive = true;
+  face.isVisible = false;
+
+  unsigned int f = faces_.size();
+  edgeFaces_[edge(a, b)] = f;
+  edgeFaces_[edge(b, c)] = f;
+  edgeFaces_[edge(c, a)] = f;
+  faces_.push_back(face);
+}
+
+
+//! Give each point to the first facet (from firstFace on) it is outside.
+/*!
+ *  Points that are not outside any of those facets are inside the hull
+ *  and are dropped.
+ */
+inline
+void
+QuickHull::assign(const std::vector<unsigned int> & points,
+                  unsigned int firstFace)
+{
+  for (unsigned int k = 0; k != points.size(); ++k)
+    for (unsigned int f = firstFace; f != faces_.size(); ++f)
+      if (faces_[f].isAlive and distance(faces_[f], points[k]) > tolerance_) {
+        faces_[f].outside.push_back(points[k]);
+        break;
+      }
+}
+
+
+//! Add the farthest point outside facet f to the hull.
+inline
+void
+QuickHull::addEye(unsigned int f)
+{
+  const std::vector<unsigned int> & outside = faces_[f].outside;
+  unsigned int eye = outside[0];
+  double best = distance(faces_[f], eye);
+  for (unsigned int k = 1; k != outside.size(); ++k) {
+    double d = distance(faces_[f], outside[k]);
+    if (d > best) {
+      best = d;
+      eye = outside[k];
+    }
+  }
+
+  // the facets the eye sees form a connected region around f; its
+  // boundary (the horizon) consists of the edges of visible facets whose
+  // facet across is not visible
+  std::vector<unsigned int> visible(1, f);
+  std::vector< std::pair<unsigned int, unsigned int> > horizon;
+  faces_[f].isVisible = true;
+  for (unsigned int k = 0; k != visible.size(); ++k)
+    for (unsigned int e = 0; e != 3; ++e) {
+      unsigned int a = faces_[visible[k]].vertices[e];
+      unsigned int b = faces_[visible[k]].vertices[(e + 1) % 3];
+      std::unordered_map<unsigned long long, unsigned int>::const_iterator
+            across = edgeFaces_.find(edge(b, a));
+      assert(across != edgeFaces_.end());
+      Face & face = faces_[across->second];
+      if (face.isVisible)
+        continue;
+      // else
+      if (distance(face, eye) > tolerance_) {
+        face.isVisible = true;
+        visible.push_back(across->second);
+      }
+      else
+        horizon.push_back(std::make_pair(a, b));
+    }
+
+  std::vector<unsigned int> orphans;
+  for (unsigned int k = 0; k != visible.size(); ++k) {
+    Face & face = faces_[visible[k]];
+    for (unsigned int j = 0; j != face.outside.size(); ++j)
+      if (face.outside[j] != eye)
+        orphans.push_back(face.outside[j]);
+    std::vector<unsigned int>().swap(face.outside);
+    face.isAlive = false;
+    for (unsigned int e = 0; e != 3; ++e)
+      edgeFaces_.erase(edge(face.vertices[e], face.vertices[(e + 1) % 3]));
+  }
+
+  unsigned int firstNewFace = faces_.size();
+  for (unsigned int k = 0; k != horizon.size(); ++k)
+    addFace(horizon[k].first, horizon[k].second, eye);
+  // (keep the outside sets increasing, so that the first of several
+  // equally far points is the one with the smallest index)
+  std::sort(orphans.begin(), orphans.end());
+  assign(orphans, firstNewFace);
+}
+
+
+//! The vertices of the convex hull of some points. (2 or 3 dimensions)
+/*!
+ *  \sa monotoneChain() and QuickHull
+ */
+inline
+bool
+findHullVertices(const std::vector<double> & coordinates,
+                 unsigned int dimension,
+                 const std::vector<unsigned int> & points,
+                 std::vector<unsigned int> & vertices)
+{
+  if (dimension == 2)
+    return monotoneChain(coordinates, points, vertices);
+  // else
+
+  QuickHull hull(coordinates);
+  return hull.run(points, vertices);
+}
+
+
+}  // namespace
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Find the vertices (extreme points) of the convex hull of the given points.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *  \param dimension The points' dimension. (2 or 3)
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  \return The (increasing) indices of the points that are vertices of
+ *          the convex hull. (all the indices if the points do not span
+ *          the space)
+ *
+ *  \sa HullVertices.h
+ */
+inline
+std::vector<unsigned int>
+findConvexHullVertices(const std::vector<double> & coordinates,
+                       unsigned int dimension, unsigned int numThreads)
+{
+  assert(dimension == 2 or dimension == 3);
+  assert(coordinates.size() % dimension == 0);
+  assert(numThreads >= 1);
+
+  const unsigned int numPoints = coordinates.size() / dimension;
+  std::vector<unsigned int> points(numPoints);
+  for (unsigned int p = 0; p != numPoints; ++p)
+    points[p] = p;
+
+  // every vertex of the hull is a vertex of its part's hull, so the
+  // parts' hull vertices have the same hull as all the points
+  const unsigned int numParts = std::min(numThreads,
+                                         numPoints / minHullPointsPerThread);
+  if (numParts > 1) {
+    std::vector< std::vector<unsigned int> > parts(numParts);
+    for (unsigned int j = 0; j != numParts; ++j) {
+      unsigned int begin = static_cast<unsigned long>(numPoints) * j / numParts;
+      unsigned int end = static_cast<unsigned long>(numPoints) * (j + 1) /
+                         numParts;
+      parts[j].assign(points.begin() + begin, points.begin() + end);
+    }
+
+    ThreadPool pool(numParts);
+    std::vector<ThreadPool::Task> tasks;
+    for (unsigned int j = 0; j != numParts; ++j)
+      tasks.push_back([&coordinates, dimension, &parts, j]()
+                      {
+                        std::vector<unsigned int> vertices;
+                        // (keep a flat part whole)
+                        if (findHullVertices(coordinates, dimension,
+                                             parts[j], vertices))
+                          parts[j].swap(vertices);
+                      });
+    pool.run(tasks);
+
+    // (the parts are contiguous, so the indices stay increasing)
+    points.clear();
+    for (unsigned int j = 0; j != numParts; ++j)
+      points.insert(points.end(), parts[j].begin(), parts[j].end());
+  }
+
+  std::vector<unsigned int> vertices;
+  if (findHullVertices(coordinates, dimension, points, vertices))
+    return vertices;
+  // else
+
+  for (unsigned int p = 0; p != numPoints; ++p)
+    vertices.push_back(p);
+  return vertices;
+}
+
+
+//! Find the vertices of the lower convex envelope of the given points.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *  \param dimension The points' dimension. (2 or 3)
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  \return The (increasing) indices of the points that are vertices of
+ *          the lower convex envelope.
+ *
+ *  The lower convex envelope's vertices are the vertices of the convex
+ *  hull of the points plus the non-negative orthant. Finds the hull's
+ *  vertices H and then the vertices of the hull of H and the points
+ *  \f$ h + M e_{i} \f$ for every h in H and every objective i, where M
+ *  is large enough for the extra points to hide only points that are
+ *  not vertices of the lower convex envelope. (any point above the
+ *  envelope is within the points' extent of the envelope, in every
+ *  coordinate)
+ *
+ *  \sa HullVertices.h
+ */
+inline
+std::vector<unsigned int>
+findLowerConvexEnvelopeVertices(const std::vector<double> & coordinates,
+                                unsigned int dimension,
+                                unsigned int numThreads)
+{
+  std::vector<unsigned int> hull = findConvexHullVertices(coordinates,
+                                                          dimension,
+                                                          numThreads);
+  if (hull.empty())
+    return hull;
+  // else
+
+  double extent = 0.0;
+  for (unsigned int i = 0; i != dimension; ++i) {
+    double min = coordinates[hull[0] * dimension + i];
+    double max = min;
+    for (unsigned int k = 1; k != hull.size(); ++k) {
+      min = std::min(min, coordinates[hull[k] * dimension + i]);
+      max = std::max(max, coordinates[hull[k] * dimension + i]);
+    }
+    extent = std::max(extent, max - min);
+  }
+  if (extent == 0.0)
+    // all the points are equal
+    return std::vector<unsigned int>(1, hull[0]);
+  // else
+
+  const double M = 2.0 * dimension * extent;
+
+  // hull[k] is point k; hull[k] + M e_i is point (i + 1) * H + k
+  const unsigned int H = hull.size();
+  std::vector<double> lifted((dimension + 1) * H * dimension);
+  for (unsigned int j = 0; j != dimension + 1; ++j)
+    for (unsigned int k = 0; k != H; ++k)
+      for (unsigned int i = 0; i != dimension; ++i)
+        lifted[(j * H + k) * dimension + i] =
+              coordinates[hull[k] * dimension + i] + (j == i + 1 ? M : 0.0);
+
+  std::vector<unsigned int> vertices = findConvexHullVertices(lifted,
+                                                              dimension,
+                                                              numThreads);
+  std::vector<unsigned int> envelope;
+  for (unsigned int k = 0; k != vertices.size() and vertices[k] < H; ++k)
+    envelope.push_back(hull[vertices[k]]);
+
+  return envelope;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,107 @@
+/*! \file HullVertices.h
+ *  \brief The declaration of findConvexHullVertices() and
+ *         findLowerConvexEnvelopeVertices(), which find the vertices of
+ *         the convex hull of a (large) set of points in two or three
+ *         dimensions, optionally in parallel.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_HULL_VERTICES_H
+#define PARETO_APPROXIMATOR_HULL_VERTICES_H
+
+
+#include <vector>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Find the vertices (extreme points) of the convex hull of the given points.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *                     (the i'th coordinate of point k is
+ *                     coordinates[k * dimension + i])
+ *  \param dimension The points' dimension. (2 or 3)
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  \return The (increasing) indices of the points that are vertices of
+ *          the convex hull. Of several equal points only the first is
+ *          kept. If the points do not span the space (they are collinear
+ *          or, in three dimensions, coplanar) all the indices are
+ *          returned, like utility::computeConvexHull() does.
+ *
+ *  Meant for one-shot point sets, e.g. the tens of thousands of Pareto
+ *  points an exact algorithm found, where ConvexHull (which keeps every
+ *  facet up to date after each point it is given) is slow:
+ *  - in two dimensions uses Andrew's monotone chain algorithm, (O(n log n))
+ *  - in three dimensions uses the Quickhull algorithm. (see C. B. Barber,
+ *    D. P. Dobkin and H. Huhdanpaa, "The Quickhull algorithm for convex
+ *    hulls", ACM Transactions on Mathematical Software, 1996)
+ *
+ *  With more than one thread, splits the points into numThreads
+ *  contiguous parts, finds each part's hull vertices in its own thread
+ *  and then the hull vertices of all the parts' hull vertices. Uses fewer
+ *  threads if there are not enough points (a few thousand per thread) to
+ *  make it worthwhile. The result does not depend on the threads'
+ *  timing.
+ *
+ *  Points closer than \f$ 10^{-10} \f$ times the largest absolute
+ *  coordinate to a facet's hyperplane count as on the facet, i.e. are not
+ *  vertices. (like ConvexHull's)
+ *
+ *  \sa ConvexHull and findLowerConvexEnvelopeVertices()
+ */
+std::vector<unsigned int>
+findConvexHullVertices(const std::vector<double> & coordinates,
+                       unsigned int dimension, unsigned int numThreads = 1);
+
+
+//! Find the vertices of the lower convex envelope of the given points.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *                     (the i'th coordinate of point k is
+ *                     coordinates[k * dimension + i])
+ *  \param dimension The points' dimension. (2 or 3)
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  \return The (increasing) indices of the points that are vertices of
+ *          the lower convex envelope. Of several equal points only the
+ *          first is kept.
+ *
+ *  The lower convex envelope is the part of the convex hull that we can
+ *  see from \f$ (-\infty, \ldots, -\infty) \f$, i.e. the boundary of
+ *  the convex hull of the points plus the non-negative orthant. A point is
+ *  one of its vertices if and only if it is the only point that minimizes
+ *  some non-negative linear combination of the objectives, i.e. these are
+ *  the points Chord and PGEN can find. (the anchor points included)
+ *
+ *  Works even if the points do not span the space. (e.g. points on a
+ *  line in the plane)
+ *
+ *  \sa findConvexHullVertices()
+ */
+std::vector<unsigned int>
+findLowerConvexEnvelopeVertices(const std::vector<double> & coordinates,
+                                unsigned int dimension,
+                                unsigned int numThreads = 1);
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we want a
+// header-only code base.
+#include "HullVertices.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_HULL_VERTICES_H
@@ -12,6 +12,7 @@
 #include <vector>
 #include <iterator>
 #include <cmath>
+#include <limits>
 
 #include "Hyperplane.h"
 
@@ -703,25 +704,60 @@ Hyperplane::ratioDistance(const Point & p) const
     throw exception_classes::NotStrictlyPositivePointException();
   // else
 
+  double result = ratioDistanceUnchecked(p);
+  if (std::isinf(result))
+    // multiplying the point by a constant moves it in a direction 
+    // parallel to the hyperplane
+    throw exception_classes::InfiniteRatioDistanceException();
+
+  return result;
+}
+
+
+//! ratioDistance() without the checks.
+/*!
+ *  \param p A Point instance. (strictly positive)
+ *  \return The ratio distance from p to the hyperplane or 
+ *          \f$ +\infty \f$ if p's coordinate vector is perpendicular 
+ *          to the hyperplane's normal vector.
+ *  
+ *  p must be non-null, strictly positive and of the hyperplane's 
+ *  dimension. (only assert()ed)
+ *  
+ *  \sa Hyperplane::ratioDistance()
+ */
+double 
+Hyperplane::ratioDistanceUnchecked(const Point & p) const
+{
   assert(spaceDimension() > 0);
+  assert(not p.isNull() and p.dimension() == spaceDimension());
 
   double dotProduct = 0.0;
   for (unsigned int i=0; i!=spaceDimension(); ++i) 
-    dotProduct += coefficients_[i] * p[i];
+    dotProduct += coefficients_[i] * p.coordinateUnchecked(i);
 
-  double result;
   if (dotProduct == b_)
     // the point is on the hyperplane
     // it's okay even if dotProduct == 0.0
-    result = 0.0;
+    return 0.0;
   else if (dotProduct == 0.0)
-    // multiplying the point by a constant moves it in a direction 
-    // parallel to the hyperplane
-    throw exception_classes::InfiniteRatioDistanceException();
+    return std::numeric_limits<double>::infinity();
   else
-    result = std::max( (b_ - dotProduct) / dotProduct, 0.0 );
+    return std::max( (b_ - dotProduct) / dotProduct, 0.0 );
+}
 
-  return result;
+
+//! distance() without the checks.
+/*!
+ *  p must be non-null, strictly positive and of the hyperplane's 
+ *  dimension. (only assert()ed)
+ *  
+ *  \sa Hyperplane::distance() and Hyperplane::ratioDistanceUnchecked()
+ */
+double 
+Hyperplane::distanceUnchecked(const Point & p) const
+{
+  return ratioDistanceUnchecked(p);
 }
 
 
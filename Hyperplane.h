@@ -472,6 +472,31 @@ class Hyperplane
      *  \sa Hyperplane and Point
      */
     double ratioDistance(const Point & p) const;
+
+    //! ratioDistance() without the checks.
+    /*!
+     *  \param p A Point instance. (strictly positive)
+     *  \return The ratio distance from p to the hyperplane or 
+     *          \f$ +\infty \f$ if p's coordinate vector is perpendicular 
+     *          to the hyperplane's normal vector.
+     *  
+     *  Same as ratioDistance(), only it does not check its argument and 
+     *  never throws: p must be non-null, strictly positive and of the 
+     *  hyperplane's dimension. (only assert()ed)
+     *  
+     *  \sa ratioDistance()
+     */
+    double ratioDistanceUnchecked(const Point & p) const;
+
+    //! distance() without the checks.
+    /*!
+     *  Same as distance(), only it does not check its argument and never 
+     *  throws: p must be non-null, strictly positive and of the 
+     *  hyperplane's dimension. (only assert()ed)
+     *  
+     *  \sa distance() and ratioDistanceUnchecked()
+     */
+    double distanceUnchecked(const Point & p) const;
     
     //! Create a new Hyperplane parallel to the current one (through a point).
     /*!
@@ -0,0 +1,124 @@
+/*! \file LazyProblem.cpp
+ *  \brief The definition of the LazyProblem<S, T> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` LazyProblem.h. In fact LazyProblem.h will
+ *  `include` LazyProblem.cpp because it describes a class template
+ *  (which doesn't allow us to split declaration from definition).
+ */
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! LazyProblem's default constructor. (empty)
+template <class S, class T>
+LazyProblem<S, T>::LazyProblem() { }
+
+
+//! LazyProblem's default destructor. (virtual and empty)
+template <class S, class T>
+LazyProblem<S, T>::~LazyProblem() { }
+
+
+//! Materialize the solutions of the given points.
+/*!
+ *  \param tokenPoints Points comb() returned. (e.g. what
+ *                     computeConvexParetoSet() returned)
+ *  \return One PointAndSolution<S> for each point, in the same order,
+ *          with the same point and weights and the solution
+ *          materializeSolution() made from the point's token.
+ *
+ *  Null points stay null; materializeSolution() is not called for them.
+ *
+ *  \sa materializeSolution()
+ */
+template <class S, class T>
+std::vector< PointAndSolution<S> >
+LazyProblem<S, T>::materializeSolutions(
+                const std::vector< PointAndSolution<T> > & tokenPoints)
+{
+  std::vector< PointAndSolution<S> > result;
+  result.reserve(tokenPoints.size());
+  typename std::vector< PointAndSolution<T> >::const_iterator it;
+  for (it = tokenPoints.begin(); it != tokenPoints.end(); ++it) {
+    if (it->isNull()) {
+      result.push_back(PointAndSolution<S>());
+      continue;
+    }
+    // else
+
+    result.push_back(PointAndSolution<S>(it->point,
+                                         materializeSolution(*it),
+                                         it->weightsUsed.begin(),
+                                         it->weightsUsed.end()));
+  }
+
+  return result;
+}
+
+
+/*!
+ *  \brief Compute an (1+eps)-approximate convex Pareto set of the
+ *         problem and materialize the solutions of its points.
+ *
+ *  \param numObjectives The number of objectives to minimize.
+ *  \param eps The degree of approximation.
+ *  \return The points computeConvexParetoSet() returns, with their
+ *          solutions materialized. (see materializeSolutions())
+ *
+ *  \sa BaseProblem::computeConvexParetoSet(unsigned int, double) and
+ *      materializeSolution()
+ */
+template <class S, class T>
+std::vector< PointAndSolution<S> >
+LazyProblem<S, T>::computeMaterializedConvexParetoSet(
+                                      unsigned int numObjectives,
+                                      double eps)
+{
+  return materializeSolutions(
+              this->computeConvexParetoSet(numObjectives, eps));
+}
+
+
+/*!
+ *  \brief Compute an (1+eps)-approximate convex Pareto set of the
+ *         problem, passing each new point (with its token) to a
+ *         callback as soon as it is found, and materialize the
+ *         solutions of the resulting points.
+ *
+ *  \param numObjectives The number of objectives to minimize.
+ *  \param eps The degree of approximation.
+ *  \param newPointCallback See
+ *         BaseProblem::computeConvexParetoSet(unsigned int, double, NewPointCallback).
+ *  \return The points computeConvexParetoSet() returns, with their
+ *          solutions materialized. (see materializeSolutions())
+ *
+ *  \sa BaseProblem::computeConvexParetoSet(unsigned int, double, NewPointCallback)
+ *      and materializeSolution()
+ */
+template <class S, class T>
+std::vector< PointAndSolution<S> >
+LazyProblem<S, T>::computeMaterializedConvexParetoSet(
+                                      unsigned int numObjectives,
+                                      double eps,
+                                      NewPointCallback newPointCallback)
+{
+  return materializeSolutions(
+              this->computeConvexParetoSet(numObjectives, eps,
+                                           newPointCallback));
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,146 @@
+/*! \file LazyProblem.h
+ *  \brief The declaration of the LazyProblem<S, T> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_LAZY_PROBLEM_H
+#define PARETO_APPROXIMATOR_LAZY_PROBLEM_H
+
+
+#include <vector>
+
+#include "PointAndSolution.h"
+#include "BaseProblem.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A problem whose comb() returns cheap solution tokens instead of solutions.
+/*!
+ *  Most of the points comb() returns only serve as facet vertices or end
+ *  up dominated. Building a full solution (an S instance, e.g. a path)
+ *  for each one of them is wasted work.
+ *
+ *  A LazyProblem<S, T> is a BaseProblem<T>: its comb() returns each
+ *  point together with a lightweight token (a T instance) instead of the
+ *  solution itself. materializeSolution() turns a token (and the point
+ *  and weights it came with) into the full solution.
+ *  computeMaterializedConvexParetoSet() only calls it for the points it
+ *  returns.
+ *
+ *  Users derive from LazyProblem<S, T> instead of BaseProblem<S> and
+ *  implement both comb() and materializeSolution(). A token may be
+ *  anything that lets materializeSolution() rebuild the solution, e.g.
+ *  an index into a cache or nothing at all if calling the underlying
+ *  optimizer again with the point's weightsUsed is cheap enough.
+ *
+ *  \sa BaseProblem, materializeSolution() and
+ *      computeMaterializedConvexParetoSet()
+ */
+template <class S, class T>
+class LazyProblem : public BaseProblem<T>
+{
+  public:
+    //! The type of the callback computeMaterializedConvexParetoSet() gets.
+    /*!
+     *  Same as BaseProblem<T>::NewPointCallback, i.e. it gets points with
+     *  tokens, not materialized solutions.
+     */
+    typedef typename BaseProblem<T>::NewPointCallback NewPointCallback;
+
+    //! LazyProblem's default constructor. (empty)
+    LazyProblem();
+
+    //! LazyProblem's default destructor. (virtual and empty)
+    virtual ~LazyProblem();
+
+    //! Build the full solution a token stands for.
+    /*!
+     *  \param tokenPoint A point comb() returned. tokenPoint.solution is
+     *                    the token and tokenPoint.weightsUsed the weights
+     *                    comb() was called with.
+     *  \return The full solution corresponding to tokenPoint.point.
+     *
+     *  Pure virtual; users must implement it. It is called once for each
+     *  point computeMaterializedConvexParetoSet() returns, after Chord or
+     *  PGEN have finished (always on the calling thread).
+     *
+     *  \sa materializeSolutions() and computeMaterializedConvexParetoSet()
+     */
+    virtual S materializeSolution(const PointAndSolution<T> & tokenPoint) = 0;
+
+    //! Materialize the solutions of the given points.
+    /*!
+     *  \param tokenPoints Points comb() returned. (e.g. what
+     *                     computeConvexParetoSet() returned)
+     *  \return One PointAndSolution<S> for each point, in the same order,
+     *          with the same point and weights and the solution
+     *          materializeSolution() made from the point's token.
+     *
+     *  \sa materializeSolution()
+     */
+    std::vector< PointAndSolution<S> >
+    materializeSolutions(
+            const std::vector< PointAndSolution<T> > & tokenPoints);
+
+    /*!
+     *  \brief Compute an (1+eps)-approximate convex Pareto set of the
+     *         problem and materialize the solutions of its points.
+     *
+     *  \param numObjectives The number of objectives to minimize.
+     *  \param eps The degree of approximation.
+     *  \return The points computeConvexParetoSet() returns, with their
+     *          solutions materialized. (see materializeSolutions())
+     *
+     *  \sa BaseProblem::computeConvexParetoSet(unsigned int, double) and
+     *      materializeSolution()
+     */
+    std::vector< PointAndSolution<S> >
+    computeMaterializedConvexParetoSet(unsigned int numObjectives,
+                                       double eps=1e-12);
+
+    /*!
+     *  \brief Compute an (1+eps)-approximate convex Pareto set of the
+     *         problem, passing each new point (with its token) to a
+     *         callback as soon as it is found, and materialize the
+     *         solutions of the resulting points.
+     *
+     *  \param numObjectives The number of objectives to minimize.
+     *  \param eps The degree of approximation.
+     *  \param newPointCallback See
+     *         BaseProblem::computeConvexParetoSet(unsigned int, double, NewPointCallback).
+     *  \return The points computeConvexParetoSet() returns, with their
+     *          solutions materialized. (see materializeSolutions())
+     *
+     *  \sa BaseProblem::computeConvexParetoSet(unsigned int, double, NewPointCallback)
+     *      and materializeSolution()
+     */
+    std::vector< PointAndSolution<S> >
+    computeMaterializedConvexParetoSet(unsigned int numObjectives,
+                                       double eps,
+                                       NewPointCallback newPointCallback);
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We have got to #include the implementation here because we are
+// describing a class template, not a simple class.
+#include "LazyProblem.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_LAZY_PROBLEM_H
@@ -21,7 +21,8 @@ namespace pareto_approximator {
 
 //! Default constructor. Makes an empty set.
 template <class T> 
-NonDominatedSet<T>::NonDominatedSet() : contents_() { }
+NonDominatedSet<T>::NonDominatedSet() : contents_(), block_(), 
+                                         blockElements_() { }
 
 
 //! Iteration constructor. 
@@ -45,6 +46,12 @@ NonDominatedSet<T>::NonDominatedSet() : contents_() { }
  *
  *  The function template type can be any type of input iterator 
  *  that points to T instances.
+ *  
+ *  For Point, FixedPoint<N> and PointAndSolution<S> elements, forward 
+ *  iterators and at least bulkConstructionThreshold elements, the 
+ *  elements are filtered all at once in O(n log n) time (see 
+ *  findNonDominatedPoints()) instead of one by one. The result is 
+ *  the same.
  *
  *  \sa NonDominatedSet
  */
@@ -52,7 +59,38 @@ template <class T>
 template <class InputIterator> 
 NonDominatedSet<T>::NonDominatedSet(InputIterator first, InputIterator last)
 {
-  insert(first, last);
+  construct(first, last, 
+            typename std::iterator_traits<InputIterator>::iterator_category());
+}
+
+
+//! Copy constructor.
+/*!
+ *  Copies the elements and rebuilds the PointBlock. (the copied 
+ *  blockElements_ iterators would point into nds's set)
+ */
+template <class T> 
+NonDominatedSet<T>::NonDominatedSet(const NonDominatedSet & nds) : 
+                          contents_(nds.contents_), block_(), blockElements_()
+{
+  rebuildBlock(Strategy());
+}
+
+
+//! Copy assignment operator.
+/*!
+ *  Copies the elements and rebuilds the PointBlock. (the copied 
+ *  blockElements_ iterators would point into nds's set)
+ */
+template <class T> 
+NonDominatedSet<T> & 
+NonDominatedSet<T>::operator= (const NonDominatedSet & nds)
+{
+  if (this != &nds) {
+    contents_ = nds.contents_;
+    rebuildBlock(Strategy());
+  }
+  return *this;
 }
 
 
@@ -172,6 +210,94 @@ NonDominatedSet<T>::size() const
 template <class T> 
 bool 
 NonDominatedSet<T>::insert(const T & t)
+{
+  return insert(t, Strategy());
+}
+
+
+//! insert() for T instances kept in a PointBlock.
+/*!
+ *  Same as the other version, only the dominance checks are done by 
+ *  block_ (PointBlock::someDominates() and PointBlock::dominatedBy()).
+ *  
+ *  \sa NonDominatedSet::insert()
+ */
+template <class T> 
+bool 
+NonDominatedSet<T>::insert(const T & t, PointBlockTag)
+{
+  // if t is dominated by some element in the set don't insert it
+  if (dominates(t, PointBlockTag()))
+    return false;
+  // else
+
+  // first remove any elements dominated by t 
+  // - go backwards, since erasing block_'s k'th point moves its last 
+  //   point (already checked) to position k
+  std::vector<unsigned int> dominated = 
+        block_.dominatedBy(NonDominatedSetPoint<T>::point(t));
+  std::vector<unsigned int>::reverse_iterator ri;
+  for (ri = dominated.rbegin(); ri != dominated.rend(); ++ri) {
+    contents_.erase(blockElements_[*ri]);
+    block_.erase(*ri);
+    blockElements_[*ri] = blockElements_.back();
+    blockElements_.pop_back();
+  }
+  // now insert the new element
+  iterator it = contents_.insert(t).first;
+  block_.push_back(NonDominatedSetPoint<T>::point(*it));
+  blockElements_.push_back(it);
+
+  return true;
+}
+
+
+//! insert() for 2-dimensional points sorted in a staircase.
+/*!
+ *  The elements t dominates are the ones with first coordinate at least 
+ *  t's and second coordinate at least t's. They are contiguous: they 
+ *  start at the first element whose first coordinate is not less than 
+ *  t's and end at the first element (after that) whose second coordinate 
+ *  is less than t's. Takes O(log n + k) time, where k is the number of 
+ *  elements erased.
+ *  
+ *  \sa NonDominatedSet::insert()
+ */
+template <class T> 
+bool 
+NonDominatedSet<T>::insert(const T & t, StaircaseTag)
+{
+  // if t is dominated by some element in the set don't insert it
+  if (dominates(t, StaircaseTag()))
+    return false;
+  // else
+
+  const double x = NonDominatedSetPoint<T>::point(t)[0];
+  const double y = NonDominatedSetPoint<T>::point(t)[1];
+
+  // first remove the elements dominated by t
+  iterator first = contents_.lower_bound(
+                        T(x, -std::numeric_limits<double>::infinity()));
+  iterator last = first;
+  while (last != contents_.end() and 
+         NonDominatedSetPoint<T>::point(*last)[1] >= y)
+    ++last;
+  contents_.erase(first, last);
+  // now insert the new element (right before "last", since t does not 
+  // dominate it and is not dominated by it)
+  contents_.insert(last, t);
+
+  return true;
+}
+
+
+//! insert() for all other T instances.
+/*!
+ *  \sa NonDominatedSet::insert()
+ */
+template <class T> 
+bool 
+NonDominatedSet<T>::insert(const T & t, LinearScanTag)
 {
   // if t is dominated by some element in the set don't insert it
   bool isDominated = this->dominates(t);
@@ -243,6 +369,61 @@ NonDominatedSet<T>::insert(InputIterator first, InputIterator last)
 template <class T> 
 bool 
 NonDominatedSet<T>::dominates(const T & t) const
+{
+  return dominates(t, Strategy());
+}
+
+
+//! dominates() for T instances kept in a PointBlock.
+/*!
+ *  \sa NonDominatedSet::dominates()
+ */
+template <class T> 
+bool 
+NonDominatedSet<T>::dominates(const T & t, PointBlockTag) const
+{
+  if (empty())
+    return false;
+  // else
+
+  NonDominatedSetPoint<T>::checkQuery(t);
+  return block_.someDominates(NonDominatedSetPoint<T>::point(t));
+}
+
+
+//! dominates() for 2-dimensional points sorted in a staircase.
+/*!
+ *  Among the elements whose first coordinate is not greater than t's, 
+ *  the last one has the smallest second coordinate. t is dominated iff 
+ *  that coordinate is not greater than t's. Takes O(log n) time.
+ *  
+ *  \sa NonDominatedSet::dominates()
+ */
+template <class T> 
+bool 
+NonDominatedSet<T>::dominates(const T & t, StaircaseTag) const
+{
+  const double x = NonDominatedSetPoint<T>::point(t)[0];
+  const double y = NonDominatedSetPoint<T>::point(t)[1];
+
+  iterator it = contents_.upper_bound(
+                        T(x, std::numeric_limits<double>::infinity()));
+  if (it == contents_.begin())
+    return false;
+  // else
+
+  --it;
+  return NonDominatedSetPoint<T>::point(*it)[1] <= y;
+}
+
+
+//! dominates() for all other T instances.
+/*!
+ *  \sa NonDominatedSet::dominates()
+ */
+template <class T> 
+bool 
+NonDominatedSet<T>::dominates(const T & t, LinearScanTag) const
 {
   iterator it;
   for (it = contents_.begin(); it != contents_.end(); ++it) 
@@ -265,6 +446,8 @@ void
 NonDominatedSet<T>::clear()
 {
   contents_.clear();
+  block_ = PointBlock();
+  blockElements_.clear();
 }
 
 
@@ -293,6 +476,134 @@ NonDominatedSet<T>::find(const T & t) const
 }
 
 
+//! Insert elements one by one. (an input iterator range)
+template <class T> 
+template <class InputIterator> 
+void 
+NonDominatedSet<T>::construct(InputIterator first, InputIterator last, 
+                              std::input_iterator_tag)
+{
+  insert(first, last);
+}
+
+
+//! Insert elements, in bulk if there are many. (a forward iterator range)
+template <class T> 
+template <class ForwardIterator> 
+void 
+NonDominatedSet<T>::construct(ForwardIterator first, ForwardIterator last, 
+                              std::forward_iterator_tag)
+{
+  if (std::distance(first, last) >= bulkConstructionThreshold)
+    bulkInsert(first, last, Strategy());
+  else
+    insert(first, last);
+}
+
+
+//! Filter the elements with findNonDominatedPoints() and insert them.
+/*!
+ *  Goes through the range twice: once to collect the points' coordinates 
+ *  and once to insert the non-dominated elements.
+ *  
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if some element is null.
+ *  - May throw a DifferentDimensionsException exception if the elements 
+ *    are not all of the same dimension.
+ *  - May throw whatever NonDominatedSetPoint<T>::checkQuery() throws.
+ *  
+ *  \sa findNonDominatedPoints()
+ */
+template <class T> 
+template <class ForwardIterator, class Tag> 
+void 
+NonDominatedSet<T>::bulkInsert(ForwardIterator first, ForwardIterator last, 
+                               Tag)
+{
+  assert(empty());
+
+  unsigned int dimension = 0;
+  std::vector<double> coordinates;
+  for (ForwardIterator it = first; it != last; ++it) {
+    const auto & p = NonDominatedSetPoint<T>::point(*it);
+    if (it == first)
+      dimension = p.dimension();
+    else if (p.dimension() != dimension)
+      throw exception_classes::DifferentDimensionsException();
+    NonDominatedSetPoint<T>::checkQuery(*it);
+    for (unsigned int i = 0; i != dimension; ++i)
+      coordinates.push_back(p[i]);
+  }
+
+  std::vector<unsigned int> nonDominated = 
+        findNonDominatedPoints(coordinates, dimension);
+  std::vector<unsigned int>::const_iterator ni = nonDominated.begin();
+  unsigned int k = 0;
+  for (ForwardIterator it = first; ni != nonDominated.end(); ++it, ++k)
+    if (k == *ni) {
+      insertNonDominated(*it, Tag());
+      ++ni;
+    }
+}
+
+
+//! Insert the elements one by one. (no bulk path)
+template <class T> 
+template <class ForwardIterator> 
+void 
+NonDominatedSet<T>::bulkInsert(ForwardIterator first, ForwardIterator last, 
+                               LinearScanTag)
+{
+  insert(first, last);
+}
+
+
+//! Insert an element known not to dominate or be dominated.
+template <class T> 
+void 
+NonDominatedSet<T>::insertNonDominated(const T & t, PointBlockTag)
+{
+  iterator it = contents_.insert(t).first;
+  block_.push_back(NonDominatedSetPoint<T>::point(*it));
+  blockElements_.push_back(it);
+}
+
+
+//! Insert an element known not to dominate or be dominated.
+template <class T> 
+void 
+NonDominatedSet<T>::insertNonDominated(const T & t, StaircaseTag)
+{
+  contents_.insert(t);
+}
+
+
+//! Rebuild block_ and blockElements_ from contents_.
+template <class T> 
+void 
+NonDominatedSet<T>::rebuildBlock(PointBlockTag)
+{
+  block_ = PointBlock();
+  blockElements_.clear();
+  for (iterator it = contents_.begin(); it != contents_.end(); ++it) {
+    block_.push_back(NonDominatedSetPoint<T>::point(*it));
+    blockElements_.push_back(it);
+  }
+}
+
+
+//! Nothing to rebuild.
+template <class T> 
+void 
+NonDominatedSet<T>::rebuildBlock(StaircaseTag) { }
+
+
+//! Nothing to rebuild.
+template <class T> 
+void 
+NonDominatedSet<T>::rebuildBlock(LinearScanTag) { }
+
+
 }  // namespace pareto_approximator
 
 
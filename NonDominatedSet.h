@@ -9,9 +9,17 @@
 #define NON_DOMINATED_SET_H
 
 #include <set>
+#include <vector>
+#include <limits>
+#include <iterator>
+#include <type_traits>
 
 #include "Point.h"
+#include "FixedPoint.h"
 #include "PointAndSolution.h"
+#include "PointBlock.h"
+#include "ParetoFilter.h"
+#include "DifferentDimensionsException.h"
 
 
 /*!
@@ -24,6 +32,91 @@
 namespace pareto_approximator {
 
 
+//! How NonDominatedSet<T> gets the point out of a T instance.
+/*!
+ *  If isBlockable is true NonDominatedSet<T> keeps a copy of its 
+ *  elements' points in a PointBlock and uses the block's kernels for 
+ *  the dominance checks; otherwise it calls T::dominates() on every 
+ *  element. Specialized for Point, FixedPoint<N> and PointAndSolution<S>.
+ *  
+ *  If isStaircase is true (FixedPoint<2>) T's points are 2-dimensional 
+ *  and T's operator<() sorts them by their first coordinate (then by 
+ *  their second). Sorted like that the non-dominated points form a 
+ *  staircase (their second coordinates strictly decrease), so 
+ *  NonDominatedSet<T> can use binary searches instead of a PointBlock. 
+ *  
+ *  The specializations have:
+ *  - static const bool isBlockable = true;
+ *  - static const bool isStaircase;
+ *  - static const P & point(const T & t): t's point. (P is Point or 
+ *    FixedPoint<N>)
+ *  - static void checkQuery(const T & t): throws whatever T::dominates() 
+ *    would throw for t but the PointBlock kernels do not check.
+ *  
+ *  \sa NonDominatedSet and PointBlock
+ */
+template <class T> 
+struct NonDominatedSetPoint
+{
+  //! Can NonDominatedSet<T> keep the points in a PointBlock?
+  static const bool isBlockable = false;
+
+  //! Are T's points 2-dimensional and sorted by T's operator<()?
+  static const bool isStaircase = false;
+};
+
+
+//! A Point is its own point.
+template <> 
+struct NonDominatedSetPoint<Point>
+{
+  static const bool isBlockable = true;
+  static const bool isStaircase = false;
+
+  static const Point & point(const Point & t) { return t; }
+
+  static void checkQuery(const Point & t) 
+  {
+    if (not t.isPositive())
+      throw exception_classes::NotPositivePointException();
+  }
+};
+
+
+//! A FixedPoint<N> is its own point.
+template <unsigned int N> 
+struct NonDominatedSetPoint< FixedPoint<N> >
+{
+  static const bool isBlockable = true;
+  static const bool isStaircase = (N == 2);
+
+  static const FixedPoint<N> & point(const FixedPoint<N> & t) { return t; }
+
+  static void checkQuery(const FixedPoint<N> &) { }
+};
+
+
+//! A PointAndSolution<S>'s point is its "point" attribute.
+template <class S> 
+struct NonDominatedSetPoint< PointAndSolution<S> >
+{
+  static const bool isBlockable = true;
+  static const bool isStaircase = false;
+
+  static const Point & point(const PointAndSolution<S> & t) 
+  {
+    if (t.isNull())
+      throw exception_classes::NullObjectException();
+    return t.point;
+  }
+
+  static void checkQuery(const PointAndSolution<S> & t) 
+  {
+    NonDominatedSetPoint<Point>::checkQuery(point(t));
+  }
+};
+
+
 //! A container that only keeps non-dominated points. (plus solutions)
 /*!
  *  The NonDominatedSet<T> is a type of container/filter. It stores unique 
@@ -53,7 +146,16 @@ namespace pareto_approximator {
  *  some new functionality is required it shouldn't be hard to add new 
  *  methods that delegate to the underlying set's methods.
  *  
- *  \sa PointAndSolution
+ *  For Point, FixedPoint<N> and PointAndSolution<S> elements the set also 
+ *  keeps a copy of the elements' points in a PointBlock, so insert() and 
+ *  dominates() compare the new point against all the elements at once 
+ *  (with SIMD instructions where available) instead of calling 
+ *  T::dominates() once per element. For FixedPoint<2> elements, which 
+ *  the set keeps sorted in a staircase, insert() and dominates() take 
+ *  O(log n) time (plus the time to erase the elements t dominates). 
+ *  (see NonDominatedSetPoint)
+ *  
+ *  \sa PointAndSolution, PointBlock and NonDominatedSetPoint
  */
 template <class T> 
 class NonDominatedSet
@@ -68,6 +170,9 @@ class NonDominatedSet
     //! Unsigned integral type (usually same as size_t).
     typedef typename std::set<T>::size_type size_type;
 
+    //! From this many elements on the iteration constructor filters them in bulk.
+    static const unsigned int bulkConstructionThreshold = 64;
+
     //! Default constructor. Makes an empty set.
     NonDominatedSet();
 
@@ -92,12 +197,24 @@ class NonDominatedSet
      *
      *  The function template type can be any type of input iterator 
      *  that points to T instances.
+     *  
+     *  For Point, FixedPoint<N> and PointAndSolution<S> elements, forward 
+     *  iterators and at least bulkConstructionThreshold elements, the 
+     *  elements are filtered all at once in O(n log n) time (see 
+     *  findNonDominatedPoints()) instead of one by one. The result is 
+     *  the same.
      *
      *  \sa NonDominatedSet
      */
     template <class InputIterator>
     NonDominatedSet(InputIterator first, InputIterator last);
 
+    //! Copy constructor.
+    NonDominatedSet(const NonDominatedSet & nds);
+
+    //! Copy assignment operator.
+    NonDominatedSet & operator= (const NonDominatedSet & nds);
+
     //! Destructor. (all the contained elements' destructors will be called) 
     ~NonDominatedSet();
 
@@ -240,7 +357,83 @@ class NonDominatedSet
     iterator find(const T & t) const;
 
   private:
+    //! Check every element. (T::dominates())
+    struct LinearScanTag { };
+
+    //! Check the elements' points in block_. (PointBlock)
+    struct PointBlockTag { };
+
+    //! Binary search the staircase of 2-dimensional points.
+    struct StaircaseTag { };
+
+    //! How insert() and dominates() find the elements that matter.
+    typedef typename std::conditional<
+              NonDominatedSetPoint<T>::isStaircase, StaircaseTag, 
+              typename std::conditional<
+                NonDominatedSetPoint<T>::isBlockable, PointBlockTag, 
+                LinearScanTag>::type>::type 
+            Strategy;
+
+    //! insert() for T instances kept in a PointBlock.
+    bool insert(const T & t, PointBlockTag);
+
+    //! insert() for 2-dimensional points sorted in a staircase.
+    bool insert(const T & t, StaircaseTag);
+
+    //! insert() for all other T instances.
+    bool insert(const T & t, LinearScanTag);
+
+    //! dominates() for T instances kept in a PointBlock.
+    bool dominates(const T & t, PointBlockTag) const;
+
+    //! dominates() for 2-dimensional points sorted in a staircase.
+    bool dominates(const T & t, StaircaseTag) const;
+
+    //! dominates() for all other T instances.
+    bool dominates(const T & t, LinearScanTag) const;
+
+    //! Insert elements one by one. (an input iterator range)
+    template <class InputIterator>
+    void construct(InputIterator first, InputIterator last, 
+                   std::input_iterator_tag);
+
+    //! Insert elements, in bulk if there are many. (a forward iterator range)
+    template <class ForwardIterator>
+    void construct(ForwardIterator first, ForwardIterator last, 
+                   std::forward_iterator_tag);
+
+    //! Filter the elements with findNonDominatedPoints() and insert them.
+    template <class ForwardIterator, class Tag>
+    void bulkInsert(ForwardIterator first, ForwardIterator last, Tag);
+
+    //! Insert the elements one by one. (no bulk path)
+    template <class ForwardIterator>
+    void bulkInsert(ForwardIterator first, ForwardIterator last, 
+                    LinearScanTag);
+
+    //! Insert an element known not to dominate or be dominated.
+    void insertNonDominated(const T & t, PointBlockTag);
+
+    //! Insert an element known not to dominate or be dominated.
+    void insertNonDominated(const T & t, StaircaseTag);
+
+    //! Rebuild block_ and blockElements_ from contents_.
+    void rebuildBlock(PointBlockTag);
+
+    //! Nothing to rebuild.
+    void rebuildBlock(StaircaseTag);
+
+    //! Nothing to rebuild.
+    void rebuildBlock(LinearScanTag);
+
+    //! The elements.
     std::set<T> contents_;
+
+    //! The elements' points. (only used with PointBlockTag)
+    PointBlock block_;
+
+    //! blockElements_[k] is the element whose point is block_'s k'th.
+    std::vector<iterator> blockElements_;
 };
 
 
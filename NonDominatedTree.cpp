@@ -0,0 +1,568 @@
+/*! \file NonDominatedTree.cpp
+ *  \brief The implementation of the NonDominatedTree<T> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` NonDominatedTree.h. In fact NonDominatedTree.h will
+ *  `include` NonDominatedTree.cpp because it describes a class template
+ *  (which doesn't allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <algorithm>
+#include <limits>
+
+#include "DifferentDimensionsException.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A node of the ND-tree.
+/*!
+ *  - ideal and nadir bound the points under the node:
+ *    \f$ ideal_{i} \le p_{i} \le nadir_{i} \f$ for every point p and
+ *    every i. Erasing points does not shrink them, so they are not
+ *    always tight (but always valid).
+ *  - Leaves have no children; their points are in block and elements[k]
+ *    is the element whose point is block's k'th.
+ *  - Inner nodes have at least two children and no points of their own.
+ *  - Only the root can be an empty leaf.
+ */
+template <class T>
+struct NonDominatedTree<T>::Node
+{
+  //! Is the node a leaf?
+  bool isLeaf() const { return children.empty(); }
+
+  //! Is the node an empty leaf?
+  bool isEmpty() const { return isLeaf() and elements.empty(); }
+
+  //! The squared Euclidean distance from q to the center of the box.
+  double squaredDistanceToCenter(const std::vector<double> & q) const
+  {
+    double result = 0.0;
+    for (unsigned int i = 0; i != q.size(); ++i) {
+      double d = q[i] - (ideal[i] + nadir[i]) / 2.0;
+      result += d * d;
+    }
+    return result;
+  }
+
+  //! Grow the box so that it contains q. (an empty leaf's box becomes q)
+  void growBox(const std::vector<double> & q)
+  {
+    if (isEmpty()) {
+      ideal = q;
+      nadir = q;
+      return;
+    }
+    // else
+
+    for (unsigned int i = 0; i != q.size(); ++i) {
+      ideal[i] = std::min(ideal[i], q[i]);
+      nadir[i] = std::max(nadir[i], q[i]);
+    }
+  }
+
+  //! Lower bounds for the coordinates of the points under the node.
+  std::vector<double> ideal;
+
+  //! Upper bounds for the coordinates of the points under the node.
+  std::vector<double> nadir;
+
+  //! The node's children. (empty for leaves)
+  std::vector< std::unique_ptr<Node> > children;
+
+  //! A leaf's points.
+  PointBlock block;
+
+  //! A leaf's elements. (elements[k]'s point is block's k'th)
+  std::vector<iterator> elements;
+};
+
+
+//! Default constructor. Makes an empty set.
+template <class T>
+NonDominatedTree<T>::NonDominatedTree() : contents_(), root_(new Node()),
+                                          dimension_(0),
+                                          maxLeafSize_(defaultMaxLeafSize)
+{ }
+
+
+//! Make an empty set whose leaves keep at most maxLeafSize points.
+/*!
+ *  \param maxLeafSize The maximum number of points in a leaf. (at least 1)
+ */
+template <class T>
+NonDominatedTree<T>::NonDominatedTree(unsigned int maxLeafSize) :
+                  contents_(), root_(new Node()), dimension_(0),
+                  maxLeafSize_(maxLeafSize)
+{
+  assert(maxLeafSize > 0);
+}
+
+
+//! Iteration constructor. (see NonDominatedSet's)
+template <class T>
+template <class InputIterator>
+NonDominatedTree<T>::NonDominatedTree(InputIterator first,
+                                      InputIterator last) :
+                  contents_(), root_(new Node()), dimension_(0),
+                  maxLeafSize_(defaultMaxLeafSize)
+{
+  insert(first, last);
+}
+
+
+//! Copy constructor.
+/*!
+ *  Copies the elements and rebuilds the tree. (the copied tree's
+ *  iterators would point into ndt's set)
+ */
+template <class T>
+NonDominatedTree<T>::NonDominatedTree(const NonDominatedTree & ndt) :
+                  contents_(ndt.contents_), root_(new Node()),
+                  dimension_(ndt.dimension_), maxLeafSize_(ndt.maxLeafSize_)
+{
+  rebuildTree();
+}
+
+
+//! Copy assignment operator.
+/*!
+ *  Copies the elements and rebuilds the tree. (the copied tree's
+ *  iterators would point into ndt's set)
+ */
+template <class T>
+NonDominatedTree<T> &
+NonDominatedTree<T>::operator= (const NonDominatedTree & ndt)
+{
+  if (this != &ndt) {
+    contents_ = ndt.contents_;
+    dimension_ = ndt.dimension_;
+    maxLeafSize_ = ndt.maxLeafSize_;
+    rebuildTree();
+  }
+  return *this;
+}
+
+
+//! Destructor. (all the contained elements' destructors will be called)
+template <class T>
+NonDominatedTree<T>::~NonDominatedTree() { }
+
+
+//! Return iterator to beginning.
+template <class T>
+typename NonDominatedTree<T>::iterator
+NonDominatedTree<T>::begin() const
+{
+  return contents_.begin();
+}
+
+
+//! Return iterator to end.
+template <class T>
+typename NonDominatedTree<T>::iterator
+NonDominatedTree<T>::end() const
+{
+  return contents_.end();
+}
+
+
+//! Test whether container is empty.
+template <class T>
+bool
+NonDominatedTree<T>::empty() const
+{
+  return contents_.empty();
+}
+
+
+//! Returns the number of elements in the container.
+template <class T>
+typename NonDominatedTree<T>::size_type
+NonDominatedTree<T>::size() const
+{
+  return contents_.size();
+}
+
+
+//! The maximum number of points in a leaf.
+template <class T>
+unsigned int
+NonDominatedTree<T>::maxLeafSize() const
+{
+  return maxLeafSize_;
+}
+
+
+//! Insert element.
+/*!
+ *  \param t The T instance to insert.
+ *  \return true if the element was actually inserted (was not
+ *          dominated); false otherwise.
+ *
+ *  Same as NonDominatedSet::insert().
+ *
+ *  \sa NonDominatedTree
+ */
+template <class T>
+bool
+NonDominatedTree<T>::insert(const T & t)
+{
+  // if t is dominated by some element in the set don't insert it
+  if (this->dominates(t))
+    return false;
+  // else
+
+  std::vector<double> q = coordinatesOf(t);
+  // first remove any elements dominated by t
+  if (not empty())
+    eraseDominated(*root_, t, q);
+  if (empty())
+    dimension_ = q.size();
+  // now insert the new element
+  iterator it = contents_.insert(t).first;
+  addToTree(*root_, it, q);
+
+  return true;
+}
+
+
+//! Insert elements. (see NonDominatedSet's)
+template <class T>
+template <class InputIterator>
+bool
+NonDominatedTree<T>::insert(InputIterator first, InputIterator last)
+{
+  bool insertedAtLeastOneElement = false;
+  for ( ; first != last; ++first)
+    insertedAtLeastOneElement |= this->insert(*first);
+
+  return insertedAtLeastOneElement;
+}
+
+
+//! Check if some element in the set dominates the given instance.
+/*!
+ *  \param t A T instance.
+ *  \return true if some element in the set dominates t; false otherwise.
+ *
+ *  Same as NonDominatedSet::dominates().
+ *
+ *  \sa NonDominatedTree
+ */
+template <class T>
+bool
+NonDominatedTree<T>::dominates(const T & t) const
+{
+  if (empty())
+    return false;
+  // else
+
+  NonDominatedSetPoint<T>::checkQuery(t);
+  return dominates(*root_, t, coordinatesOf(t));
+}
+
+
+//! Clear content.
+template <class T>
+void
+NonDominatedTree<T>::clear()
+{
+  contents_.clear();
+  root_.reset(new Node());
+  dimension_ = 0;
+}
+
+
+//! Get iterator to element.
+/*!
+ *  \param t A T instance.
+ *  \return An iterator to the T element which is equal to t if one
+ *          exists; an iterator to the past-the-end element otherwise.
+ */
+template <class T>
+typename NonDominatedTree<T>::iterator
+NonDominatedTree<T>::find(const T & t) const
+{
+  return contents_.find(t);
+}
+
+
+//! Does p weakly dominate q? (\f$ p_{i} \le q_{i} \f$ for all i)
+template <class T>
+bool
+NonDominatedTree<T>::isLessOrEqual(const std::vector<double> & p,
+                                   const std::vector<double> & q)
+{
+  for (unsigned int i = 0; i != p.size(); ++i)
+    if (p[i] > q[i])
+      return false;
+
+  return true;
+}
+
+
+//! Check t against the set's dimension and copy its coordinates.
+/*!
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if t (or its point) is
+ *    null.
+ *  - May throw a DifferentDimensionsException exception if the set is
+ *    not empty and t's dimension is not its elements'.
+ */
+template <class T>
+std::vector<double>
+NonDominatedTree<T>::coordinatesOf(const T & t) const
+{
+  const unsigned int dimension =
+        NonDominatedSetPoint<T>::point(t).dimension();
+  if (dimension_ != 0 and dimension != dimension_)
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  std::vector<double> q(dimension);
+  for (unsigned int i = 0; i != dimension; ++i)
+    q[i] = NonDominatedSetPoint<T>::point(t)[i];
+
+  return q;
+}
+
+
+//! Does some point under node dominate q? (t's coordinates)
+/*!
+ *  - If the node's ideal point does not dominate q no point under it
+ *    does.
+ *  - If the node's nadir point dominates q every point under it does.
+ */
+template <class T>
+bool
+NonDominatedTree<T>::dominates(const Node & node, const T & t,
+                               const std::vector<double> & q) const
+{
+  if (not isLessOrEqual(node.ideal, q))
+    return false;
+  if (isLessOrEqual(node.nadir, q))
+    return true;
+  if (node.isLeaf())
+    return node.block.someDominates(NonDominatedSetPoint<T>::point(t));
+  // else
+
+  typename std::vector< std::unique_ptr<Node> >::const_iterator ci;
+  for (ci = node.children.begin(); ci != node.children.end(); ++ci)
+    if (dominates(**ci, t, q))
+      return true;
+
+  return false;
+}
+
+
+//! Erase the elements under node that q (t's coordinates) dominates.
+/*!
+ *  - If q does not dominate the node's nadir point it dominates no
+ *    point under the node.
+ *  - If q dominates the node's ideal point it dominates every point
+ *    under the node.
+ *
+ *  Removes children left empty and replaces an inner node left with a
+ *  single child by that child.
+ */
+template <class T>
+void
+NonDominatedTree<T>::eraseDominated(Node & node, const T & t,
+                                    const std::vector<double> & q)
+{
+  if (not isLessOrEqual(q, node.nadir))
+    return;
+  // else
+  if (isLessOrEqual(q, node.ideal)) {
+    eraseSubtree(node);
+    return;
+  }
+  // else
+
+  if (node.isLeaf()) {
+    // go backwards, since erasing block's k'th point moves its last
+    // point (already checked) to position k
+    std::vector<unsigned int> dominated =
+          node.block.dominatedBy(NonDominatedSetPoint<T>::point(t));
+    std::vector<unsigned int>::reverse_iterator ri;
+    for (ri = dominated.rbegin(); ri != dominated.rend(); ++ri) {
+      contents_.erase(node.elements[*ri]);
+      node.block.erase(*ri);
+      node.elements[*ri] = node.elements.back();
+      node.elements.pop_back();
+    }
+    return;
+  }
+  // else
+
+  typename std::vector< std::unique_ptr<Node> >::iterator ci;
+  for (ci = node.children.begin(); ci != node.children.end(); ) {
+    eraseDominated(**ci, t, q);
+    if ((*ci)->isEmpty())
+      ci = node.children.erase(ci);
+    else
+      ++ci;
+  }
+
+  if (node.children.size() == 1) {
+    std::unique_ptr<Node> onlyChild = std::move(node.children.front());
+    node = std::move(*onlyChild);
+  }
+  else if (node.children.empty())
+    // (only possible with loose bounds) make node an empty leaf
+    eraseSubtree(node);
+}
+
+
+//! Erase every element under node. (node becomes an empty leaf)
+template <class T>
+void
+NonDominatedTree<T>::eraseSubtree(Node & node)
+{
+  typename std::vector<iterator>::iterator ei;
+  for (ei = node.elements.begin(); ei != node.elements.end(); ++ei)
+    contents_.erase(*ei);
+  typename std::vector< std::unique_ptr<Node> >::iterator ci;
+  for (ci = node.children.begin(); ci != node.children.end(); ++ci)
+    eraseSubtree(**ci);
+
+  node.children.clear();
+  node.block = PointBlock();
+  node.elements.clear();
+}
+
+
+//! Add the element "it" (with coordinates q) under node.
+/*!
+ *  Goes down to the child whose box center is closest to q and splits
+ *  the leaf it ends up in if it has too many points.
+ */
+template <class T>
+void
+NonDominatedTree<T>::addToTree(Node & node, iterator it,
+                               const std::vector<double> & q)
+{
+  node.growBox(q);
+
+  if (node.isLeaf()) {
+    node.block.push_back(NonDominatedSetPoint<T>::point(*it));
+    node.elements.push_back(it);
+    if (node.elements.size() > maxLeafSize_)
+      split(node);
+    return;
+  }
+  // else
+
+  Node * closest = node.children.front().get();
+  double closestDistance = closest->squaredDistanceToCenter(q);
+  for (unsigned int c = 1; c != node.children.size(); ++c) {
+    double distance = node.children[c]->squaredDistanceToCenter(q);
+    if (distance < closestDistance) {
+      closest = node.children[c].get();
+      closestDistance = distance;
+    }
+  }
+  addToTree(*closest, it, q);
+}
+
+
+//! Split a leaf with more than maxLeafSize_ points.
+/*!
+ *  Makes (dimension + 1) children (or fewer, if there are fewer points).
+ *  The first child gets the point with the largest total squared
+ *  distance to the other points, every next child the point farthest
+ *  from the points already picked. The rest of the points go to the
+ *  child whose box center is closest.
+ */
+template <class T>
+void
+NonDominatedTree<T>::split(Node & leaf)
+{
+  assert(leaf.isLeaf());
+
+  const unsigned int numPoints = leaf.elements.size();
+  const unsigned int numChildren = std::min(dimension_ + 1, numPoints);
+  assert(numChildren >= 2);
+
+  std::vector< std::vector<double> > points(numPoints,
+                                            std::vector<double>(dimension_));
+  for (unsigned int k = 0; k != numPoints; ++k)
+    for (unsigned int i = 0; i != dimension_; ++i)
+      points[k][i] = leaf.block.coordinate(k, i);
+
+  // pick the seeds
+  // - minDistance[k] is point k's squared distance to the closest seed
+  //   (-1.0 for the seeds themselves)
+  std::vector<double> totalDistance(numPoints, 0.0);
+  for (unsigned int k = 0; k != numPoints; ++k)
+    for (unsigned int j = 0; j != numPoints; ++j)
+      for (unsigned int i = 0; i != dimension_; ++i)
+        totalDistance[k] += (points[k][i] - points[j][i]) *
+                            (points[k][i] - points[j][i]);
+  std::vector<unsigned int> seeds(1, std::max_element(totalDistance.begin(),
+                                                      totalDistance.end()) -
+                                     totalDistance.begin());
+  std::vector<double> minDistance(numPoints,
+                                  std::numeric_limits<double>::infinity());
+  while (seeds.size() != numChildren) {
+    minDistance[seeds.back()] = -1.0;
+    for (unsigned int k = 0; k != numPoints; ++k) {
+      if (minDistance[k] < 0.0)
+        continue;
+      double distance = 0.0;
+      for (unsigned int i = 0; i != dimension_; ++i)
+        distance += (points[k][i] - points[seeds.back()][i]) *
+                    (points[k][i] - points[seeds.back()][i]);
+      minDistance[k] = std::min(minDistance[k], distance);
+    }
+    seeds.push_back(std::max_element(minDistance.begin(),
+                                     minDistance.end()) -
+                    minDistance.begin());
+  }
+  minDistance[seeds.back()] = -1.0;
+
+  // make the children
+  std::vector<iterator> elements;
+  elements.swap(leaf.elements);
+  leaf.block = PointBlock();
+  for (unsigned int c = 0; c != numChildren; ++c) {
+    leaf.children.push_back(std::unique_ptr<Node>(new Node()));
+    addToTree(*leaf.children.back(), elements[seeds[c]], points[seeds[c]]);
+  }
+  for (unsigned int k = 0; k != numPoints; ++k) {
+    if (minDistance[k] < 0.0)
+      // a seed
+      continue;
+    addToTree(leaf, elements[k], points[k]);
+  }
+}
+
+
+//! Rebuild the tree from contents_.
+template <class T>
+void
+NonDominatedTree<T>::rebuildTree()
+{
+  root_.reset(new Node());
+  for (iterator it = contents_.begin(); it != contents_.end(); ++it)
+    addToTree(*root_, it, coordinatesOf(*it));
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,204 @@
+/*! \file NonDominatedTree.h
+ *  \brief The definition of the NonDominatedTree<T> class template. (a
+ *         NonDominatedSet indexed by an ND-tree)
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef NON_DOMINATED_TREE_H
+#define NON_DOMINATED_TREE_H
+
+#include <set>
+#include <vector>
+#include <memory>
+
+#include "Point.h"
+#include "PointBlock.h"
+#include "NonDominatedSet.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A container that only keeps non-dominated points, indexed by an ND-tree.
+/*!
+ *  NonDominatedTree<T> has the same interface (and keeps the same
+ *  elements) as NonDominatedSet<T>, so the two can be swapped. T must be
+ *  Point, FixedPoint<N> or PointAndSolution<S>. (see NonDominatedSetPoint)
+ *
+ *  NonDominatedSet<T> compares a new point against every element.
+ *  NonDominatedTree<T> also keeps its elements' points in an ND-tree:
+ *  every node has a box (its ideal and nadir points) containing the
+ *  points under it, and leaves keep at most maxLeafSize() points in a
+ *  PointBlock. insert() and dominates() skip every subtree whose box
+ *  cannot contain a point dominating (or dominated by) the new point,
+ *  and accept (or erase) whole subtrees whose box lies entirely on the
+ *  right side of it. Useful for three or more objectives and large sets;
+ *  for two objectives NonDominatedSet< FixedPoint<2> > is faster still.
+ *
+ *  The tree is the one described in: A. Jaszkiewicz and T. Lust,
+ *  "ND-Tree-based update: a fast algorithm for the dynamic
+ *  non-dominance problem", IEEE Transactions on Evolutionary
+ *  Computation, 2018. A full leaf is split into (dimension + 1)
+ *  children around far-apart seed points; a new point goes down to the
+ *  child whose box center is closest to it.
+ *
+ *  \sa NonDominatedSet, NonDominatedSetPoint and PointBlock
+ */
+template <class T>
+class NonDominatedTree
+{
+  public:
+    //! Bidirectional iterator to the set's contents.
+    typedef typename std::set<T>::iterator iterator;
+
+    //! Constant bidirectional iterator to the set's contents.
+    typedef typename std::set<T>::const_iterator const_iterator;
+
+    //! Unsigned integral type (usually same as size_t).
+    typedef typename std::set<T>::size_type size_type;
+
+    //! The default maximum number of points in a leaf.
+    static const unsigned int defaultMaxLeafSize = 20;
+
+    //! Default constructor. Makes an empty set.
+    NonDominatedTree();
+
+    //! Make an empty set whose leaves keep at most maxLeafSize points.
+    /*!
+     *  \param maxLeafSize The maximum number of points in a leaf. (at
+     *                     least 1)
+     */
+    explicit NonDominatedTree(unsigned int maxLeafSize);
+
+    //! Iteration constructor. (see NonDominatedSet's)
+    template <class InputIterator>
+    NonDominatedTree(InputIterator first, InputIterator last);
+
+    //! Copy constructor.
+    NonDominatedTree(const NonDominatedTree & ndt);
+
+    //! Copy assignment operator.
+    NonDominatedTree & operator= (const NonDominatedTree & ndt);
+
+    //! Destructor. (all the contained elements' destructors will be called)
+    ~NonDominatedTree();
+
+    //! Return iterator to beginning.
+    iterator begin() const;
+
+    //! Return iterator to end.
+    iterator end() const;
+
+    //! Test whether container is empty.
+    bool empty() const;
+
+    //! Returns the number of elements in the container.
+    size_type size() const;
+
+    //! The maximum number of points in a leaf.
+    unsigned int maxLeafSize() const;
+
+    //! Insert element.
+    /*!
+     *  \param t The T instance to insert.
+     *  \return true if the element was actually inserted (was not
+     *          dominated); false otherwise.
+     *
+     *  Same as NonDominatedSet::insert().
+     *
+     *  \sa NonDominatedTree
+     */
+    bool insert(const T & t);
+
+    //! Insert elements. (see NonDominatedSet's)
+    template <class InputIterator>
+    bool insert(InputIterator first, InputIterator last);
+
+    //! Check if some element in the set dominates the given instance.
+    /*!
+     *  \param t A T instance.
+     *  \return true if some element in the set dominates t; false otherwise.
+     *
+     *  Same as NonDominatedSet::dominates().
+     *
+     *  \sa NonDominatedTree
+     */
+    bool dominates(const T & t) const;
+
+    //! Clear content.
+    void clear();
+
+    //! Get iterator to element.
+    /*!
+     *  \param t A T instance.
+     *  \return An iterator to the T element which is equal to t if one
+     *          exists; an iterator to the past-the-end element otherwise.
+     */
+    iterator find(const T & t) const;
+
+  private:
+    //! A node of the ND-tree.
+    struct Node;
+
+    //! Does p weakly dominate q? (\f$ p_{i} \le q_{i} \f$ for all i)
+    static bool isLessOrEqual(const std::vector<double> & p,
+                              const std::vector<double> & q);
+
+    //! Check t against the set's dimension and copy its coordinates.
+    std::vector<double> coordinatesOf(const T & t) const;
+
+    //! Does some point under node dominate q? (t's coordinates)
+    bool dominates(const Node & node, const T & t,
+                   const std::vector<double> & q) const;
+
+    //! Erase the elements under node that q (t's coordinates) dominates.
+    void eraseDominated(Node & node, const T & t,
+                        const std::vector<double> & q);
+
+    //! Erase every element under node. (node becomes an empty leaf)
+    void eraseSubtree(Node & node);
+
+    //! Add the element "it" (with coordinates q) under node.
+    void addToTree(Node & node, iterator it, const std::vector<double> & q);
+
+    //! Split a leaf with more than maxLeafSize_ points.
+    void split(Node & leaf);
+
+    //! Rebuild the tree from contents_.
+    void rebuildTree();
+
+    //! The elements.
+    std::set<T> contents_;
+
+    //! The root of the ND-tree. (an empty leaf if the set is empty)
+    std::unique_ptr<Node> root_;
+
+    //! The elements' dimension. (0 if the set is empty)
+    unsigned int dimension_;
+
+    //! The maximum number of points in a leaf.
+    unsigned int maxLeafSize_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "NonDominatedTree.cpp"
+
+
+#endif  // NON_DOMINATED_TREE_H
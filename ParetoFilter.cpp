@@ -0,0 +1,524 @@
+/*! \file ParetoFilter.cpp
+ *  \brief The implementation of findNonDominatedPoints().
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` ParetoFilter.h. In fact, ParetoFilter.h will `include`
+ *  ParetoFilter.cpp because we want a header-only code base. (that is
+ *  also why every function is declared inline)
+ */
+
+
+#include <assert.h>
+#include <algorithm>
+#include <map>
+#include <functional>
+
+#include "ThreadPool.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+// An unnamed namespace containing the MaximaFinder helper class.
+namespace {
+
+
+//! The parallel filter gives every thread at least this many points.
+const unsigned int minPointsPerThread = 4096;
+
+
+//! Finds the non-dominated points of a set. (see findNonDominatedPoints())
+/*!
+ *  Points are referred to by their index. isDominated(p) is set as
+ *  soon as point p is found to be dominated. (a finder may only look at 
+ *  the points in [firstPoint, lastPoint), e.g. the blocks a parallel 
+ *  merge works on, and its mask only covers them)
+ */
+class MaximaFinder
+{
+  public:
+    //! Make a finder for the given points. (see findNonDominatedPoints())
+    MaximaFinder(const std::vector<double> & coordinates,
+                 unsigned int dimension) :
+                    coordinates_(coordinates), dimension_(dimension),
+                    firstPoint_(0),
+                    isDominated_(coordinates.size() / dimension, false) { }
+
+    //! Make a finder for the points in [firstPoint, lastPoint) only.
+    MaximaFinder(const std::vector<double> & coordinates,
+                 unsigned int dimension, unsigned int firstPoint,
+                 unsigned int lastPoint) :
+                    coordinates_(coordinates), dimension_(dimension),
+                    firstPoint_(firstPoint),
+                    isDominated_(lastPoint - firstPoint, false) { }
+
+    //! The non-dominated points among the given points.
+    std::vector<unsigned int> run(const std::vector<unsigned int> & points);
+
+  private:
+    //! Below this many points (or point pairs) compare every pair.
+    static const unsigned int bruteForceSize = 16;
+
+    //! The i'th coordinate of point p.
+    double x(unsigned int p, unsigned int i) const
+    {
+      return coordinates_[p * dimension_ + i];
+    }
+
+    //! Is p lexicographically less than q?
+    bool lexicographicallyLess(unsigned int p, unsigned int q) const;
+
+    //! Are p and q equal?
+    bool areEqual(unsigned int p, unsigned int q) const;
+
+    //! Is point p known to be dominated? (a reference into isDominated_)
+    std::vector<bool>::reference isDominated(unsigned int p)
+    {
+      return isDominated_[p - firstPoint_];
+    }
+
+    //! Is \f$ p_{i} \le q_{i} \f$ for all \f$ i \ge k \f$?
+    bool dominatesFrom(unsigned int p, unsigned int q, unsigned int k) const;
+
+    //! Mark the points an earlier point dominates; return the rest.
+    std::vector<unsigned int> maxima(
+                                const std::vector<unsigned int> & points);
+
+    //! Mark the points in B that some point in A dominates.
+    void screen(const std::vector<unsigned int> & A,
+                const std::vector<unsigned int> & B, unsigned int k);
+
+    //! screen() for the last two coordinates. (a sweep)
+    void sweep(const std::vector<unsigned int> & A,
+               const std::vector<unsigned int> & B, unsigned int k);
+
+    //! The points' coordinates.
+    const std::vector<double> & coordinates_;
+
+    //! The points' dimension.
+    const unsigned int dimension_;
+
+    //! The first point the finder looks at.
+    const unsigned int firstPoint_;
+
+    //! isDominated_[p - firstPoint_] is true if point p is known to be 
+    //! dominated.
+    std::vector<bool> isDominated_;
+};
+
+
+//! The non-dominated points among the given points.
+/*!
+ *  \param points Some of the points' indices, in increasing order.
+ *  \return The indices of the points in "points" not dominated by any 
+ *          other point in "points". (in increasing order)
+ *  
+ *  Must be called at most once per MaximaFinder.
+ */
+inline
+std::vector<unsigned int>
+MaximaFinder::run(const std::vector<unsigned int> & points)
+{
+  const unsigned int numPoints = points.size();
+
+  // sort the points lexicographically (a stable sort, so that the first
+  // of several equal points comes first) and drop the duplicates
+  // - after that a point can only be dominated by earlier points
+  std::vector<unsigned int> order(points);
+  std::stable_sort(order.begin(), order.end(),
+                   [this](unsigned int p, unsigned int q)
+                   { return lexicographicallyLess(p, q); });
+  std::vector<unsigned int> distinct;
+  distinct.reserve(numPoints);
+  for (unsigned int k = 0; k != numPoints; ++k)
+    if (k != 0 and areEqual(order[k - 1], order[k]))
+      isDominated(order[k]) = true;
+    else
+      distinct.push_back(order[k]);
+
+  if (dimension_ == 1) {
+    // only the smallest point survives
+    for (unsigned int k = 1; k < distinct.size(); ++k)
+      isDominated(distinct[k]) = true;
+  }
+  else if (dimension_ == 2) {
+    // keep the points whose second coordinate is smaller than all the
+    // earlier points'
+    for (unsigned int k = 1; k < distinct.size(); ++k)
+      if (x(distinct[k], 1) >= x(distinct[k - 1], 1)) {
+        isDominated(distinct[k]) = true;
+        // (the minimum so far moves along)
+        distinct[k] = distinct[k - 1];
+      }
+  }
+  else if (dimension_ == 3) {
+    // keep the points not dominated (in their last two coordinates) by
+    // the staircase of the earlier non-dominated points
+    // - staircase maps second coordinates to third coordinates; the
+    //   third coordinates strictly decrease
+    std::map<double, double> staircase;
+    for (unsigned int k = 0; k != distinct.size(); ++k) {
+      const double y = x(distinct[k], 1);
+      const double z = x(distinct[k], 2);
+      std::map<double, double>::iterator it = staircase.upper_bound(y);
+      if (it != staircase.begin() and (--it)->second <= z) {
+        isDominated(distinct[k]) = true;
+        continue;
+      }
+      // else
+      std::map<double, double>::iterator first = staircase.lower_bound(y);
+      std::map<double, double>::iterator last = first;
+      while (last != staircase.end() and last->second >= z)
+        ++last;
+      staircase.erase(first, last);
+      staircase.insert(last, std::make_pair(y, z));
+    }
+  }
+  else
+    maxima(distinct);
+
+  std::vector<unsigned int> result;
+  for (unsigned int k = 0; k != numPoints; ++k)
+    if (not isDominated(points[k]))
+      result.push_back(points[k]);
+
+  return result;
+}
+
+
+//! Is p lexicographically less than q?
+inline
+bool
+MaximaFinder::lexicographicallyLess(unsigned int p, unsigned int q) const
+{
+  for (unsigned int i = 0; i != dimension_; ++i)
+    if (x(p, i) != x(q, i))
+      return x(p, i) < x(q, i);
+
+  return false;
+}
+
+
+//! Are p and q equal?
+inline
+bool
+MaximaFinder::areEqual(unsigned int p, unsigned int q) const
+{
+  for (unsigned int i = 0; i != dimension_; ++i)
+    if (x(p, i) != x(q, i))
+      return false;
+
+  return true;
+}
+
+
+//! Is \f$ p_{i} \le q_{i} \f$ for all \f$ i \ge k \f$?
+inline
+bool
+MaximaFinder::dominatesFrom(unsigned int p, unsigned int q,
+                            unsigned int k) const
+{
+  for (unsigned int i = k; i != dimension_; ++i)
+    if (x(p, i) > x(q, i))
+      return false;
+
+  return true;
+}
+
+
+//! Mark the points an earlier point dominates; return the rest.
+/*!
+ *  \param points Distinct points, sorted lexicographically.
+ *  \return The points not dominated by an earlier point. (in the same
+ *          order)
+ *
+ *  Splits the points in half; the second half's survivors are screened
+ *  against the first half's in the last (dimension - 1) coordinates,
+ *  since the first coordinates are already in order.
+ */
+inline
+std::vector<unsigned int>
+MaximaFinder::maxima(const std::vector<unsigned int> & points)
+{
+  if (points.size() <= bruteForceSize) {
+    std::vector<unsigned int> result;
+    for (unsigned int k = 0; k != points.size(); ++k) {
+      for (unsigned int j = 0; j != result.size(); ++j)
+        if (dominatesFrom(result[j], points[k], 0)) {
+          isDominated(points[k]) = true;
+          break;
+        }
+      if (not isDominated(points[k]))
+        result.push_back(points[k]);
+    }
+    return result;
+  }
+  // else
+
+  std::vector<unsigned int>::const_iterator middle = points.begin() +
+                                                     points.size() / 2;
+  std::vector<unsigned int> result =
+        maxima(std::vector<unsigned int>(points.begin(), middle));
+  std::vector<unsigned int> secondHalf =
+        maxima(std::vector<unsigned int>(middle, points.end()));
+  screen(result, secondHalf, 1);
+  for (unsigned int k = 0; k != secondHalf.size(); ++k)
+    if (not isDominated(secondHalf[k]))
+      result.push_back(secondHalf[k]);
+
+  return result;
+}
+
+
+//! Mark the points in B that some point in A dominates.
+/*!
+ *  \param A Some points.
+ *  \param B Some points.
+ *  \param k Every point in A has its first k coordinates less than or
+ *           equal to every point in B's.
+ *
+ *  Splits A and B around the median of their k'th coordinates:
+ *  - the low part of A against the low part of B, (same k)
+ *  - the high part of A against the high part of B, (same k)
+ *  - the low part of A against the high part of B. (k + 1, the k'th
+ *    coordinates are in order)
+ *  The high part of A cannot dominate the low part of B.
+ */
+inline
+void
+MaximaFinder::screen(const std::vector<unsigned int> & A,
+                     const std::vector<unsigned int> & B, unsigned int k)
+{
+  if (A.empty() or B.empty())
+    return;
+  // else
+
+  if (k == dimension_ - 1) {
+    // one coordinate left
+    double minimum = x(A.front(), k);
+    for (unsigned int j = 1; j != A.size(); ++j)
+      minimum = std::min(minimum, x(A[j], k));
+    for (unsigned int j = 0; j != B.size(); ++j)
+      if (x(B[j], k) >= minimum)
+        isDominated(B[j]) = true;
+    return;
+  }
+  // else
+  if (A.size() * B.size() <= bruteForceSize * bruteForceSize) {
+    for (unsigned int j = 0; j != B.size(); ++j)
+      for (unsigned int i = 0; i != A.size() and not isDominated(B[j]); ++i)
+        if (dominatesFrom(A[i], B[j], k))
+          isDominated(B[j]) = true;
+    return;
+  }
+  // else
+  if (k == dimension_ - 2) {
+    sweep(A, B, k);
+    return;
+  }
+  // else
+
+  std::vector<double> values;
+  values.reserve(A.size() + B.size());
+  for (unsigned int j = 0; j != A.size(); ++j)
+    values.push_back(x(A[j], k));
+  for (unsigned int j = 0; j != B.size(); ++j)
+    values.push_back(x(B[j], k));
+  const double minimum = *std::min_element(values.begin(), values.end());
+  const double maximum = *std::max_element(values.begin(), values.end());
+  if (minimum == maximum) {
+    // the k'th coordinates are all equal
+    screen(A, B, k + 1);
+    return;
+  }
+  // else
+
+  std::nth_element(values.begin(), values.begin() + values.size() / 2,
+                   values.end());
+  const double median = values[values.size() / 2];
+  // split into (<= median) and (> median), or, if that leaves the high
+  // part empty, into (< median) and (>= median)
+  // - either way both parts are non-empty
+  const bool lowIncludesMedian = (median != maximum);
+  std::vector<unsigned int> lowA, highA, lowB, highB;
+  for (unsigned int j = 0; j != A.size(); ++j)
+    if (x(A[j], k) < median or (lowIncludesMedian and x(A[j], k) == median))
+      lowA.push_back(A[j]);
+    else
+      highA.push_back(A[j]);
+  for (unsigned int j = 0; j != B.size(); ++j)
+    if (isDominated(B[j]))
+      continue;
+    else if (x(B[j], k) < median or
+             (lowIncludesMedian and x(B[j], k) == median))
+      lowB.push_back(B[j]);
+    else
+      highB.push_back(B[j]);
+
+  screen(lowA, lowB, k);
+  screen(highA, highB, k);
+  screen(lowA, highB, k + 1);
+}
+
+
+//! screen() for the last two coordinates. (a sweep)
+/*!
+ *  Goes through A and B in order of their k'th coordinates (A's points
+ *  first on ties) and marks the B points whose (k + 1)'th coordinate is
+ *  not less than the smallest one in A so far.
+ */
+inline
+void
+MaximaFinder::sweep(const std::vector<unsigned int> & A,
+                    const std::vector<unsigned int> & B, unsigned int k)
+{
+  assert(k + 2 == dimension_);
+
+  // (point, is it in B?)
+  std::vector< std::pair<unsigned int, bool> > events;
+  events.reserve(A.size() + B.size());
+  for (unsigned int j = 0; j != A.size(); ++j)
+    events.push_back(std::make_pair(A[j], false));
+  for (unsigned int j = 0; j != B.size(); ++j)
+    events.push_back(std::make_pair(B[j], true));
+  std::sort(events.begin(), events.end(),
+            [this, k](const std::pair<unsigned int, bool> & e,
+                      const std::pair<unsigned int, bool> & f)
+            {
+              if (x(e.first, k) != x(f.first, k))
+                return x(e.first, k) < x(f.first, k);
+              return (not e.second and f.second);
+            });
+
+  bool seenA = false;
+  double minimum = 0.0;
+  for (unsigned int j = 0; j != events.size(); ++j) {
+    const unsigned int p = events[j].first;
+    if (not events[j].second) {
+      minimum = seenA ? std::min(minimum, x(p, k + 1)) : x(p, k + 1);
+      seenA = true;
+    }
+    else if (seenA and x(p, k + 1) >= minimum)
+      isDominated(p) = true;
+  }
+}
+
+
+}  // namespace
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Find the non-dominated points among the given points.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *                     (the i'th coordinate of point k is
+ *                     coordinates[k * dimension + i])
+ *  \param dimension The points' dimension. (at least 1)
+ *  \return The (increasing) indices of the points not dominated by any
+ *          other point. Of several equal points only the first is kept.
+ *
+ *  \sa ParetoFilter.h
+ */
+inline
+std::vector<unsigned int>
+findNonDominatedPoints(const std::vector<double> & coordinates,
+                       unsigned int dimension)
+{
+  assert(dimension > 0 and coordinates.size() % dimension == 0);
+
+  std::vector<unsigned int> points(coordinates.size() / dimension);
+  for (unsigned int p = 0; p != points.size(); ++p)
+    points[p] = p;
+  MaximaFinder finder(coordinates, dimension);
+  return finder.run(points);
+}
+
+
+//! Find the non-dominated points among the given points, in parallel.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *  \param dimension The points' dimension. (at least 1)
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  \return The (increasing) indices of the points not dominated by any
+ *          other point. Of several equal points only the first is kept.
+ *  
+ *  \sa ParetoFilter.h
+ */
+inline
+std::vector<unsigned int>
+findNonDominatedPoints(const std::vector<double> & coordinates,
+                       unsigned int dimension, unsigned int numThreads)
+{
+  assert(dimension > 0 and coordinates.size() % dimension == 0);
+  assert(numThreads >= 1);
+
+  const unsigned int numPoints = coordinates.size() / dimension;
+  const unsigned int numParts = std::min(numThreads, 
+                                         numPoints / minPointsPerThread);
+  if (numParts <= 1)
+    return findNonDominatedPoints(coordinates, dimension);
+  // else
+
+  // fronts[j] are the non-dominated points of the j'th part; neighbouring 
+  // fronts are merged until one is left
+  // - the parts are contiguous, so concatenating two neighbouring fronts 
+  //   keeps the indices increasing
+  std::vector< std::vector<unsigned int> > fronts(numParts);
+  for (unsigned int j = 0; j != numParts; ++j) {
+    unsigned int begin = static_cast<unsigned long>(numPoints) * j / numParts;
+    unsigned int end = static_cast<unsigned long>(numPoints) * (j + 1) / 
+                       numParts;
+    for (unsigned int p = begin; p != end; ++p)
+      fronts[j].push_back(p);
+  }
+
+  ThreadPool pool(numParts);
+  std::vector<ThreadPool::Task> tasks;
+  for (unsigned int j = 0; j != numParts; ++j)
+    tasks.push_back([&coordinates, dimension, &fronts, j]()
+                    {
+                      MaximaFinder finder(coordinates, dimension, 
+                                          fronts[j].front(), 
+                                          fronts[j].back() + 1);
+                      fronts[j] = finder.run(fronts[j]);
+                    });
+  pool.run(tasks);
+
+  while (fronts.size() > 1) {
+    std::vector< std::vector<unsigned int> > merged((fronts.size() + 1) / 2);
+    tasks.clear();
+    for (unsigned int j = 0; j != merged.size(); ++j)
+      tasks.push_back([&coordinates, dimension, &fronts, &merged, j]()
+                      {
+                        merged[j].swap(fronts[2 * j]);
+                        if (2 * j + 1 == fronts.size())
+                          return;
+                        // else
+                        merged[j].insert(merged[j].end(), 
+                                         fronts[2 * j + 1].begin(), 
+                                         fronts[2 * j + 1].end());
+                        // (the mask only covers the merged blocks)
+                        MaximaFinder finder(coordinates, dimension, 
+                                            merged[j].front(), 
+                                            merged[j].back() + 1);
+                        merged[j] = finder.run(merged[j]);
+                      });
+    pool.run(tasks);
+    fronts.swap(merged);
+  }
+
+  return fronts.front();
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
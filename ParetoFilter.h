@@ -0,0 +1,99 @@
+/*! \file ParetoFilter.h
+ *  \brief The declaration of findNonDominatedPoints(), which finds the
+ *         non-dominated points of a set in O(n log n) time. (for two or
+ *         three dimensions, optionally in parallel)
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_PARETO_FILTER_H
+#define PARETO_APPROXIMATOR_PARETO_FILTER_H
+
+
+#include <vector>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Find the non-dominated points among the given points.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *                     (the i'th coordinate of point k is
+ *                     coordinates[k * dimension + i])
+ *  \param dimension The points' dimension. (at least 1)
+ *  \return The (increasing) indices of the points not dominated by any
+ *          other point. Of several equal points only the first is kept.
+ *
+ *  Point p dominates point q if \f$ p_{i} \le q_{i} \f$ for all i, i.e.
+ *  the result is what inserting the points one by one (in order) into a
+ *  NonDominatedSet would keep.
+ *
+ *  Sorts the points lexicographically and then:
+ *  - in one dimension keeps the smallest point,
+ *  - in two dimensions sweeps them, keeping the points whose second
+ *    coordinate is smaller than every earlier point's, (O(n log n))
+ *  - in three dimensions sweeps them, keeping the points not dominated
+ *    (in their last two coordinates) by the staircase of the earlier
+ *    non-dominated points, (O(n log n))
+ *  - in four or more dimensions uses Kung's divide-and-conquer maxima
+ *    algorithm. (\f$ O(n \log^{d-2} n) \f$ in d dimensions; see H. T.
+ *    Kung, F. Luccio and F. P. Preparata, "On finding the maxima of a set
+ *    of vectors", Journal of the ACM, 1975)
+ *
+ *  The coordinates are not checked. (e.g. for positivity)
+ *
+ *  \sa NonDominatedSet
+ */
+std::vector<unsigned int>
+findNonDominatedPoints(const std::vector<double> & coordinates,
+                       unsigned int dimension);
+
+
+//! Find the non-dominated points among the given points, in parallel.
+/*!
+ *  \param coordinates The points' coordinates, one point after the other.
+ *                     (the i'th coordinate of point k is
+ *                     coordinates[k * dimension + i])
+ *  \param dimension The points' dimension. (at least 1)
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  \return The (increasing) indices of the points not dominated by any
+ *          other point. Of several equal points only the first is kept.
+ *
+ *  Splits the points into numThreads contiguous parts, finds each part's
+ *  non-dominated points (see the two-argument findNonDominatedPoints())
+ *  in its own thread and then merges neighbouring parts' non-dominated
+ *  points, pairwise and in parallel, until one set is left. (a reduction
+ *  tree)
+ *
+ *  The result is exactly that of the two-argument findNonDominatedPoints(),
+ *  whatever the number of threads. Uses fewer threads if there are not
+ *  enough points (a few thousand per thread) to make it worthwhile.
+ *
+ *  \sa ThreadPool
+ */
+std::vector<unsigned int>
+findNonDominatedPoints(const std::vector<double> & coordinates,
+                       unsigned int dimension, unsigned int numThreads);
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we want a
+// header-only code base.
+#include "ParetoFilter.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_PARETO_FILTER_H
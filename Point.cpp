@@ -799,14 +799,7 @@ Point::ratioDistance(const Point & q) const
     throw exception_classes::NotStrictlyPositivePointException();
   // else
 
-  double max = 0.0;
-  for (unsigned int i=0; i<dimension(); ++i) {
-    double r = (q[i] - coordinates_[i]) / coordinates_[i];
-    if (r > max) 
-      max = r;
-  }
-
-  return max;
+  return ratioDistanceUnchecked(q);
 }
 
 
@@ -845,15 +838,7 @@ Point::additiveDistance(const Point & q) const
     throw exception_classes::DifferentDimensionsException();
   // else 
 
-  double minEpsilon = 0.0;
-  for (unsigned int i=0; i<dimension(); ++i) {
-    double d = q[i] - coordinates_[i];
-    if (d > minEpsilon)
-      // in here only when d > minEpsilon and d > 0.0
-      minEpsilon = d;
-  }
-
-  return minEpsilon;
+  return additiveDistanceUnchecked(q);
 }
 
 
@@ -941,11 +926,7 @@ Point::dominatesAdditive(const Point & q, double eps) const
     throw exception_classes::NotPositivePointException();
   // else
 
-  for (unsigned int i=0; i<dimension(); ++i)
-    if (coordinates_[i] > q[i] + eps)
-      return false;
-
-  return true;
+  return dominatesAdditiveUnchecked(q, eps);
 }
 
 
@@ -992,9 +973,158 @@ Point::dominatesMultiplicative(const Point & q, double eps) const
     throw exception_classes::NotStrictlyPositivePointException();
   // else
 
-  double r = 1+eps;
-  for (unsigned int i=0; i<dimension(); ++i) 
-    if (coordinates_[i] > r * q[i])
+  return dominatesMultiplicativeUnchecked(q, eps);
+}
+
+
+// (the unchecked methods are declared inline, so that the loops calling 
+// them can inline them)
+
+
+//! The access coordinate operator without the checks.
+/*! 
+ *  \param pos The position (coordinate) to access. 
+ *             (0 <= pos < dimension(); only assert()ed)
+ *  \return The Point's "pos" coordinate.
+ *  
+ *  \sa Point and operator[]()
+ */
+inline
+double 
+Point::coordinateUnchecked(unsigned int pos) const
+{
+  assert(pos < coordinates_.size());
+
+  return coordinates_[pos];
+}
+
+
+//! ratioDistance() without the checks.
+/*!
+ *  \param q A Point instance.
+ *  \return The ratio distance from the current Point instance (*this) 
+ *          to q.
+ *  
+ *  Both points must be non-null, strictly positive and of the same 
+ *  dimension. (only assert()ed)
+ *  
+ *  \sa Point::ratioDistance()
+ */
+inline
+double 
+Point::ratioDistanceUnchecked(const Point & q) const
+{
+  assert(not isNull() and not q.isNull());
+  assert(dimension() == q.dimension());
+
+  const double * p = coordinates_.data();
+  const double * r = q.coordinates_.data();
+  double max = 0.0;
+  for (unsigned int i = 0; i != coordinates_.size(); ++i) {
+    double d = (r[i] - p[i]) / p[i];
+    if (d > max) 
+      max = d;
+  }
+
+  return max;
+}
+
+
+//! additiveDistance() without the checks.
+/*!
+ *  \param q A Point instance.
+ *  \return The additive distance from the current Point instance 
+ *          (*this) to q.
+ *  
+ *  Both points must be non-null and of the same dimension. (only 
+ *  assert()ed)
+ *  
+ *  \sa Point::additiveDistance()
+ */
+inline
+double 
+Point::additiveDistanceUnchecked(const Point & q) const
+{
+  assert(not isNull() and not q.isNull());
+  assert(dimension() == q.dimension());
+
+  const double * p = coordinates_.data();
+  const double * r = q.coordinates_.data();
+  double minEpsilon = 0.0;
+  for (unsigned int i = 0; i != coordinates_.size(); ++i) {
+    double d = r[i] - p[i];
+    if (d > minEpsilon)
+      // in here only when d > minEpsilon and d > 0.0
+      minEpsilon = d;
+  }
+
+  return minEpsilon;
+}
+
+
+//! dominates() without the checks.
+/*!
+ *  \param q A Point instance.
+ *  \param eps An approximation parameter. (\f$ \epsilon \ge 0 \f$)
+ *  \return true if p eps-covers q; false otherwise.
+ *  
+ *  Currently using the additive error measure, like dominates().
+ *  
+ *  \sa Point::dominates() and Point::dominatesAdditiveUnchecked()
+ */
+inline
+bool 
+Point::dominatesUnchecked(const Point & q, double eps) const
+{
+  return dominatesAdditiveUnchecked(q, eps);
+}
+
+
+//! dominatesAdditive() without the checks.
+/*!
+ *  Both points must be non-null, positive and of the same dimension and 
+ *  eps must not be negative. (only assert()ed)
+ *  
+ *  \sa Point::dominatesAdditive()
+ */
+inline
+bool 
+Point::dominatesAdditiveUnchecked(const Point & q, double eps) const
+{
+  assert(not isNull() and not q.isNull());
+  assert(dimension() == q.dimension());
+  assert(eps >= 0.0);
+
+  const double * p = coordinates_.data();
+  const double * r = q.coordinates_.data();
+  for (unsigned int i = 0; i != coordinates_.size(); ++i)
+    if (p[i] > r[i] + eps)
+      return false;
+
+  return true;
+}
+
+
+//! dominatesMultiplicative() without the checks.
+/*!
+ *  Both points must be non-null, strictly positive and of the same 
+ *  dimension and eps must not be negative. (only assert()ed)
+ *  
+ *  \sa Point::dominatesMultiplicative()
+ */
+inline
+bool 
+Point::dominatesMultiplicativeUnchecked(const Point & q, double eps) const
+{
+  assert(not isNull() and not q.isNull());
+  assert(dimension() == q.dimension());
+  assert(eps >= 0.0);
+
+  const double * p = coordinates_.data();
+  const double * r = q.coordinates_.data();
+  const double ratio = 1 + eps;
+  for (unsigned int i = 0; i != coordinates_.size(); ++i) 
+    if (p[i] > ratio * r[i])
       return false;
 
   return true;
@@ -251,6 +251,18 @@ class Point {
      */
     double operator[] (unsigned int pos) const;
 
+    //! The access coordinate operator without the checks.
+    /*! 
+     *  \param pos The position (coordinate) to access. 
+     *             (0 <= pos < dimension(); only assert()ed)
+     *  \return The Point's "pos" coordinate.
+     *  
+     *  Same as operator[](), only it never throws.
+     *  
+     *  \sa Point and operator[]()
+     */
+    double coordinateUnchecked(unsigned int pos) const;
+
     //! The Point equality operator.
     /*! 
      *  \param p A Point instance we want to compare with the current instance.
@@ -590,6 +602,63 @@ class Point {
      */
     bool dominatesMultiplicative(const Point & q, double eps=0.0) const;
 
+    //! ratioDistance() without the checks.
+    /*!
+     *  \param q A Point instance.
+     *  \return The ratio distance from the current Point instance (*this) 
+     *          to q.
+     *  
+     *  Same as ratioDistance(), only it does not check its arguments and 
+     *  never throws: both points must be non-null, strictly positive and 
+     *  of the same dimension. (only assert()ed) Meant for internal loops 
+     *  (Chord, PGEN, NonDominatedSet etc) where that is already known.
+     *  
+     *  \sa Point::ratioDistance()
+     */
+    double ratioDistanceUnchecked(const Point & q) const;
+
+    //! additiveDistance() without the checks.
+    /*!
+     *  \param q A Point instance.
+     *  \return The additive distance from the current Point instance 
+     *          (*this) to q.
+     *  
+     *  Same as additiveDistance(), only it does not check its arguments 
+     *  and never throws: both points must be non-null and of the same 
+     *  dimension. (only assert()ed)
+     *  
+     *  \sa Point::additiveDistance()
+     */
+    double additiveDistanceUnchecked(const Point & q) const;
+
+    //! dominates() without the checks.
+    /*!
+     *  \param q A Point instance.
+     *  \param eps An approximation parameter. (\f$ \epsilon \ge 0 \f$)
+     *  \return true if p eps-covers q; false otherwise.
+     *  
+     *  Same as dominates(), only it does not check its arguments and never 
+     *  throws: both points must be non-null, positive and of the same 
+     *  dimension. (only assert()ed)
+     *  
+     *  \sa Point::dominates() and Point::dominatesAdditiveUnchecked()
+     */
+    bool dominatesUnchecked(const Point & q, double eps=0.0) const;
+
+    //! dominatesAdditive() without the checks. (see dominatesUnchecked())
+    bool dominatesAdditiveUnchecked(const Point & q, double eps=0.0) const;
+
+    //! dominatesMultiplicative() without the checks.
+    /*!
+     *  Same as dominatesMultiplicative(), only it does not check its 
+     *  arguments and never throws: both points must be non-null, strictly 
+     *  positive and of the same dimension. (only assert()ed)
+     *  
+     *  \sa Point::dominatesMultiplicative()
+     */
+    bool dominatesMultiplicativeUnchecked(const Point & q, 
+                                          double eps=0.0) const;
+
     //! The Point output stream operator. A friend of the Point class.
     /*! 
      *  The Point instance's coordinates will be output separated by spaces. 
@@ -9,6 +9,9 @@
  */
 
 
+#include <utility>
+
+
 /*!
  *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
  *  @{
@@ -50,6 +53,26 @@ PointAndSolution<S>::PointAndSolution(const Point & p, const S & s,
 }
 
 
+//! \brief A constructor initializing all attributes except weightsUsed. 
+//!        (moves the solution)
+template <class S> 
+PointAndSolution<S>::PointAndSolution(const Point & p, S && s) : 
+                              point(p), solution(std::move(s)), 
+                              _isNull(false) { }
+
+
+//! A constructor initializing PointAndSolution's attributes. (moves the solution)
+template <class S> 
+PointAndSolution<S>::PointAndSolution(const Point & p, S && s, 
+                             std::vector<double>::const_iterator first,
+                             std::vector<double>::const_iterator last) :
+                                point(p), solution(std::move(s)), 
+                                _isNull(false)
+{
+  weightsUsed.assign(first, last);
+}
+
+
 //! PointAndSolution's default destructor. (empty)
 template <class S> 
 PointAndSolution<S>::~PointAndSolution() { }
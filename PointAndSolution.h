@@ -86,6 +86,10 @@ namespace pareto_approximator {
  *  Users do not have to set the weights themselves (inside comb()) - it 
  *  will be done automatically after comb() returns.
  *  
+ *  S may be a move-only type. comb() should then move its solution into 
+ *  the PointAndSolution it returns (see PointAndSolution(const Point &, 
+ *  S &&)); computeConvexParetoSet() never copies solutions.
+ *  
  *  \sa PointAndSolution(), ~PointAndSolution() and operator<()
  */
 template <class S> 
@@ -120,6 +124,33 @@ class PointAndSolution
                      std::vector<double>::const_iterator first,
                      std::vector<double>::const_iterator last);
 
+    //! \brief A constructor initializing all attributes except weightsUsed. 
+    //!        (moves the solution)
+    PointAndSolution(const Point & p, S && s);
+
+    //! A constructor initializing PointAndSolution's attributes. (moves the solution)
+    /*! 
+     *  Same as PointAndSolution(const Point &, const S &, 
+     *  std::vector<double>::const_iterator, 
+     *  std::vector<double>::const_iterator) but moves s instead of 
+     *  copying it. (S may be a move-only type)
+     */
+    PointAndSolution(const Point & p, S && s, 
+                     std::vector<double>::const_iterator first,
+                     std::vector<double>::const_iterator last);
+
+    //! The copy constructor. (copies the solution)
+    PointAndSolution(const PointAndSolution & pas) = default;
+
+    //! The move constructor. (moves the solution)
+    PointAndSolution(PointAndSolution && pas) = default;
+
+    //! The copy assignment operator. (copies the solution)
+    PointAndSolution & operator= (const PointAndSolution & pas) = default;
+
+    //! The move assignment operator. (moves the solution)
+    PointAndSolution & operator= (PointAndSolution && pas) = default;
+
     //! \brief PointAndSolution's default destructor. (empty)
     ~PointAndSolution();
 
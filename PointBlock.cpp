@@ -0,0 +1,706 @@
+/*! \file PointBlock.cpp
+ *  \brief The implementation of the PointBlock class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` PointBlock.h. In fact, PointBlock.h will `include`
+ *  PointBlock.cpp because we want a header-only code base. (that is also
+ *  why every method is declared inline)
+ */
+
+
+#include <assert.h>
+#include <algorithm>
+#include <atomic>
+
+#include "NullObjectException.h"
+#include "DifferentDimensionsException.h"
+#include "NotStrictlyPositivePointException.h"
+
+
+// Use the AVX2 kernels on x86 CPUs that have AVX2. (GCC and Clang only,
+// since we need the target attribute and __builtin_cpu_supports())
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(PARETO_APPROXIMATOR_NO_SIMD)
+#define PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+#include <immintrin.h>
+#endif
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! The PointBlock kernels. (implementation details)
+/*!
+ *  - columns[i][k] is the i'th coordinate of the k'th point
+ *  - each kernel works on the points first, first+1, ..., last-1
+ *
+ *  A named namespace (and inline functions, like the rest of the
+ *  header-only code base) since PointBlock's inline methods call them
+ *  from every translation unit.
+ */
+namespace detail {
+
+
+//! Does some point dominate q? (plain loops)
+inline
+bool
+someDominatesScalar(const std::vector< std::vector<double> > & columns,
+                    unsigned int first, unsigned int last,
+                    unsigned int dimension, const double * q, double eps)
+{
+  for (unsigned int k = first; k != last; ++k) {
+    bool dominates = true;
+    for (unsigned int i = 0; i != dimension and dominates; ++i)
+      dominates = (columns[i][k] <= q[i] + eps);
+    if (dominates)
+      return true;
+  }
+
+  return false;
+}
+
+
+//! Append the indices of the points q dominates to "result". (plain loops)
+inline
+void
+dominatedByScalar(const std::vector< std::vector<double> > & columns,
+                  unsigned int first, unsigned int last,
+                  unsigned int dimension, const double * q, double eps,
+                  std::vector<unsigned int> & result)
+{
+  for (unsigned int k = first; k != last; ++k) {
+    bool dominated = true;
+    for (unsigned int i = 0; i != dimension and dominated; ++i)
+      dominated = (q[i] <= columns[i][k] + eps);
+    if (dominated)
+      result.push_back(k);
+  }
+}
+
+
+//! The additive distances from q to the points. (plain loops)
+inline
+void
+additiveDistancesScalar(const std::vector< std::vector<double> > & columns,
+                        unsigned int first, unsigned int last,
+                        unsigned int dimension, const double * q,
+                        double * result)
+{
+  for (unsigned int k = first; k != last; ++k) {
+    double distance = 0.0;
+    for (unsigned int i = 0; i != dimension; ++i)
+      distance = std::max(distance, columns[i][k] - q[i]);
+    result[k] = distance;
+  }
+}
+
+
+//! The ratio distances from q to the points. (plain loops)
+inline
+void
+ratioDistancesScalar(const std::vector< std::vector<double> > & columns,
+                     unsigned int first, unsigned int last,
+                     unsigned int dimension, const double * q,
+                     double * result)
+{
+  for (unsigned int k = first; k != last; ++k) {
+    double distance = 0.0;
+    for (unsigned int i = 0; i != dimension; ++i)
+      distance = std::max(distance, (columns[i][k] - q[i]) / q[i]);
+    result[k] = distance;
+  }
+}
+
+
+//! The points' dot products with v. (plain loops)
+inline
+void
+dotProductsScalar(const std::vector< std::vector<double> > & columns,
+                  unsigned int first, unsigned int last,
+                  unsigned int dimension, const double * v,
+                  double * result)
+{
+  for (unsigned int k = first; k != last; ++k) {
+    double dotProduct = 0.0;
+    for (unsigned int i = 0; i != dimension; ++i)
+      dotProduct += v[i] * columns[i][k];
+    result[k] = dotProduct;
+  }
+}
+
+
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+
+
+//! Does the CPU have AVX2?
+inline
+bool
+cpuHasAvx2()
+{
+  static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+  return hasAvx2;
+}
+
+
+//! Does some point dominate q? (AVX2, four points at a time)
+/*!
+ *  Returns the number of points it checked in "checked" (a multiple of
+ *  four); the caller checks the rest.
+ */
+inline
+__attribute__((target("avx2")))
+bool
+someDominatesAvx2(const std::vector< std::vector<double> > & columns,
+                  unsigned int size, unsigned int dimension,
+                  const double * q, double eps, unsigned int & checked)
+{
+  unsigned int k = 0;
+  for ( ; k + 4 <= size; k += 4) {
+    __m256d dominates = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    for (unsigned int i = 0; i != dimension; ++i) {
+      __m256d p = _mm256_loadu_pd(&columns[i][k]);
+      __m256d bound = _mm256_set1_pd(q[i] + eps);
+      dominates = _mm256_and_pd(dominates,
+                                _mm256_cmp_pd(p, bound, _CMP_LE_OQ));
+    }
+    if (_mm256_movemask_pd(dominates) != 0) {
+      checked = k + 4;
+      return true;
+    }
+  }
+
+  checked = k;
+  return false;
+}
+
+
+//! Append the indices of the points q dominates to "result". (AVX2)
+/*!
+ *  \return The number of points it checked. (a multiple of four)
+ */
+inline
+__attribute__((target("avx2")))
+unsigned int
+dominatedByAvx2(const std::vector< std::vector<double> > & columns,
+                unsigned int size, unsigned int dimension,
+                const double * q, double eps,
+                std::vector<unsigned int> & result)
+{
+  __m256d epsilon = _mm256_set1_pd(eps);
+  unsigned int k = 0;
+  for ( ; k + 4 <= size; k += 4) {
+    __m256d dominated = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    for (unsigned int i = 0; i != dimension; ++i) {
+      __m256d bound = _mm256_add_pd(_mm256_loadu_pd(&columns[i][k]),
+                                    epsilon);
+      dominated = _mm256_and_pd(dominated,
+                                _mm256_cmp_pd(_mm256_set1_pd(q[i]), bound,
+                                              _CMP_LE_OQ));
+    }
+    int mask = _mm256_movemask_pd(dominated);
+    for (unsigned int j = 0; j != 4; ++j)
+      if (mask & (1 << j))
+        result.push_back(k + j);
+  }
+
+  return k;
+}
+
+
+//! The additive distances from q to the points. (AVX2)
+/*!
+ *  \return The number of points it computed. (a multiple of four)
+ */
+inline
+__attribute__((target("avx2")))
+unsigned int
+additiveDistancesAvx2(const std::vector< std::vector<double> > & columns,
+                      unsigned int size, unsigned int dimension,
+                      const double * q, double * result)
+{
+  unsigned int k = 0;
+  for ( ; k + 4 <= size; k += 4) {
+    __m256d distance = _mm256_setzero_pd();
+    for (unsigned int i = 0; i != dimension; ++i) {
+      __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(&columns[i][k]),
+                                         _mm256_set1_pd(q[i]));
+      // (same operand order as std::max(distance, difference))
+      distance = _mm256_max_pd(difference, distance);
+    }
+    _mm256_storeu_pd(result + k, distance);
+  }
+
+  return k;
+}
+
+
+//! The ratio distances from q to the points. (AVX2)
+/*!
+ *  \return The number of points it computed. (a multiple of four)
+ */
+inline
+__attribute__((target("avx2")))
+unsigned int
+ratioDistancesAvx2(const std::vector< std::vector<double> > & columns,
+                   unsigned int size, unsigned int dimension,
+                   const double * q, double * result)
+{
+  unsigned int k = 0;
+  for ( ; k + 4 <= size; k += 4) {
+    __m256d distance = _mm256_setzero_pd();
+    for (unsigned int i = 0; i != dimension; ++i) {
+      __m256d qi = _mm256_set1_pd(q[i]);
+      __m256d ratio = _mm256_div_pd(
+                          _mm256_sub_pd(_mm256_loadu_pd(&columns[i][k]), qi),
+                          qi);
+      distance = _mm256_max_pd(ratio, distance);
+    }
+    _mm256_storeu_pd(result + k, distance);
+  }
+
+  return k;
+}
+
+
+//! The points' dot products with v. (AVX2)
+/*!
+ *  \return The number of points it computed. (a multiple of four)
+ *
+ *  Multiplies and adds separately (no FMA) so that the results are the
+ *  same as dotProductsScalar()'s.
+ */
+inline
+__attribute__((target("avx2")))
+unsigned int
+dotProductsAvx2(const std::vector< std::vector<double> > & columns,
+                unsigned int size, unsigned int dimension,
+                const double * v, double * result)
+{
+  unsigned int k = 0;
+  for ( ; k + 4 <= size; k += 4) {
+    __m256d dotProduct = _mm256_setzero_pd();
+    for (unsigned int i = 0; i != dimension; ++i)
+      dotProduct = _mm256_add_pd(dotProduct,
+                                 _mm256_mul_pd(_mm256_set1_pd(v[i]),
+                                               _mm256_loadu_pd(&columns[i][k])));
+    _mm256_storeu_pd(result + k, dotProduct);
+  }
+
+  return k;
+}
+
+
+#endif  // PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+
+
+}  // namespace detail
+
+
+//! Make an empty block. (its dimension will be the first point's)
+inline
+PointBlock::PointBlock() : dimension_(0), size_(0) { }
+
+
+//! Make an empty block for points of the given dimension.
+inline
+PointBlock::PointBlock(unsigned int dimension) : dimension_(dimension),
+                                                 size_(0),
+                                                 columns_(dimension) { }
+
+
+//! Destructor. (empty)
+inline
+PointBlock::~PointBlock() { }
+
+
+//! The dimension of the block's points. (0 if not known yet)
+inline
+unsigned int
+PointBlock::dimension() const
+{
+  return dimension_;
+}
+
+
+//! The number of points in the block.
+inline
+unsigned int
+PointBlock::size() const
+{
+  return size_;
+}
+
+
+//! Is the block empty?
+inline
+bool
+PointBlock::empty() const
+{
+  return size_ == 0;
+}
+
+
+//! The i'th coordinate of the k'th point.
+inline
+double
+PointBlock::coordinate(unsigned int k, unsigned int i) const
+{
+  assert(k < size_ and i < dimension_);
+
+  return columns_[i][k];
+}
+
+
+//! The k'th point, as a Point instance.
+inline
+Point
+PointBlock::point(unsigned int k) const
+{
+  assert(k < size_);
+
+  std::vector<double> coordinates(dimension_);
+  for (unsigned int i = 0; i != dimension_; ++i)
+    coordinates[i] = columns_[i][k];
+
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+//! Append a point.
+/*!
+ *  \param p A Point (or FixedPoint) instance.
+ *
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if p is null.
+ *  - May throw a DifferentDimensionsException exception if p's dimension
+ *    is not the block's.
+ */
+template <class P>
+inline
+void
+PointBlock::push_back(const P & p)
+{
+  // (Point::dimension() throws a NullObjectException for null points)
+  if (dimension_ == 0) {
+    dimension_ = p.dimension();
+    columns_.resize(dimension_);
+  }
+  else if (p.dimension() != dimension_)
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  for (unsigned int i = 0; i != dimension_; ++i)
+    columns_[i].push_back(p[i]);
+  ++size_;
+}
+
+
+//! Erase the k'th point. (the last point takes its place)
+inline
+void
+PointBlock::erase(unsigned int k)
+{
+  assert(k < size_);
+
+  for (unsigned int i = 0; i != dimension_; ++i) {
+    columns_[i][k] = columns_[i].back();
+    columns_[i].pop_back();
+  }
+  --size_;
+}
+
+
+//! Erase all the points. (the dimension stays the same)
+inline
+void
+PointBlock::clear()
+{
+  for (unsigned int i = 0; i != dimension_; ++i)
+    columns_[i].clear();
+  size_ = 0;
+}
+
+
+//! Does some point in the block eps-dominate q?
+/*!
+ *  \param q A Point (or FixedPoint) instance.
+ *  \param eps An additive approximation factor. (default 0.0)
+ *  \return true if some point p in the block has
+ *          \f$ p_{i} \le q_{i} + \epsilon \f$ for all i; false otherwise.
+ *          (same as Point::dominates())
+ *
+ *  Stops at the first dominating point (or group of four points).
+ *  Throws like push_back() if the block is not empty.
+ */
+template <class P>
+inline
+bool
+PointBlock::someDominates(const P & q, double eps) const
+{
+  if (empty())
+    return false;
+  // else
+
+  double stackCoordinates[maxStackDimension] = { };
+  std::vector<double> heapCoordinates;
+  const double * query = loadQuery(q, stackCoordinates, heapCoordinates);
+
+  unsigned int first = 0;
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+  if (simdEnabled() and 
+      detail::someDominatesAvx2(columns_, size_, dimension_, query, eps, 
+                                first))
+    return true;
+#endif
+  return detail::someDominatesScalar(columns_, first, size_, dimension_, 
+                                     query, eps);
+}
+
+
+//! The indices of the points in the block q eps-dominates.
+/*!
+ *  \param q A Point (or FixedPoint) instance.
+ *  \param eps An additive approximation factor. (default 0.0)
+ *  \return The (increasing) indices of the points p in the block that
+ *          have \f$ q_{i} \le p_{i} + \epsilon \f$ for all i.
+ *
+ *  Throws like push_back() if the block is not empty.
+ */
+template <class P>
+inline
+std::vector<unsigned int>
+PointBlock::dominatedBy(const P & q, double eps) const
+{
+  std::vector<unsigned int> result;
+  if (empty())
+    return result;
+  // else
+
+  double stackCoordinates[maxStackDimension] = { };
+  std::vector<double> heapCoordinates;
+  const double * query = loadQuery(q, stackCoordinates, heapCoordinates);
+
+  unsigned int first = 0;
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+  if (simdEnabled())
+    first = detail::dominatedByAvx2(columns_, size_, dimension_, query, eps, 
+                                    result);
+#endif
+  detail::dominatedByScalar(columns_, first, size_, dimension_, query, eps, 
+                            result);
+
+  return result;
+}
+
+
+//! The additive distance from q to every point in the block.
+/*!
+ *  \param q A Point (or FixedPoint) instance.
+ *  \return The k'th element is q.additiveDistance(p), where p is the
+ *          k'th point. (i.e. \f$ \max\{ \max_{i}\{p_{i} - q_{i}\}, 0 \} \f$)
+ *
+ *  Throws like push_back() if the block is not empty.
+ */
+template <class P>
+inline
+std::vector<double>
+PointBlock::additiveDistances(const P & q) const
+{
+  std::vector<double> result(size_);
+  if (empty())
+    return result;
+  // else
+
+  double stackCoordinates[maxStackDimension] = { };
+  std::vector<double> heapCoordinates;
+  const double * query = loadQuery(q, stackCoordinates, heapCoordinates);
+
+  unsigned int first = 0;
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+  if (simdEnabled())
+    first = detail::additiveDistancesAvx2(columns_, size_, dimension_, 
+                                          query, result.data());
+#endif
+  detail::additiveDistancesScalar(columns_, first, size_, dimension_, query,
+                                  result.data());
+
+  return result;
+}
+
+
+//! The ratio distance from q to every point in the block.
+/*!
+ *  \param q A strictly positive Point (or FixedPoint) instance.
+ *  \return The k'th element is q.ratioDistance(p), where p is the k'th
+ *          point. (i.e. \f$ \max\{ \max_{i}\{p_{i}/q_{i} - 1\}, 0 \} \f$)
+ *
+ *  Throws like push_back() if the block is not empty, or a
+ *  NotStrictlyPositivePointException exception if q is not strictly
+ *  positive. (the block's points are not checked)
+ */
+template <class P>
+inline
+std::vector<double>
+PointBlock::ratioDistances(const P & q) const
+{
+  std::vector<double> result(size_);
+  if (empty())
+    return result;
+  // else
+
+  double stackCoordinates[maxStackDimension] = { };
+  std::vector<double> heapCoordinates;
+  const double * query = loadQuery(q, stackCoordinates, heapCoordinates);
+  for (unsigned int i = 0; i != dimension_; ++i)
+    if (not (query[i] > 0.0))
+      throw exception_classes::NotStrictlyPositivePointException();
+
+  unsigned int first = 0;
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+  if (simdEnabled())
+    first = detail::ratioDistancesAvx2(columns_, size_, dimension_, query,
+                                       result.data());
+#endif
+  detail::ratioDistancesScalar(columns_, first, size_, dimension_, query,
+                               result.data());
+
+  return result;
+}
+
+
+//! Every point's dot product with a vector.
+/*!
+ *  \param v A vector of dimension() elements.
+ *  \return The k'th element is \f$ \sum_{i} v_{i} p_{i} \f$, where p is
+ *          the k'th point. (summed in order of increasing i)
+ *
+ *  Possible exceptions:
+ *  - May throw a DifferentDimensionsException exception if the block is
+ *    not empty and v does not have dimension() elements.
+ */
+inline
+std::vector<double>
+PointBlock::dotProducts(const std::vector<double> & v) const
+{
+  std::vector<double> result(size_);
+  if (empty())
+    return result;
+  // else
+
+  if (v.size() != dimension_)
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  unsigned int first = 0;
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+  if (simdEnabled())
+    first = detail::dotProductsAvx2(columns_, size_, dimension_, v.data(),
+                                    result.data());
+#endif
+  detail::dotProductsScalar(columns_, first, size_, dimension_, v.data(),
+                            result.data());
+
+  return result;
+}
+
+
+//! Can the kernels use SIMD instructions on this CPU?
+inline
+bool
+PointBlock::simdAvailable()
+{
+#ifdef PARETO_APPROXIMATOR_POINT_BLOCK_AVX2
+  return detail::cpuHasAvx2();
+#else
+  return false;
+#endif
+}
+
+
+//! Are the kernels using SIMD instructions?
+inline
+bool
+PointBlock::simdEnabled()
+{
+  return useSimd().load(std::memory_order_relaxed);
+}
+
+
+//! Let the kernels use SIMD instructions (if available) or not.
+/*!
+ *  \param enabled Use SIMD instructions? (the default is true)
+ *
+ *  Affects all blocks. Useful for comparing the two versions of the
+ *  kernels; they give the same results.
+ */
+inline
+void
+PointBlock::setSimdEnabled(bool enabled)
+{
+  useSimd().store(enabled and simdAvailable(), std::memory_order_relaxed);
+}
+
+
+//! Check a query point and copy its coordinates.
+/*!
+ *  \param q A Point (or FixedPoint) instance.
+ *  \param stackCoordinates Room for maxStackDimension coordinates.
+ *  \param heapCoordinates Used if q has more coordinates.
+ *  \return A pointer to q's coordinates.
+ *
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if q is null.
+ *  - May throw a DifferentDimensionsException exception if q's dimension
+ *    is not the block's.
+ */
+template <class P>
+inline
+const double *
+PointBlock::loadQuery(const P & q, double * stackCoordinates,
+                      std::vector<double> & heapCoordinates) const
+{
+  // (Point::dimension() throws a NullObjectException for null points)
+  if (q.dimension() != dimension_)
+    throw exception_classes::DifferentDimensionsException();
+  // else
+
+  double * coordinates = stackCoordinates;
+  if (dimension_ > maxStackDimension) {
+    heapCoordinates.resize(dimension_);
+    coordinates = heapCoordinates.data();
+  }
+  for (unsigned int i = 0; i != dimension_; ++i)
+    coordinates[i] = q[i];
+
+  return coordinates;
+}
+
+
+//! Should the kernels use SIMD instructions? (shared by all blocks)
+/*!
+ *  An atomic flag, since setSimdEnabled() may be called while other 
+ *  threads use their blocks. (its initialization is thread-safe too, 
+ *  like that of every function-local static)
+ */
+inline
+std::atomic<bool> &
+PointBlock::useSimd()
+{
+  static std::atomic<bool> enabled(simdAvailable());
+  return enabled;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
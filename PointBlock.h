@@ -0,0 +1,222 @@
+/*! \file PointBlock.h
+ *  \brief The declaration of the PointBlock class. (points stored as a
+ *         structure of arrays)
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_POINT_BLOCK_H
+#define PARETO_APPROXIMATOR_POINT_BLOCK_H
+
+
+#include <atomic>
+#include <vector>
+
+#include "Point.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A block of points of the same dimension, one array per coordinate.
+/*!
+ *  Comparing one point (the query) against many points one Point method
+ *  call at a time re-checks nullness, dimensions and positivity on
+ *  every call. PointBlock keeps the i'th coordinates of all its points
+ *  in one contiguous array (a structure of arrays) and compares a query
+ *  against the whole block at once:
+ *  - someDominates(): does some point dominate the query?
+ *  - dominatedBy(): which points does the query dominate?
+ *  - additiveDistances() and ratioDistances(): the query's distance to
+ *    every point. (see Point::additiveDistance() and
+ *    Point::ratioDistance())
+ *  - dotProducts(): every point's dot product with a vector. (e.g. a
+ *    facet's normal vector, see Facet::additiveDistances())
+ *
+ *  The query is checked once (see push_back() for the checks), the
+ *  points in the block not at all. Queries may be Point or FixedPoint
+ *  instances. (anything with dimension() and operator[]())
+ *
+ *  On x86 CPUs with AVX2 (checked at runtime) the kernels compare four
+ *  points at a time; elsewhere, or if PARETO_APPROXIMATOR_NO_SIMD is
+ *  defined, they fall back to plain loops. Both give the same results.
+ *
+ *  The order of the points is not kept by erase(). (it moves the last
+ *  point in the erased point's place)
+ *
+ *  \sa NonDominatedSet and Facet
+ */
+class PointBlock
+{
+  public:
+    //! Make an empty block. (its dimension will be the first point's)
+    PointBlock();
+
+    //! Make an empty block for points of the given dimension.
+    explicit PointBlock(unsigned int dimension);
+
+    //! Destructor. (empty)
+    ~PointBlock();
+
+    //! The dimension of the block's points. (0 if not known yet)
+    unsigned int dimension() const;
+
+    //! The number of points in the block.
+    unsigned int size() const;
+
+    //! Is the block empty?
+    bool empty() const;
+
+    //! The i'th coordinate of the k'th point.
+    double coordinate(unsigned int k, unsigned int i) const;
+
+    //! The k'th point, as a Point instance.
+    Point point(unsigned int k) const;
+
+    //! Append a point.
+    /*!
+     *  \param p A Point (or FixedPoint) instance.
+     *
+     *  Possible exceptions:
+     *  - May throw a NullObjectException exception if p is null.
+     *  - May throw a DifferentDimensionsException exception if p's
+     *    dimension is not the block's.
+     */
+    template <class P>
+    void push_back(const P & p);
+
+    //! Erase the k'th point. (the last point takes its place)
+    void erase(unsigned int k);
+
+    //! Erase all the points. (the dimension stays the same)
+    void clear();
+
+    //! Does some point in the block eps-dominate q?
+    /*!
+     *  \param q A Point (or FixedPoint) instance.
+     *  \param eps An additive approximation factor. (default 0.0)
+     *  \return true if some point p in the block has
+     *          \f$ p_{i} \le q_{i} + \epsilon \f$ for all i; false
+     *          otherwise. (same as Point::dominates())
+     *
+     *  Stops at the first dominating point (or group of four points).
+     *  Throws like push_back() if the block is not empty.
+     */
+    template <class P>
+    bool someDominates(const P & q, double eps=0.0) const;
+
+    //! The indices of the points in the block q eps-dominates.
+    /*!
+     *  \param q A Point (or FixedPoint) instance.
+     *  \param eps An additive approximation factor. (default 0.0)
+     *  \return The (increasing) indices of the points p in the block that
+     *          have \f$ q_{i} \le p_{i} + \epsilon \f$ for all i.
+     *
+     *  Throws like push_back() if the block is not empty.
+     */
+    template <class P>
+    std::vector<unsigned int> dominatedBy(const P & q,
+                                          double eps=0.0) const;
+
+    //! The additive distance from q to every point in the block.
+    /*!
+     *  \param q A Point (or FixedPoint) instance.
+     *  \return The k'th element is q.additiveDistance(p), where p is the
+     *          k'th point. (i.e. \f$ \max\{ \max_{i}\{p_{i} - q_{i}\},
+     *          0 \} \f$)
+     *
+     *  Throws like push_back() if the block is not empty.
+     */
+    template <class P>
+    std::vector<double> additiveDistances(const P & q) const;
+
+    //! The ratio distance from q to every point in the block.
+    /*!
+     *  \param q A strictly positive Point (or FixedPoint) instance.
+     *  \return The k'th element is q.ratioDistance(p), where p is the
+     *          k'th point. (i.e. \f$ \max\{ \max_{i}\{p_{i}/q_{i} - 1\},
+     *          0 \} \f$)
+     *
+     *  Throws like push_back() if the block is not empty, or a
+     *  NotStrictlyPositivePointException exception if q is not strictly
+     *  positive. (the block's points are not checked)
+     */
+    template <class P>
+    std::vector<double> ratioDistances(const P & q) const;
+
+    //! Every point's dot product with a vector.
+    /*!
+     *  \param v A vector of dimension() elements.
+     *  \return The k'th element is \f$ \sum_{i} v_{i} p_{i} \f$, where p
+     *          is the k'th point. (summed in order of increasing i)
+     *
+     *  Possible exceptions:
+     *  - May throw a DifferentDimensionsException exception if the block
+     *    is not empty and v does not have dimension() elements.
+     */
+    std::vector<double> dotProducts(const std::vector<double> & v) const;
+
+    //! Can the kernels use SIMD instructions on this CPU?
+    static bool simdAvailable();
+
+    //! Are the kernels using SIMD instructions?
+    static bool simdEnabled();
+
+    //! Let the kernels use SIMD instructions (if available) or not.
+    /*!
+     *  \param enabled Use SIMD instructions? (the default is true)
+     *
+     *  Affects all blocks. Useful for comparing the two versions of the
+     *  kernels; they give the same results.
+     */
+    static void setSimdEnabled(bool enabled);
+
+  private:
+    //! At most how many coordinates a query keeps on the stack.
+    static const unsigned int maxStackDimension = 16;
+
+    //! Check a query point and copy its coordinates.
+    /*!
+     *  \param q A Point (or FixedPoint) instance.
+     *  \param stackCoordinates Room for maxStackDimension coordinates.
+     *  \param heapCoordinates Used if q has more coordinates.
+     *  \return A pointer to q's coordinates.
+     */
+    template <class P>
+    const double * loadQuery(const P & q, double * stackCoordinates,
+                             std::vector<double> & heapCoordinates) const;
+
+    //! Should the kernels use SIMD instructions? (shared by all blocks)
+    static std::atomic<bool> & useSimd();
+
+    //! The dimension of the points. (0 if not known yet)
+    unsigned int dimension_;
+
+    //! The number of points.
+    unsigned int size_;
+
+    //! The coordinates; columns_[i][k] is the i'th coordinate of point k.
+    std::vector< std::vector<double> > columns_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we want a
+// header-only code base.
+#include "PointBlock.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_POINT_BLOCK_H
@@ -0,0 +1,130 @@
+/*! \file PointPool.cpp
+ *  \brief The implementation of the PointPool<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` PointPool.h. In fact PointPool.h will `include`
+ *  PointPool.cpp because it describes a class template (which doesn't
+ *  allow us to split declaration from definition).
+ */
+
+
+#include <assert.h>
+#include <utility>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Constructor. Makes an empty pool.
+template <class S>
+PointPool<S>::PointPool() { }
+
+
+//! Destructor. (empty)
+template <class S>
+PointPool<S>::~PointPool() { }
+
+
+//! The number of points in the pool.
+template <class S>
+unsigned int
+PointPool<S>::size() const
+{
+  return points_.size();
+}
+
+
+//! Move a point (and its solution) into the pool.
+/*!
+ *  \param point A non-null point. (it is moved from)
+ *  \return A reference to the point: a PointAndSolution<PoolIndex> with 
+ *          the same point and weightsUsed and the point's pool index as 
+ *          its solution.
+ */
+template <class S>
+PointAndSolution<PoolIndex>
+PointPool<S>::add(PointAndSolution<S> && point)
+{
+  assert(not point.isNull());
+
+  PoolIndex index = points_.size();
+  PointAndSolution<PoolIndex> reference(point.point, index, 
+                                        point.weightsUsed.begin(), 
+                                        point.weightsUsed.end());
+  points_.push_back(std::move(point));
+  taken_.push_back(false);
+
+  return reference;
+}
+
+
+//! Get the point (and solution) a reference refers to.
+/*!
+ *  \param reference A reference returned by add(). (its point must not 
+ *                   have been taken yet)
+ *  \return The point. (valid until it is taken or the pool is cleared)
+ */
+template <class S>
+const PointAndSolution<S> & 
+PointPool<S>::get(const PointAndSolution<PoolIndex> & reference) const
+{
+  assert(reference.solution < points_.size());
+  assert(not taken_[reference.solution]);
+
+  return points_[reference.solution];
+}
+
+
+//! Move the points the given references refer to out of the pool.
+/*!
+ *  \param first Iterator to the first reference.
+ *  \param last Iterator to the past-the-end reference.
+ *  \return The points, in the same order. A point referred to more than 
+ *          once is only returned the first time.
+ *  
+ *  The points (and solutions) are moved, not copied. They cannot be 
+ *  taken (or got) again.
+ */
+template <class S>
+std::vector< PointAndSolution<S> > 
+PointPool<S>::take(
+    typename std::vector< PointAndSolution<PoolIndex> >::const_iterator first, 
+    typename std::vector< PointAndSolution<PoolIndex> >::const_iterator last)
+{
+  std::vector< PointAndSolution<S> > points;
+  for ( ; first != last; ++first) {
+    assert(first->solution < points_.size());
+    if (taken_[first->solution])
+      continue;
+    // else
+
+    points.push_back(std::move(points_[first->solution]));
+    taken_[first->solution] = true;
+  }
+
+  return points;
+}
+
+
+//! Remove every point from the pool.
+template <class S>
+void
+PointPool<S>::clear()
+{
+  points_.clear();
+  taken_.clear();
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
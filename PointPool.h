@@ -0,0 +1,98 @@
+/*! \file PointPool.h
+ *  \brief The declaration of the PointPool<S> class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_POINT_POOL_H
+#define PARETO_APPROXIMATOR_POINT_POOL_H
+
+
+#include <vector>
+#include <deque>
+
+#include "PointAndSolution.h"
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! The index of a point (and its solution) in a PointPool.
+typedef unsigned int PoolIndex;
+
+
+//! The points (and solutions) comb() returned during one run.
+/*!
+ *  computeConvexParetoSet() moves every point comb() returns into a 
+ *  PointPool and never copies its solution (an S instance, e.g. a whole 
+ *  shortest path tree) again. Chord and PGEN work with references 
+ *  instead: PointAndSolution<PoolIndex> instances holding a copy of the 
+ *  point and of the weights used, but only the pool index of the 
+ *  solution (see add()). Their facets are Facet<PoolIndex> instances.
+ *  
+ *  When the run is over the points it returns are moved out of the pool 
+ *  (see take()). S may be a move-only type.
+ *  
+ *  Points are kept in a std::deque so adding a point never moves (or 
+ *  copies) the points already in the pool and references to them stay 
+ *  valid.
+ *  
+ *  \sa BaseProblem::computeConvexParetoSet() and PointAndSolution
+ */
+template <class S>
+class PointPool
+{
+  public:
+    //! Constructor. Makes an empty pool.
+    PointPool();
+
+    //! Destructor. (empty)
+    ~PointPool();
+
+    //! The number of points in the pool.
+    unsigned int size() const;
+
+    //! Move a point (and its solution) into the pool.
+    PointAndSolution<PoolIndex> add(PointAndSolution<S> && point);
+
+    //! Get the point (and solution) a reference refers to.
+    const PointAndSolution<S> & 
+    get(const PointAndSolution<PoolIndex> & reference) const;
+
+    //! Move the points the given references refer to out of the pool.
+    std::vector< PointAndSolution<S> > 
+    take(typename std::vector< PointAndSolution<PoolIndex> >::const_iterator first, 
+         typename std::vector< PointAndSolution<PoolIndex> >::const_iterator last);
+
+    //! Remove every point from the pool.
+    void clear();
+
+  private:
+    //! The points, by index.
+    std::deque< PointAndSolution<S> > points_;
+
+    //! Has the point with the same index been moved out of the pool?
+    std::vector<bool> taken_;
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We've got to #include the implementation here because we are describing
+// a class template, not a simple class.
+#include "PointPool.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_POINT_POOL_H
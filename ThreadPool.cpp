@@ -0,0 +1,252 @@
+/*! \file ThreadPool.cpp
+ *  \brief The implementation of the ThreadPool class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Won't `include` ThreadPool.h. In fact, ThreadPool.h will `include`
+ *  ThreadPool.cpp because we want a header-only code base. (that is also
+ *  why every method is declared inline)
+ */
+
+
+#include <assert.h>
+#include <exception>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! Constructor. Starts (numThreads - 1) worker threads.
+/*!
+ *  \param numThreads The number of threads that will run tasks, including
+ *                    the thread that calls run(). Must be at least 1.
+ *                    (a ThreadPool of size 1 just runs the tasks on the
+ *                    calling thread)
+ *
+ *  \sa ThreadPool
+ */
+inline
+ThreadPool::ThreadPool(unsigned int numThreads) : numQueuedTasks_(0),
+                                                  stopping_(false)
+{
+  assert(numThreads >= 1);
+
+  for (unsigned int i = 0; i != numThreads; ++i)
+    queues_.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+  // queue 0 belongs to whoever calls run(), the rest to the workers
+  for (unsigned int i = 1; i != numThreads; ++i)
+    workers_.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+}
+
+
+//! Destructor. Stops and joins the worker threads.
+/*!
+ *  Must not be called while some thread is inside run().
+ *
+ *  \sa ThreadPool
+ */
+inline
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(wakeUpMutex_);
+    stopping_ = true;
+  }
+  wakeUp_.notify_all();
+
+  for (unsigned int i = 0; i != workers_.size(); ++i)
+    workers_[i].join();
+}
+
+
+//! The number of threads that run tasks. (including the caller of run())
+inline
+unsigned int
+ThreadPool::size() const
+{
+  return queues_.size();
+}
+
+
+//! Run the given tasks and wait until all of them have finished.
+/*!
+ *  \param tasks The tasks to run. (in no particular order)
+ *
+ *  The tasks are spread over the threads' queues (round-robin) and the
+ *  calling thread works on them too, so run() never just sits idle
+ *  while there are tasks left to take.
+ *
+ *  If some task throws an exception run() will still wait for the rest
+ *  of the tasks to finish and then rethrow the (first) exception.
+ *
+ *  Tasks must not call run() themselves.
+ *
+ *  \sa ThreadPool
+ */
+inline
+void
+ThreadPool::run(std::vector<Task> & tasks)
+{
+  if (tasks.empty())
+    return;
+  // else
+
+  if (size() == 1) {
+    // no worker threads, just run the tasks here
+    for (unsigned int i = 0; i != tasks.size(); ++i)
+      tasks[i]();
+    return;
+  }
+  // else
+
+  // The state this particular call to run() shares with its tasks.
+  struct RunState
+  {
+    std::atomic<long> numUnfinishedTasks;
+    std::mutex mutex;
+    std::condition_variable allTasksFinished;
+    std::exception_ptr firstError;
+  } state;
+  state.numUnfinishedTasks = tasks.size();
+
+  // Wrap each task so that it reports back when it is done.
+  // - the wrappers refer to "state" and "tasks" which live on our stack;
+  //   that is fine since we won't return before every wrapper has run
+  //   and released state.mutex
+  std::vector<Task> wrappers;
+  wrappers.reserve(tasks.size());
+  for (unsigned int i = 0; i != tasks.size(); ++i) {
+    Task * task = &tasks[i];
+    RunState * s = &state;
+    wrappers.push_back([task, s] () {
+      try {
+        (*task)();
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        if (not s->firstError)
+          s->firstError = std::current_exception();
+      }
+      // decrement under the lock: once run() sees 0 (under the lock) it
+      // returns and "state" is gone, so we mustn't touch it after that
+      std::lock_guard<std::mutex> lock(s->mutex);
+      if (--(s->numUnfinishedTasks) == 0)
+        s->allTasksFinished.notify_all();
+    });
+  }
+
+  // Queue the wrappers round-robin.
+  // - count them first so that a worker never sees more tasks than
+  //   numQueuedTasks_ says (it might see fewer for a moment, in which
+  //   case it will just look again)
+  numQueuedTasks_ += wrappers.size();
+  for (unsigned int i = 0; i != wrappers.size(); ++i) {
+    WorkerQueue & q = *queues_[i % size()];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    q.tasks.push_back(wrappers[i]);
+  }
+  {
+    // take the lock so that no worker misses the notification
+    std::lock_guard<std::mutex> lock(wakeUpMutex_);
+  }
+  wakeUp_.notify_all();
+
+  // Work on the tasks too, until none are left to take.
+  // - the unlocked reads of numUnfinishedTasks are only a hint, we only
+  //   decide to return under state.mutex (see below)
+  Task task;
+  while (state.numUnfinishedTasks > 0 and popTask(0, task))
+    task();
+
+  // Wait for the tasks the workers are still running.
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    while (state.numUnfinishedTasks > 0)
+      state.allTasksFinished.wait(lock);
+  }
+
+  if (state.firstError)
+    std::rethrow_exception(state.firstError);
+}
+
+
+//! The main loop of each worker thread.
+/*!
+ *  \param self The index of the worker's queue.
+ *
+ *  Runs tasks until there are none left to take and then sleeps until
+ *  run() queues new tasks or the pool is destroyed.
+ *
+ *  \sa ThreadPool
+ */
+inline
+void
+ThreadPool::workerLoop(unsigned int self)
+{
+  Task task;
+  while (true) {
+    if (popTask(self, task)) {
+      task();
+      continue;
+    }
+    // else
+
+    std::unique_lock<std::mutex> lock(wakeUpMutex_);
+    while (not stopping_ and numQueuedTasks_ <= 0)
+      wakeUp_.wait(lock);
+    if (stopping_ and numQueuedTasks_ <= 0)
+      return;
+  }
+}
+
+
+//! Take a task from queue "self" or steal one from some other queue.
+/*!
+ *  \param self The index of the calling thread's queue.
+ *  \param task Where the task will be stored.
+ *  \return true if a task was taken; false if every queue was empty.
+ *
+ *  A thread takes tasks from the back of its own queue and steals from
+ *  the front of the other queues.
+ *
+ *  \sa ThreadPool
+ */
+inline
+bool
+ThreadPool::popTask(unsigned int self, Task & task)
+{
+  for (unsigned int i = 0; i != size(); ++i) {
+    unsigned int victim = (self + i) % size();
+    WorkerQueue & q = *queues_[victim];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty())
+      continue;
+    // else
+
+    if (victim == self) {
+      task = q.tasks.back();
+      q.tasks.pop_back();
+    }
+    else {
+      task = q.tasks.front();
+      q.tasks.pop_front();
+    }
+    --numQueuedTasks_;
+    return true;
+  }
+
+  return false;
+}
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
@@ -0,0 +1,119 @@
+/*! \file ThreadPool.h
+ *  \brief The declaration of the ThreadPool class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef PARETO_APPROXIMATOR_THREAD_POOL_H
+#define PARETO_APPROXIMATOR_THREAD_POOL_H
+
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+/*!
+ *  \weakgroup ParetoApproximator Everything needed for the Pareto set approximation algorithms.
+ *  @{
+ */
+
+
+//! The namespace containing everything needed for the Pareto set approximation algorithms.
+namespace pareto_approximator {
+
+
+//! A small work-stealing thread pool.
+/*!
+ *  BaseProblem uses a ThreadPool to run independent comb() calls (e.g.
+ *  the anchor points' comb() calls or the comb() calls of all the
+ *  facets Chord has not tried yet) concurrently.
+ *
+ *  A ThreadPool with n threads consists of n - 1 worker threads plus the
+ *  thread that calls run(). Each of them owns a double-ended queue of
+ *  tasks. A thread takes tasks from the back of its own queue and, when
+ *  its queue is empty, steals tasks from the front of the other threads'
+ *  queues. That way a thread stuck on a long task (e.g. a Dijkstra on a
+ *  big graph) does not keep the tasks behind it waiting.
+ *
+ *  The pool is only meant for coarse-grained tasks (a task should take
+ *  at least a few microseconds).
+ *
+ *  \sa BaseProblem and BaseProblem::setNumThreads()
+ */
+class ThreadPool
+{
+  public:
+    //! The type of a task.
+    typedef std::function<void ()> Task;
+
+    //! Constructor. Starts (numThreads - 1) worker threads.
+    explicit ThreadPool(unsigned int numThreads);
+
+    //! Destructor. Stops and joins the worker threads.
+    ~ThreadPool();
+
+    //! The number of threads that run tasks. (including the caller of run())
+    unsigned int size() const;
+
+    //! Run the given tasks and wait until all of them have finished.
+    void run(std::vector<Task> & tasks);
+
+  private:
+    //! A thread's double-ended queue of tasks.
+    struct WorkerQueue
+    {
+      //! Protects tasks.
+      std::mutex mutex;
+      //! The queued tasks.
+      std::deque<Task> tasks;
+    };
+
+    //! The main loop of each worker thread.
+    void workerLoop(unsigned int self);
+
+    //! Take a task from queue "self" or steal one from some other queue.
+    bool popTask(unsigned int self, Task & task);
+
+    //! One queue per thread. (queue 0 belongs to the caller of run())
+    std::vector< std::unique_ptr<WorkerQueue> > queues_;
+
+    //! The worker threads.
+    std::vector<std::thread> workers_;
+
+    //! Protects stopping_ and is used (with wakeUp_) to put workers to sleep.
+    std::mutex wakeUpMutex_;
+
+    //! Wakes sleeping workers up when new tasks are queued.
+    std::condition_variable wakeUp_;
+
+    //! The number of tasks that are queued but have not been taken yet.
+    std::atomic<long> numQueuedTasks_;
+
+    //! Has the destructor been called?
+    bool stopping_;
+
+    // Non-copyable.
+    ThreadPool(const ThreadPool &);
+    ThreadPool & operator=(const ThreadPool &);
+};
+
+
+}  // namespace pareto_approximator
+
+
+/* @} */
+
+
+// We will #include the implementation here because we want to make a
+// header-only code base.
+#include "ThreadPool.cpp"
+
+
+#endif  // PARETO_APPROXIMATOR_THREAD_POOL_H
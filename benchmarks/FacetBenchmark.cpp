@@ -0,0 +1,133 @@
+/*! \file FacetBenchmark.cpp
+ *  \brief Benchmark for Facet construction.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *  
+ *  Constructs many facets (with and without a given normal vector) in 
+ *  2, 3 and 4 dimensions and prints how many facets per second were 
+ *  constructed.
+ *  
+ *  The vertices are points on the lower part of a unit sphere (centered 
+ *  at (2, 2, ..., 2)), together with the weights that yield them, i.e. 
+ *  the kind of vertices Chord and PGEN make facets of.
+ *  
+ *  Usage: FacetBenchmark.out [number-of-facets]
+ */
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+#include "../Point.h"
+#include "../PointAndSolution.h"
+#include "../Facet.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::Facet;
+
+
+namespace {
+
+
+// Make "n" random vertices in "d" dimensions.
+std::vector< PointAndSolution<int> > 
+makeVertices(unsigned int d, unsigned int n, std::mt19937 & generator)
+{
+  std::uniform_real_distribution<double> weight(0.05, 1.0);
+  std::vector< PointAndSolution<int> > vertices;
+  vertices.reserve(n);
+  for (unsigned int k = 0; k != n; ++k) {
+    std::vector<double> weights(d);
+    double length = 0.0;
+    for (unsigned int i = 0; i != d; ++i) {
+      weights[i] = weight(generator);
+      length += weights[i] * weights[i];
+    }
+    length = std::sqrt(length);
+    std::vector<double> coordinates(d);
+    for (unsigned int i = 0; i != d; ++i)
+      coordinates[i] = 2.0 - weights[i] / length;
+    vertices.push_back(PointAndSolution<int>(
+          Point(coordinates.begin(), coordinates.end()), k, 
+          weights.begin(), weights.end()));
+  }
+
+  return vertices;
+}
+
+
+// Construct "numFacets" facets in "d" dimensions and print the throughput.
+void 
+benchmark(unsigned int d, unsigned int numFacets)
+{
+  std::mt19937 generator(d);
+  std::vector< PointAndSolution<int> > vertices = makeVertices(d, 1000, 
+                                                               generator);
+  std::vector< PointAndSolution<int> > facetVertices(d);
+  std::uniform_int_distribution<unsigned int> index(0, vertices.size() - 1);
+  std::vector< std::vector< PointAndSolution<int> > > facets(numFacets);
+  for (unsigned int f = 0; f != numFacets; ++f)
+    for (unsigned int i = 0; i != d; ++i)
+      facets[f].push_back(vertices[index(generator)]);
+
+  // - with the constructor that computes the normal vector
+  unsigned int numBoundaryFacets = 0;
+  std::chrono::steady_clock::time_point start = 
+      std::chrono::steady_clock::now();
+  for (unsigned int f = 0; f != numFacets; ++f) {
+    Facet<int> facet(facets[f].begin(), facets[f].end(), true);
+    if (facet.isBoundaryFacet())
+      ++numBoundaryFacets;
+  }
+  double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  std::cout << d << "D, computed normal: " << std::setw(10) 
+            << static_cast<long>(numFacets / seconds) << " facets/s  (" 
+            << numBoundaryFacets << " boundary facets)" << std::endl;
+
+  // - with the constructor that is given the normal vector
+  std::vector< std::vector<double> > normals(numFacets);
+  for (unsigned int f = 0; f != numFacets; ++f) {
+    Facet<int> facet(facets[f].begin(), facets[f].end(), true);
+    normals[f].assign(facet.beginFacetNormal(), facet.endFacetNormal());
+  }
+  start = std::chrono::steady_clock::now();
+  for (unsigned int f = 0; f != numFacets; ++f) {
+    Facet<int> facet(facets[f].begin(), facets[f].end(), 
+                     normals[f].begin(), normals[f].end());
+    if (facet.isBoundaryFacet())
+      --numBoundaryFacets;
+  }
+  seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  std::cout << d << "D, given normal:    " << std::setw(10) 
+            << static_cast<long>(numFacets / seconds) << " facets/s" 
+            << std::endl;
+  // (both constructors should agree on the boundary facets)
+  if (numBoundaryFacets != 0)
+    std::cout << "The two constructors disagree!" << std::endl;
+}
+
+
+}  // namespace
+
+
+int 
+main(int argc, char** argv)
+{
+  unsigned int numFacets = 100000;
+  if (argc > 1)
+    numFacets = std::atoi(argv[1]);
+
+  for (unsigned int d = 2; d <= 4; ++d)
+    benchmark(d, numFacets);
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/*! \file ParetoFilterBenchmark.cpp
+ *  \brief Benchmark for the sequential and parallel Pareto filters.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Filters many random points in 2 to 5 dimensions with
+ *  findNonDominatedPoints(), first with one thread and then with 2, 4,
+ *  ... threads (up to the number of hardware threads), and prints the
+ *  time it took and the speedup over one thread.
+ *
+ *  The points are drawn either uniformly from the unit cube (few of them
+ *  are non-dominated) or close to the simplex \f$ \sum_{i} p_{i} = 1 \f$
+ *  (many of them are non-dominated, like the results of many queries).
+ *
+ *  Usage: ParetoFilterBenchmark.out [number-of-points]
+ */
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+
+#include "../ParetoFilter.h"
+
+
+using pareto_approximator::findNonDominatedPoints;
+
+
+namespace {
+
+
+// Make "n" random points in "d" dimensions. (flattened)
+std::vector<double>
+makePoints(unsigned int d, unsigned int n, bool nearSimplex,
+           std::mt19937 & generator)
+{
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<double> coordinates;
+  coordinates.reserve(d * n);
+  for (unsigned int k = 0; k != n; ++k) {
+    std::vector<double> p(d);
+    double sum = 0.0;
+    for (unsigned int i = 0; i != d; ++i) {
+      p[i] = uniform(generator);
+      sum += p[i];
+    }
+    // near the simplex: scale to sum 1 and add some noise
+    for (unsigned int i = 0; i != d; ++i)
+      coordinates.push_back(nearSimplex ?
+                            p[i] / sum + 0.05 * uniform(generator) : p[i]);
+  }
+
+  return coordinates;
+}
+
+
+// Filter "n" points in "d" dimensions with 1, 2, 4, ... threads.
+void
+benchmark(unsigned int d, unsigned int n, bool nearSimplex)
+{
+  std::mt19937 generator(d);
+  std::vector<double> coordinates = makePoints(d, n, nearSimplex, generator);
+  unsigned int maxThreads = std::max(1u,
+                                     std::thread::hardware_concurrency());
+
+  double oneThreadSeconds = 0.0;
+  std::vector<unsigned int> expected;
+  for (unsigned int numThreads = 1; numThreads <= maxThreads;
+       numThreads *= 2) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    std::vector<unsigned int> nonDominated =
+        findNonDominatedPoints(coordinates, d, numThreads);
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    if (numThreads == 1) {
+      oneThreadSeconds = seconds;
+      expected = nonDominated;
+    }
+    std::cout << d << "D, " << (nearSimplex ? "near simplex" : "uniform     ")
+              << ", " << std::setw(2) << numThreads << " threads: "
+              << std::fixed << std::setprecision(3) << seconds << " s  ("
+              << std::setprecision(2) << oneThreadSeconds / seconds
+              << "x, " << nonDominated.size() << " non-dominated)"
+              << std::endl;
+    // (every thread count should find the same points)
+    if (nonDominated != expected)
+      std::cout << "The filters disagree!" << std::endl;
+  }
+}
+
+
+}  // namespace
+
+
+int
+main(int argc, char** argv)
+{
+  unsigned int numPoints = 200000;
+  if (argc > 1)
+    numPoints = std::atoi(argv[1]);
+
+  for (unsigned int d = 2; d <= 5; ++d) {
+    benchmark(d, numPoints, false);
+    benchmark(d, numPoints, true);
+  }
+
+  return 0;
+}
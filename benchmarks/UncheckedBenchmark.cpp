@@ -0,0 +1,154 @@
+/*! \file UncheckedBenchmark.cpp
+ *  \brief Benchmark for the checked vs the unchecked Point and Facet
+ *         distance and dominance methods.
+ *  \author Christos Nitsas
+ *  \date 2013
+ *
+ *  Compares many random (strictly positive) points with each other and
+ *  with a facet in 2, 3, 4 and 5 dimensions, first with the checked
+ *  methods (e.g. Point::dominates()) and then with their unchecked
+ *  counterparts (e.g. Point::dominatesUnchecked()), and prints how many
+ *  comparisons per second each made.
+ *
+ *  Usage: UncheckedBenchmark.out [number-of-points]
+ */
+
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+
+#include "../Point.h"
+#include "../PointAndSolution.h"
+#include "../Facet.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::Facet;
+
+
+namespace {
+
+
+// Make "n" random strictly positive points in "d" dimensions.
+std::vector<Point>
+makePoints(unsigned int d, unsigned int n, std::mt19937 & generator)
+{
+  std::uniform_real_distribution<double> coordinate(1.0, 100.0);
+  std::vector<Point> points;
+  points.reserve(n);
+  std::vector<double> coordinates(d);
+  for (unsigned int k = 0; k != n; ++k) {
+    for (unsigned int i = 0; i != d; ++i)
+      coordinates[i] = coordinate(generator);
+    points.push_back(Point(coordinates.begin(), coordinates.end()));
+  }
+
+  return points;
+}
+
+
+// Make a facet in "d" dimensions. (the simplex through 50 * e_i)
+Facet<int>
+makeFacet(unsigned int d)
+{
+  std::vector< PointAndSolution<int> > vertices;
+  for (unsigned int i = 0; i != d; ++i) {
+    std::vector<double> coordinates(d, 1.0);
+    coordinates[i] = 50.0;
+    std::vector<double> weights(d, 0.0);
+    weights[i] = 1.0;
+    vertices.push_back(PointAndSolution<int>(
+          Point(coordinates.begin(), coordinates.end()), i,
+          weights.begin(), weights.end()));
+  }
+
+  return Facet<int>(vertices.begin(), vertices.end(), true);
+}
+
+
+// Time "f" on every point (after the first) and print the throughput.
+// (f returns a count, so that the compiler cannot skip the work)
+template <class F>
+double
+timeIt(const std::string & name, unsigned int d,
+       const std::vector<Point> & points, F f)
+{
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  double count = 0.0;
+  for (unsigned int k = 1; k != points.size(); ++k)
+    count += f(points[k - 1], points[k]);
+  double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  double opsPerSecond = (points.size() - 1) / seconds;
+  std::cout << d << "D, " << std::left << std::setw(34) << name
+            << std::right << std::setw(12)
+            << static_cast<long>(opsPerSecond) << " ops/s  ("
+            << count << ")" << std::endl;
+
+  return opsPerSecond;
+}
+
+
+// Time the checked and the unchecked methods in "d" dimensions.
+void
+benchmark(unsigned int d, unsigned int numPoints)
+{
+  std::mt19937 generator(d);
+  std::vector<Point> points = makePoints(d, numPoints, generator);
+  Facet<int> facet = makeFacet(d);
+
+  double checked, unchecked;
+  checked = timeIt("Point::dominates()", d, points,
+      [](const Point & p, const Point & q) { return p.dominates(q, 1.0); });
+  unchecked = timeIt("Point::dominatesUnchecked()", d, points,
+      [](const Point & p, const Point & q)
+      { return p.dominatesUnchecked(q, 1.0); });
+  std::cout << "    speedup: " << unchecked / checked << std::endl;
+
+  checked = timeIt("Point::ratioDistance()", d, points,
+      [](const Point & p, const Point & q) { return p.ratioDistance(q); });
+  unchecked = timeIt("Point::ratioDistanceUnchecked()", d, points,
+      [](const Point & p, const Point & q)
+      { return p.ratioDistanceUnchecked(q); });
+  std::cout << "    speedup: " << unchecked / checked << std::endl;
+
+  checked = timeIt("Facet::dominates()", d, points,
+      [&facet](const Point &, const Point & q)
+      { return facet.dominates(q, 1.0); });
+  unchecked = timeIt("Facet::dominatesUnchecked()", d, points,
+      [&facet](const Point &, const Point & q)
+      { return facet.dominatesUnchecked(q, 1.0); });
+  std::cout << "    speedup: " << unchecked / checked << std::endl;
+
+  checked = timeIt("Facet::ratioDistance()", d, points,
+      [&facet](const Point &, const Point & q)
+      { return facet.ratioDistance(q); });
+  unchecked = timeIt("Facet::ratioDistanceUnchecked()", d, points,
+      [&facet](const Point &, const Point & q)
+      { return facet.ratioDistanceUnchecked(q); });
+  std::cout << "    speedup: " << unchecked / checked << std::endl;
+}
+
+
+}  // namespace
+
+
+int
+main(int argc, char** argv)
+{
+  unsigned int numPoints = 2000000;
+  if (argc > 1)
+    numPoints = std::atoi(argv[1]);
+
+  for (unsigned int d = 2; d <= 5; ++d)
+    benchmark(d, numPoints);
+
+  return 0;
+}
@@ -90,9 +90,10 @@ class FloodVisitor
      *  i.e. paths with cycles or paths that are definitely worse than 
      *  other paths we have already discovered.
      *
-     *  We represent distances as Point instances.
+     *  We represent distances as Distance (FixedPoint) instances, so 
+     *  extending a path by an edge never allocates memory.
      */
-    std::vector< NonDominatedSet<Point> > vertexDistances_;
+    std::vector< NonDominatedSet<Distance> > vertexDistances_;
 };
 
 
@@ -16,6 +16,7 @@
 #include <list>
 #include <vector>
 #include <queue>
+#include <utility>
 #include <boost/config.hpp>
 #include <boost/graph/random.hpp>
 #include <boost/random/mersenne_twister.hpp>
@@ -42,6 +43,7 @@ using boost::num_vertices;
 
 using pareto_approximator::Point;
 using pareto_approximator::NonDominatedSet;
+using pareto_approximator::CombHint;
 
 
 /*!
@@ -173,6 +175,49 @@ RandomGraphProblem::makeGraph(int numVertices, int numEdges,
 }
 
 
+//! Thrown by EarlyExitVisitor to stop boost::dijkstra_shortest_paths().
+class StopSearch { };
+
+
+//! A Dijkstra visitor that stops the search early.
+/*!
+ *  boost::dijkstra_shortest_paths() has no early exit; a visitor that 
+ *  throws is the usual way to stop it. EarlyExitVisitor throws a 
+ *  StopSearch instance when Dijkstra is about to examine:
+ *  - the target, since its distance is final by then, or 
+ *  - a vertex whose distance is no less than the upper bound, since no 
+ *    vertex left in the queue (the target included) is any closer.
+ */
+class EarlyExitVisitor : public boost::default_dijkstra_visitor
+{
+  public:
+    //! Constructor.
+    /*!
+     *  \param target The target vertex.
+     *  \param bound The upper bound. (infinity for none)
+     *  \param distances Dijkstra's distance map. (shares its storage)
+     */
+    EarlyExitVisitor(const Vertex & target, double bound, 
+                     const boost::vector_property_map<double> & distances) : 
+        target_(target), bound_(bound), distances_(distances) { }
+
+    //! Stop at the target or at the bound.
+    void examine_vertex(const Vertex & u, const Graph &) 
+    {
+      if (u == target_ or distances_[u] >= bound_)
+        throw StopSearch();
+    }
+
+  private:
+    //! The target vertex.
+    Vertex target_;
+    //! The upper bound.
+    double bound_;
+    //! Dijkstra's distance map.
+    boost::vector_property_map<double> distances_;
+};
+
+
 //! The comb routine we had to implement. 
 /*!
  *  \param first Iterator to the initial position in an 
@@ -196,12 +241,40 @@ RandomGraphProblem::makeGraph(int numVertices, int numEdges,
  *  \$f w_{0} * Black(P) + w_{1} * Red(P) \$f,
  *  where P is an s-t path.
  *  
+ *  Same as combWithHint() with an empty hint, i.e. with no upper bound.
+ *  
  *  \sa RandomGraphProblem and RandomGraphProblem::RandomGraphProblem()
  */
 PointAndSolution<PredecessorMap> 
 RandomGraphProblem::comb(
                     std::vector<double>::const_iterator first, 
                     std::vector<double>::const_iterator last) 
+{
+  return combWithHint(first, last, CombHint<PredecessorMap>());
+}
+
+
+//! The comb routine, with Dijkstra pruned by the hint's upper bound.
+/*!
+ *  \param first Iterator to the first weight. (see comb())
+ *  \param last Iterator to the past-the-end weight.
+ *  \param hint The generating facet's vertices and the upper bound to 
+ *              the optimal value. (see CombHint)
+ *  \return What comb() returns or, if no s-t path is strictly shorter 
+ *          than the hint's upper bound, a null PointAndSolution 
+ *          instance. ("no improvement")
+ *  
+ *  Dijkstra stops as soon as it reaches t, or as soon as the smallest 
+ *  distance in its queue reaches the upper bound, instead of settling 
+ *  the whole graph. (see EarlyExitVisitor)
+ *  
+ *  \sa comb() and pareto_approximator::BaseProblem::combWithHint()
+ */
+PointAndSolution<PredecessorMap> 
+RandomGraphProblem::combWithHint(
+                    std::vector<double>::const_iterator first, 
+                    std::vector<double>::const_iterator last, 
+                    const CombHint<PredecessorMap> & hint) 
 {
   assert(std::distance(first, last) == 2);
 
@@ -224,10 +297,22 @@ RandomGraphProblem::comb(
   // distance property map
   boost::vector_property_map<double> d_map(boost::num_vertices(g_));
 
-  // Find all shortest paths from s.
-  boost::dijkstra_shortest_paths(g_, s_, weight_map(w_map).
-                                         predecessor_map(&p_map[0]).
-                                         distance_map(d_map));
+  // Find the shortest paths from s, up to t or up to the upper bound.
+  // - every vertex on the s-t path is settled when we stop at t
+  double bound = hint.upperBound();
+  try {
+    boost::dijkstra_shortest_paths(g_, s_, weight_map(w_map).
+                                           predecessor_map(&p_map[0]).
+                                           distance_map(d_map).
+                                           visitor(EarlyExitVisitor(t_, bound, 
+                                                                    d_map)));
+  }
+  catch (StopSearch &) { }
+
+  // No s-t path shorter than the bound? (no improvement)
+  if (d_map[t_] >= bound)
+    return PointAndSolution<PredecessorMap>();
+  // else
 
   double xDistance = 0;
   double yDistance = 0;
@@ -245,7 +330,9 @@ RandomGraphProblem::comb(
     v = p_map[w];
   }
 
-  return PointAndSolution<PredecessorMap>(Point(xDistance, yDistance), p_map);
+  // (move the predecessor map, computeConvexParetoSet() never copies it)
+  return PointAndSolution<PredecessorMap>(Point(xDistance, yDistance), 
+                                          std::move(p_map));
 }
 
 
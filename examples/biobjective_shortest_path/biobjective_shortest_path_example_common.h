@@ -12,6 +12,7 @@
 #include <boost/graph/adjacency_list.hpp>
 
 #include "../../Point.h"
+#include "../../FixedPoint.h"
 #include "../../PointAndSolution.h"
 #include "../../BaseProblem.h"
 #include "../../NonDominatedSet.h"
@@ -74,6 +75,12 @@ typedef boost::graph_traits<Graph>::edge_iterator     EdgeIterator;
  *    this must change too.
  */
 typedef std::vector<Vertex>                    PredecessorMap;
+//! A 2-dimensional distance. (e.g. of a path from the source)
+/*!
+ *  A FixedPoint so that adding distances never allocates memory. 
+ *  (see FloodVisitor)
+ */
+typedef pareto_approximator::FixedPoint<2>    Distance;
 
 
 }  // namespace biobjective_shortest_path_example
@@ -78,11 +78,12 @@ main(int argc, char * argv[])
 {
   // Parse the command line arguments.
   int seed;
+  unsigned int numThreads = 1;
   bool withoutExactParetoSet = false;
   char * arg = NULL;
   if (commandLineOptionExists(argv, argv + argc, "-h") or
       commandLineOptionExists(argv, argv + argc, "--help")) {
-    cout << "Usage: bosp_example [-s seed] [-W] [--without-exact-pareto-set]" 
+    cout << "Usage: bosp_example [-s seed] [-W] [-t threads] [--without-exact-pareto-set]" 
          << endl;
     return 0;
   }
@@ -101,6 +102,10 @@ main(int argc, char * argv[])
   else 
     // Use the current time as a seed.
     seed = time(0);
+  arg = getCommandLineArgument(argv, argv + argc, "-t");
+  if (arg != NULL and atoi(arg) > 0)
+    // Call comb() from that many threads at once.
+    numThreads = atoi(arg);
 
   // Initializations
   // =========================================
@@ -166,6 +171,7 @@ main(int argc, char * argv[])
   // Use RandomGraphProblem::computeConvexParetoSet() (inherited from 
   // BaseProblem) to find the convex Pareto set.
   std::vector< PointAndSolution<PredecessorMap> > paretoSet;
+  rgp.setNumThreads(numThreads);
   paretoSet = rgp.computeConvexParetoSet(numObjectives, approximationRatio);
 
   // Output (convex Pareto set)
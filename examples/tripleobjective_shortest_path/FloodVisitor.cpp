@@ -15,6 +15,7 @@
 
 using pareto_approximator::Point;
 using pareto_approximator::NonDominatedSet;
+using pareto_approximator::NonDominatedTree;
 
 
 /*!
@@ -39,7 +40,7 @@ FloodVisitor::FloodVisitor(const Vertex & source,
                            unsigned int numVertices) : source_(source), 
                                                        target_(target)
 {
-  vertexDistances_.assign(numVertices, NonDominatedSet<Point>());
+  vertexDistances_.assign(numVertices, NonDominatedTree<Distance>());
 }
 
 
@@ -58,12 +59,12 @@ FloodVisitor::initializeVertex(const Vertex & u, const Graph &)
     // we do not allow not strictly positive points like [0.0, 0.0, 0.0]
     // inside Point::dominates() and Point::distance() (because of 
     // Point::ratioDistance())
-    vertexDistances_[u].insert(Point(1.0, 1.0, 1.0));
+    vertexDistances_[u].insert(Distance(1.0, 1.0, 1.0));
   }
   else
-    vertexDistances_[u].insert(Point(std::numeric_limits<double>::max(), 
-                                     std::numeric_limits<double>::max(), 
-                                     std::numeric_limits<double>::max()));
+    vertexDistances_[u].insert(Distance(std::numeric_limits<double>::max(), 
+                                        std::numeric_limits<double>::max(), 
+                                        std::numeric_limits<double>::max()));
 }
 
 
@@ -84,10 +85,10 @@ FloodVisitor::broadcastDistances(const Edge & e, const Graph & g)
 {
   Vertex u = boost::source(e, g);
   Vertex v = boost::target(e, g);
-  Point edgeWeight(g[e].black, g[e].red, g[e].green);
+  Distance edgeWeight(g[e].black, g[e].red, g[e].green);
 
   bool insertedNewDistance = false;
-  NonDominatedSet<Point>::iterator udi;
+  NonDominatedTree<Distance>::iterator udi;
   for (udi = vertexDistances_[u].begin(); 
        udi != vertexDistances_[u].end(); ++udi) {
     insertedNewDistance |= vertexDistances_[v].insert(*udi + edgeWeight);
@@ -109,11 +110,11 @@ FloodVisitor::getParetoPoints()
   // Remember that we had initialized the source to [1.0, 1.0, 1.0] instead 
   // of [0.0, 0.0, 0.0]. We now have to subtract [1.0, 1.0, 1.0] from each 
   // of the target vertex's distances to get the Pareto points.
-  NonDominatedSet<Point>::iterator udi;
+  NonDominatedTree<Distance>::iterator udi;
   NonDominatedSet<Point> paretoPoints;
   for (udi = vertexDistances_[target_].begin();
        udi != vertexDistances_[target_].end(); ++udi) {
-    paretoPoints.insert(*udi - Point(1.0, 1.0, 1.0));
+    paretoPoints.insert((*udi - Distance(1.0, 1.0, 1.0)).toPoint());
   }
   return paretoPoints;
 }
@@ -14,6 +14,7 @@
 
 using pareto_approximator::Point;
 using pareto_approximator::NonDominatedSet;
+using pareto_approximator::NonDominatedTree;
 
 
 /*!
@@ -90,9 +91,12 @@ class FloodVisitor
      *  i.e. paths with cycles or paths that are definitely worse than 
      *  other paths we have already discovered.
      *
-     *  We represent distances as Point instances.
+     *  We represent distances as Distance (FixedPoint) instances, so 
+     *  extending a path by an edge never allocates memory, and keep 
+     *  each vertex's distances in an ND-tree (NonDominatedTree), since 
+     *  a vertex can have many non-dominated distances.
      */
-    std::vector< NonDominatedSet<Point> > vertexDistances_;
+    std::vector< NonDominatedTree<Distance> > vertexDistances_;
 };
 
 
@@ -17,6 +17,7 @@
 using pareto_approximator::Point;
 using pareto_approximator::PointAndSolution;
 using pareto_approximator::BaseProblem;
+using pareto_approximator::CombHint;
 using pareto_approximator::NonDominatedSet;
 
 
@@ -178,6 +179,27 @@ class RandomGraphProblem : public BaseProblem<PredecessorMap>
                           std::vector<double>::const_iterator first, 
                           std::vector<double>::const_iterator last);
 
+    //! The comb routine, with Dijkstra pruned by the hint's upper bound.
+    /*!
+     *  \param first Iterator to the first weight. (see comb())
+     *  \param last Iterator to the past-the-end weight.
+     *  \param hint The generating facet's vertices and the upper bound 
+     *              to the optimal value. (see 
+     *              pareto_approximator::CombHint)
+     *  \return What comb() returns or, if no s-t path is strictly 
+     *          shorter than the hint's upper bound, a null 
+     *          PointAndSolution instance. ("no improvement")
+     *  
+     *  Dijkstra stops as soon as it reaches t or the upper bound, 
+     *  instead of settling the whole graph.
+     *  
+     *  \sa comb() and pareto_approximator::BaseProblem::combWithHint()
+     */
+    PointAndSolution<PredecessorMap> combWithHint(
+                          std::vector<double>::const_iterator first, 
+                          std::vector<double>::const_iterator last, 
+                          const CombHint<PredecessorMap> & hint);
+
     //! Check if the target (t) is reachable.
     /*!
      *  \return True iff there is at least one path that connects source (s) 
@@ -12,9 +12,11 @@
 #include <boost/graph/adjacency_list.hpp>
 
 #include "../../Point.h"
+#include "../../FixedPoint.h"
 #include "../../PointAndSolution.h"
 #include "../../BaseProblem.h"
 #include "../../NonDominatedSet.h"
+#include "../../NonDominatedTree.h"
 
 
 /*!
@@ -76,6 +78,12 @@ typedef boost::graph_traits<Graph>::edge_iterator     EdgeIterator;
  *    this must change too.
  */
 typedef std::vector<Vertex>                    PredecessorMap;
+//! A 3-dimensional distance. (e.g. of a path from the source)
+/*!
+ *  A FixedPoint so that adding distances never allocates memory. 
+ *  (see FloodVisitor)
+ */
+typedef pareto_approximator::FixedPoint<3>    Distance;
 
 
 }  // namespace tripleobjective_shortest_path_example
@@ -1,7 +1,7 @@
 //! \file experiments/vs_namoa_star/AStarDijkstra.h
 //! \brief This file contains a simple A* implementation (currently 
-//!        commented out because we use PGL's A*), plus some heuristics 
-//!        for A*.
+//!        commented out because we use PGL's A*), an A* (and Dijkstra) 
+//!        that stops at an upper bound, plus some heuristics for A*.
 //! \author Christos Nitsas
 //! \date 2013
 //!
@@ -515,6 +515,152 @@ hasAdmissibleHeuristic(GraphType & graph, unsigned int * timestamp,
 }
 
 
+//! \brief A simple A\* (or Dijkstra) that stops at an upper bound.
+//!
+//! MultiobjectiveSpOnPmgProblem uses it for every comb() call. Chord and 
+//! PGEN know an upper bound to the optimal path's cost: the cost of the 
+//! best path they already have for comb()'s weights. (see 
+//! pareto_approximator::CombHint) Once the smallest fScore in the OPEN 
+//! "list" reaches the bound no path to the target can beat it and the 
+//! query stops, without settling the rest of the graph.
+//!
+//! It expects a consistent heuristic in the nodes' heuristicValue 
+//! attributes (see hasConsistentHeuristic()), so nodes are never 
+//! reopened, or no heuristic at all. (Dijkstra)
+//!
+template <class GraphType> 
+class BoundedAStarDijkstra
+{
+  public:
+    //! \brief Iterator to the underlying graph's nodes.
+    typedef typename GraphType::NodeIterator         NodeIterator;
+
+    //! \brief Iterator to the underlying graph's edges.
+    typedef typename GraphType::EdgeIterator         EdgeIterator;
+
+    //! \brief Edge weight type.
+    typedef double                                   WeightType;
+
+    //! \brief The type of the priority queue we will use.
+    typedef PriorityQueue<WeightType, 
+                          NodeIterator, HeapStorage> PriorityQueueType;
+
+    //! \brief Simple constructor.
+    //! 
+    //! \param graph The graph to run the algorithm on.
+    //! \param timestamp A pointer to a timestamp greater than or equal to 
+    //!        the maximum of the graph's nodes' timestamps. (see 
+    //!        BackwardDijkstra)
+    //! \param useHeuristic Use the nodes' heuristicValue attributes? (A\*) 
+    //!        Ignore them otherwise. (Dijkstra)
+    //!
+    BoundedAStarDijkstra(GraphType & graph, unsigned int * timestamp, 
+                         bool useHeuristic) 
+        : graph_(graph), timestamp_(timestamp), useHeuristic_(useHeuristic)
+    {
+    }
+
+    //! \brief Run a source-target query, up to an upper bound.
+    //!
+    //! \param source (An iterator to) The source node.
+    //! \param target (An iterator to) The target node.
+    //! \param bound The upper bound. (infinity for none)
+    //! \return The cost/weight of the shortest path from the source to the 
+    //!         target or infinity if no path is strictly shorter than the 
+    //!         bound.
+    //! 
+    //! The path can be reconstructed by following the nodes' predecessor 
+    //! pointers (Node::pred attributes) starting at the target node.
+    //!
+    WeightType runQuery(const NodeIterator & source, 
+                        const NodeIterator & target, 
+                        WeightType bound=
+                              std::numeric_limits<WeightType>::infinity())
+    {
+      NodeIterator u, v;
+      EdgeIterator e, lastEdge;
+      WeightType fScore;
+
+      // nodes with timestamps lower than ours are uninitialized
+      openNodesQueue_.clear();
+      ++(*timestamp_);
+      source->dist = 0.0;
+      source->timestamp = *timestamp_;
+      source->pred = graph_.nilNodeDescriptor();
+      source->fScore = heuristicValue(source);
+      source->closed = false;
+      openNodesQueue_.insert(source->fScore, source, &(source->pqitem));
+
+      while (not openNodesQueue_.empty()) {
+        u = openNodesQueue_.minItem();
+
+        // every path to the target through the OPEN nodes costs at 
+        // least u->fScore (the heuristic is admissible)
+        if (u->fScore >= bound)
+          return std::numeric_limits<WeightType>::infinity();
+        // else
+
+        openNodesQueue_.popMin();
+        u->closed = true;
+        if (u == target) 
+          return u->dist;
+        // else
+
+        for (e = graph_.beginEdges(u), lastEdge = graph_.endEdges(u); 
+             e != lastEdge; ++e) 
+        {
+          v = graph_.target(e);
+          fScore = u->dist + e->weight + heuristicValue(v);
+
+          if (v->timestamp < *timestamp_) {
+            // first time we see the node
+            v->pred = u->getDescriptor();
+            v->dist = u->dist + e->weight;
+            v->fScore = fScore;
+            v->timestamp = *timestamp_;
+            v->closed = false;
+            openNodesQueue_.insert(v->fScore, v, &(v->pqitem));
+          }
+          else if (not v->closed and fScore < v->fScore) {
+            // a shorter path to a node in the OPEN "list"
+            v->pred = u->getDescriptor();
+            v->dist = u->dist + e->weight;
+            v->fScore = fScore;
+            openNodesQueue_.decrease(v->fScore, &(v->pqitem));
+          }
+        }
+      }
+
+      // the target is unreachable
+      return std::numeric_limits<WeightType>::infinity();
+    }
+
+  private:
+    //! \brief The node's heuristic value. (0 for Dijkstra)
+    WeightType heuristicValue(const NodeIterator & u) const
+    {
+      return useHeuristic_ ? u->heuristicValue : 0.0;
+    }
+
+    //! The graph that the algorithm will run on.
+    GraphType & graph_;
+
+    //! \brief A timestamp. 
+    //!
+    //! The algorithm will increment it at the start of each query. Nodes 
+    //! with timestamps lower than the algorithm's timestamp are considered 
+    //! uninitialized.
+    //!
+    unsigned int * timestamp_;
+
+    //! Use the nodes' heuristicValue attributes? (A\*)
+    bool useHeuristic_;
+
+    //! The OPEN "list".
+    PriorityQueueType openNodesQueue_;
+};
+
+
 /* We'll use PGL's A* implementation.
 //! \brief A class containing a simple implementation of the A\* algorithm.
 //!
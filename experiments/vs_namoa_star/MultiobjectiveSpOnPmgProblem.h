@@ -30,6 +30,7 @@
 #include "../../Point.h"
 #include "../../PointAndSolution.h"
 #include "../../BaseProblem.h"
+#include "../../LazyProblem.h"
 
 #include "experiments_vs_namoa_star_common.h"
 #include "experiments_vs_namoa_star_utility.h"
@@ -101,10 +102,17 @@ namespace experiments_vs_namoa_star {
 //! What we had to do for computeConvexParetoSet() to work
 //! --------------------------------------------------------
 //! MultiobjectiveSpOnPmgProblem instances inherit 
-//! BaseProblem::computeConvexParetoSet() directly from BaseProblem so the 
-//! only thing we had to implement was the 
+//! BaseProblem::computeConvexParetoSet() directly from BaseProblem (via 
+//! LazyProblem) so the only things we had to implement were the 
 //! MultiobjectiveSpOnPmgProblem::comb() method (!) which is 
-//! declared virtual in BaseProblem. 
+//! declared virtual in BaseProblem and the 
+//! MultiobjectiveSpOnPmgProblem::materializeSolution() method which is 
+//! declared virtual in LazyProblem. 
+//! 
+//! comb() does not make the path it finds, only the path's point in 
+//! objective space and a PathToken. materializeSolution() makes the 
+//! path, only for the points runQuery() returns and only if asked to. 
+//! (see runQuery())
 //! 
 //! About PGL and the NAMOA\* algorithm.
 //! -------------------------------------
@@ -126,7 +134,8 @@ namespace experiments_vs_namoa_star {
 //!     pareto_approximator::PointAndSolution and 
 //!     pareto_approximator::Point
 //!
-class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
+class MultiobjectiveSpOnPmgProblem : 
+          private pa::LazyProblem<Path, PathToken>
 {
   public:
     //! \brief Constructor. Do not read any graph.
@@ -414,16 +423,20 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
     //!        Pareto Set using PGL's NAMOA\* implementation; if false, 
     //!        compute a convex (approximate) Pareto Set using 
     //!        pareto_approximator::BaseProblem::computeConvexParetoSet().
-    //! \param useAStar If true, use our simple A* implementation 
-    //!        inside comb; if false, use PGL's single objective Dijkstra 
-    //!        implementation.
+    //! \param useAStar If true, use A* inside comb; if false, use 
+    //!        Dijkstra. (both BoundedAStarDijkstra, see 
+    //!        MultiobjectiveSpOnPmgProblem::runCombinedQuery())
+    //! \param materializePaths If true, make the path of each Pareto 
+    //!        point Chord/PGEN found (one more Dijkstra/A* query per 
+    //!        point, see MultiobjectiveSpOnPmgProblem::materializeSolution()); 
+    //!        if false, leave the paths empty.
     //! \return A std::vector of Pareto points (as 
     //!         pareto_approximator::PointAndSolution objects).
     //! 
     //! Each pareto_approximator::PointAndSolution object will include 
     //! the corresponding path if computeExactParetoSetUsingNamoaStar was 
-    //! false; if it was true (i.e. NAMOA\* was used) the object will 
-    //! contain an empty path.
+    //! false and materializePaths was true; otherwise (e.g. if NAMOA\* 
+    //! was used) the object will contain an empty path.
     //! 
     //! The resulting vector of pareto_approximator::PointAndSolution objects 
     //! will be sorted according to the objects' included 
@@ -437,7 +450,7 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
     runQuery(unsigned int sourceId, unsigned int targetId, 
              unsigned int numObjectives=2, 
              bool computeExactParetoSetUsingNamoaStar=false, 
-             bool useAStar=false) 
+             bool useAStar=false, bool materializePaths=true) 
     {
       // We only do experiments for the 2 and 3 objectives cases.
       assert( (numObjectives == 2) || (numObjectives == 3) );
@@ -509,7 +522,19 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
         // pareto_approximator::BaseProblem::computeConvexParetoSet().
         double approximationRatio = 1e-12;
 
-        result = computeConvexParetoSet(numObjectives, approximationRatio);
+        std::vector< pa::PointAndSolution<PathToken> > paretoPoints;
+        paretoPoints = computeConvexParetoSet(numObjectives, 
+                                              approximationRatio);
+        if (materializePaths) 
+          result = materializeSolutions(paretoPoints);
+        else {
+          result.reserve(paretoPoints.size());
+          std::vector< pa::PointAndSolution<PathToken> >::const_iterator pi;
+          for (pi = paretoPoints.begin(); pi != paretoPoints.end(); ++pi) 
+            result.push_back(pa::PointAndSolution<Path>(pi->point, Path(), 
+                                                    pi->weightsUsed.begin(), 
+                                                    pi->weightsUsed.end()));
+        }
       }
 
       return result;
@@ -619,18 +644,141 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
     //! problem, w_{0} (the weight for the distance cost) and w_{1} 
     //! (the weight for the travel time cost).
     //! 
+    //! Same as combWithHint() with an empty hint. (no upper bound)
+    //! 
     //! \sa MultiobjectiveSpOnPmgProblem, pareto_approximator::BaseProblem 
     //!     and pareto_approximator::BaseProblem::computeConvexParetoSet()
     //!
-    pa::PointAndSolution<Path> 
+    pa::PointAndSolution<PathToken> 
     comb(std::vector<double>::const_iterator weight, 
          std::vector<double>::const_iterator lastWeight) 
+    {
+      return combWithHint(weight, lastWeight, pa::CombHint<PathToken>());
+    }
+
+    //! \brief The comb method, with the search pruned by the hint's upper 
+    //!        bound. (for pareto_approximator::BaseProblem)
+    //! 
+    //! \param weight Iterator to the first weight. (see comb())
+    //! \param lastWeight Iterator to the past-the-end weight.
+    //! \param hint The generating facet's vertices and an upper bound to 
+    //!        the optimal path's combined cost. (see 
+    //!        pareto_approximator::CombHint)
+    //! \return What comb() returns or, if no s-t path is strictly 
+    //!         cheaper than the hint's upper bound, a null 
+    //!         pareto_approximator::PointAndSolution instance. ("no 
+    //!         improvement")
+    //! 
+    //! Dijkstra (or A\*) stops as soon as its queue reaches the upper 
+    //! bound, without settling the rest of the graph. (see 
+    //! BoundedAStarDijkstra) 
+    //! 
+    //! \sa MultiobjectiveSpOnPmgProblem::comb() and 
+    //!     pareto_approximator::BaseProblem::combWithHint()
+    //!
+    pa::PointAndSolution<PathToken> 
+    combWithHint(std::vector<double>::const_iterator weight, 
+                 std::vector<double>::const_iterator lastWeight, 
+                 const pa::CombHint<PathToken> & hint) 
     {
       Timer timer;
       timer.start();
 
-      pa::PointAndSolution<Path> result;
+      pa::PointAndSolution<PathToken> result;
+
+      unsigned int numObjectives = std::distance(weight, lastWeight);
+
+      // compute an optimal path for the combined objective function 
+      // (this sets the pred attribute of every node on the path), unless 
+      // no path beats the hint's upper bound
+      bool improved = runCombinedQuery(weight, lastWeight, 
+                                       hint.upperBound());
+
+      // increment the counter of comb() calls
+      ++numCallsToComb_;
+
+      if (not improved) {
+        timer.stop();
+        timeSpentInComb_ += timer.getElapsedTime();
+
+        // no improvement (BaseProblem will use the bound's vertex)
+        return result;
+      }
+      // else
+
+      // make the PointAndSolution object holding the result
+      // - the result will contain a point in objective space (with 
+      //   coordinates the values of the d objective functions) plus a 
+      //   token for the path that corresponds to that point (the path 
+      //   itself is only made by materializeSolution(), if at all)
+      result = computeCriteriaValuesUpToThisNode(
+                                         graph_.getNodeDescriptor(target_), 
+                                         numObjectives);
+
+      timer.stop();
+      timeSpentInComb_ += timer.getElapsedTime();
+
+      return result;
+    }
 
+    //! \brief Make the path a PathToken stands for. (for 
+    //!        pareto_approximator::LazyProblem)
+    //! 
+    //! \param tokenPoint A point comb() returned.
+    //! \return The s-t path comb() found for tokenPoint.weightsUsed.
+    //! 
+    //! Runs the same Dijkstra/A* query comb() ran for the point's weights 
+    //! (deterministically, so it finds the same path) and follows the 
+    //! target's pred attribute back to the source. Neither the query nor 
+    //! its time count as comb() calls or time spent in comb().
+    //! 
+    //! \sa MultiobjectiveSpOnPmgProblem::comb(), 
+    //!     MultiobjectiveSpOnPmgProblem::runQuery() and 
+    //!     pareto_approximator::LazyProblem
+    //!
+    Path 
+    materializeSolution(const pa::PointAndSolution<PathToken> & tokenPoint) 
+    {
+      runCombinedQuery(tokenPoint.weightsUsed.begin(), 
+                       tokenPoint.weightsUsed.end());
+
+      Path path = computePathUpToThisNode(graph_.getNodeDescriptor(target_));
+      assert(path.size() == tokenPoint.solution + 1);
+
+      return path;
+    }
+
+    //! \brief Compute an s-t path that minimizes a linear combination of 
+    //!        the objective functions.
+    //! 
+    //! \param weight Iterator to the initial position in an 
+    //!        std::vector<double> containing the weights w_{i} of the 
+    //!        objectives.
+    //! \param lastWeight Iterator to the past-the-end position in an 
+    //!        std::vector<double> containing the weights w_{i} of the 
+    //!        objectives.
+    //! \param bound An upper bound to the path's combined cost. (none by 
+    //!        default)
+    //! \return True if it found a path strictly cheaper than the bound; 
+    //!         false otherwise.
+    //! 
+    //! Sets each edge's "weight" (and, for A*, each node's heuristic 
+    //! value) and runs Dijkstra or A* (see useAStar_) from source_ to 
+    //! target_. The path can then be found by following the nodes' pred 
+    //! attributes back from target_.
+    //! 
+    //! Both run on BoundedAStarDijkstra (not on PGL's Dijkstra and A*), 
+    //! bounded or not, so that materializeSolution() always finds the path 
+    //! comb() found.
+    //! 
+    //! \sa MultiobjectiveSpOnPmgProblem::comb() and 
+    //!     MultiobjectiveSpOnPmgProblem::materializeSolution()
+    //!
+    bool 
+    runCombinedQuery(std::vector<double>::const_iterator weight, 
+                     std::vector<double>::const_iterator lastWeight, 
+                     double bound=std::numeric_limits<double>::infinity()) 
+    {
       unsigned int numObjectives = std::distance(weight, lastWeight);
       assert( (numObjectives == 2) || (numObjectives == 3) );
 
@@ -705,10 +853,11 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
           }
         }
 
-        // next, call PGL's A* implementation (we modified it so that it 
-        // uses each node's "heuristicValue" attribute as a heuristic)
-        AStarDijkstra<PmaGraph> aStarDijkstra(graph_, &timestamp_);
-        aStarDijkstra.runQuery(source_, target_);
+        // next, run A* (it uses each node's "heuristicValue" attribute 
+        // as a heuristic) up to the bound
+        BoundedAStarDijkstra<PmaGraph> aStarDijkstra(graph_, &timestamp_, 
+                                                     true);
+        return aStarDijkstra.runQuery(source_, target_, bound) < bound;
       }
       else {
         // Using Dijkstra's algorithm to compute an optimal solution for 
@@ -747,27 +896,10 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
           }
         }
 
-        // next, call PGL's Dijkstra implementation (this is the default)
-        Dijkstra<PmaGraph> dijkstra(graph_, &timestamp_);
-        dijkstra.runQuery(source_, target_);
+        // next, run Dijkstra (this is the default) up to the bound
+        BoundedAStarDijkstra<PmaGraph> dijkstra(graph_, &timestamp_, false);
+        return dijkstra.runQuery(source_, target_, bound) < bound;
       }
-
-      // increment the counter of comb() calls
-      ++numCallsToComb_;
-
-      // make the PointAndSolution object holding the result
-      // - the result will contain a point in objective space (with 
-      //   coordinates the values of the d objective functions) plus the 
-      //   solution that corresponds to that point plus the weights that 
-      //   produced that point
-      result = computePathAndCriteriaValuesUpToThisNode(
-                                         graph_.getNodeDescriptor(target_), 
-                                         numObjectives);
-
-      timer.stop();
-      timeSpentInComb_ += timer.getElapsedTime();
-
-      return result;
     }
 
     //! \brief Transform a vector of labels (which NAMOA\* has computed) to a 
@@ -843,20 +975,21 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
       return result;
     }
 
-    //! \brief Follows the given node's pred attribute to compute the path 
-    //!        up to here. Also computes the path's cost for every criterion.
+    //! \brief Follows the given node's pred attribute to compute the 
+    //!        path's cost for every criterion (but not the path itself).
     //! 
     //! \param n A node descriptor.
-    //! \return A pareto_approximator::PointAndSolution<Path> object 
-    //!         containing the point that corresponds to the path's criteria 
-    //!         costs and the path itself as an
-    //!         experiments_vs_namoa_star::Path object.
+    //! \param numObjectives How many objectives are we using?
+    //! \return A pareto_approximator::PointAndSolution<PathToken> object 
+    //!         containing the point that corresponds to the path's 
+    //!         criteria costs and the path's number of edges (as a 
+    //!         PathToken).
     //! 
-    //! This method makes the Path by recursively following the node's pred 
-    //! attribute to the node's predecessor. The node's (and every other 
-    //! node's in the graph) pred attribute must have been set by running 
-    //! PGL's single objective Dijkstra on the graph (for some 
-    //! s-t query).
+    //! This method walks the path by following the node's pred attribute 
+    //! to the node's predecessor (recursively) but does not store it. The 
+    //! node's (and every other node's in the graph) pred attribute must 
+    //! have been set by running single objective Dijkstra (or A*) on the 
+    //! graph (for some s-t query, see runCombinedQuery()).
     //! 
     //! We know we have reached the start of the path when a node's pred 
     //! attribute is NULL.
@@ -865,20 +998,21 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
     //! experiments_vs_namoa_star::MultiobjectiveSpOnPmgProblem::comb() and 
     //! only on the target node (to make comb's return value).
     //! 
-    //! \sa pareto_approximator::PointAndSolution and 
+    //! \sa MultiobjectiveSpOnPmgProblem::computePathUpToThisNode(), 
+    //!     pareto_approximator::PointAndSolution and 
     //!     pareto_approximator::BaseProblem::comb()
     //!
-    pa::PointAndSolution<Path> 
-    computePathAndCriteriaValuesUpToThisNode(const NodeDescriptor & n, 
-                                             unsigned int numObjectives) 
+    pa::PointAndSolution<PathToken> 
+    computeCriteriaValuesUpToThisNode(const NodeDescriptor & n, 
+                                      unsigned int numObjectives) 
     {
       assert( (numObjectives == 2) || (numObjectives == 3) );
 
-      pa::PointAndSolution<Path> result;
+      pa::PointAndSolution<PathToken> result;
 
       // Reminder: result.point will hold a pareto_approximator::Point 
       //           instance containing the path's (multiple) criteria costs
-      //           and result.solution will hold the actual path
+      //           and result.solution will hold the path's number of edges
 
       // about n.pred (and every Node's pred attribute in general)
       // - n.pred is a (void *) pointer but it can (and will) hold a 
@@ -894,13 +1028,12 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
       // sum the edges' criteria lists. 
       CriteriaList pathCriteriaCosts(numObjectives);
 
-      // make the current vertex (v) the end of the path
-      // - the path is currently empty
-      result.solution.push_back(currentNode);
+      // the path is currently empty
+      result.solution = 0;
 
       while (predecessorNode != graph_.nilNodeDescriptor()) {
-        // add the predecessor to the front of the path
-        result.solution.push_front(predecessorNode);
+        // one more edge
+        ++result.solution;
 
         // update the path's (multiple criteria) costs
         ei = graph_.getEdgeIterator(predecessorNode, currentNode);
@@ -923,6 +1056,37 @@ class MultiobjectiveSpOnPmgProblem : private pa::BaseProblem<Path>
       return result;
     }
 
+    //! \brief Follows the given node's pred attribute to compute the path 
+    //!        up to here.
+    //! 
+    //! \param n A node descriptor.
+    //! \return The path from the source to n, as an
+    //!         experiments_vs_namoa_star::Path object.
+    //! 
+    //! Like computeCriteriaValuesUpToThisNode(), the nodes' pred 
+    //! attributes must have been set by a Dijkstra (or A*) query.
+    //! 
+    //! We will only use this method inside 
+    //! experiments_vs_namoa_star::MultiobjectiveSpOnPmgProblem::materializeSolution().
+    //! 
+    //! \sa MultiobjectiveSpOnPmgProblem::computeCriteriaValuesUpToThisNode()
+    //!
+    Path 
+    computePathUpToThisNode(const NodeDescriptor & n) 
+    {
+      Path path;
+
+      NodeDescriptor currentNode = n;
+      while (currentNode != graph_.nilNodeDescriptor()) {
+        // add the node to the front of the path
+        path.push_front(currentNode);
+        currentNode = (NodeDescriptor) 
+                      graph_.getNodeIterator(currentNode)->pred;
+      }
+
+      return path;
+    }
+
     //! \brief A Packed Memory Array graph. (PGL's implementation)
     //!
     //! MultiobjectiveSpOnPmgProblem's constructor initially reads this from 
@@ -277,6 +277,14 @@ typedef PmaGraph::InEdgeIterator InEdgeIterator;
 //!
 typedef std::list<NodeDescriptor> Path;
 
+//! \brief What MultiobjectiveSpOnPmgProblem::comb() returns instead of a 
+//!        Path. (the path's number of edges)
+//!
+//! MultiobjectiveSpOnPmgProblem::materializeSolution() makes the actual 
+//! Path, only for the points we want the paths of.
+//!
+typedef unsigned int PathToken;
+
 
 }  // namespace experiments_vs_namoa_star
 
@@ -15,11 +15,11 @@
 #include <cmath>
 
 #include "experiments_vs_namoa_star_common.h"
-#include "Hyperplane.h"
 
 #include "../../Point.h"
 #include "../../PointAndSolution.h"
 #include "../../utility.h"
+#include "../../HullVertices.h"
 
 
 namespace pa = pareto_approximator;
@@ -91,137 +91,51 @@ parseQueriesFile(std::string filename)
 }
 
 
-//! \brief Find the point (pa::PointAndSolution<Path> instance) that has 
-//!        the smallest ith coordinate, from a sequence of points.
-//!
-//! We use this inside computeLowerConvexEnvelopeOfPoints().
-//!
-pa::PointAndSolution<Path> 
-findBestPointOnIthObjective(
-          std::vector< pa::PointAndSolution<Path> >::const_iterator first, 
-          std::vector< pa::PointAndSolution<Path> >::const_iterator last, 
-          unsigned int i)
-{
-  std::vector< pa::PointAndSolution<Path> >::const_iterator min = first;
-  for ( first = first + 1; first != last; ++first)
-    if (first->point[i] < min->point[i])
-      min = first;
-
-  return *min;
-}
-
-
 //! \brief Compute the lower part of the convex hull of the given set of 
 //!        points.
 //!
 //! \param points The set of points (PointAndSolution<Path> instances) whose 
 //!        lower convex envelope (i.e. lower part of the convex hull) we want.
-//! \return A list of the extreme points of the lower convex envelope. They 
-//!         will all be vertices of the convex hull (but not all vertices of 
-//!         the convex hull will be here).
-//!
-//! First calls pareto_approximator::utility::computeConvexHull(), which in 
-//! turn calls qhull's qconvex (see www.qhull.org), to compute the convex 
-//! hull of the set of points. It will return a set of the extreme points of 
-//! the convex hull, let's call them EH.
-//!
-//! Then discards all points of EH that are above the line connecting points 
-//! A and B, where A is the leftmost (i.e. best in x axis's criterion) point 
-//! of EH and B is the lowest (i.e. best in y axis's criterion) point of EH.
-//! Why? Because A and B will definitely be on the lower convex envelope but 
-//! points above the line AB will be on the upper half of the convex 
-//! envelope.
+//! \param spaceDimension The dimension of the space the points live in. 
+//!        (2 or 3)
+//! \return A list of the extreme points of the lower convex envelope. 
+//!         (sorted) They will all be vertices of the convex hull (but not 
+//!         all vertices of the convex hull will be here).
+//!
+//! Calls pareto_approximator::findLowerConvexEnvelopeVertices() on the 
+//! points' coordinates, which finds the lower convex envelope's vertices 
+//! directly: the points that are the only minimizer of some non-negative 
+//! linear combination of the objectives, i.e. the points Chord could find. 
+//! (the best point for each objective included)
 //!
 //! Note: We only use this function on sets of points NAMOA* computed, which 
 //!       will all be points of the Pareto set. One might think that, because 
-//!       of this, there wouldn't be any points above the line AB after 
-//!       computing EH but actually, a Pareto point can be above the line AB 
-//!       and still be Pareto optimal if the problem is not convex (i.e. 
-//!       objective functions not convex, etc).
+//!       of this, all the extreme points would be on the lower envelope but 
+//!       actually, a Pareto point can be above the lower envelope and still 
+//!       be Pareto optimal if the problem is not convex (i.e. objective 
+//!       functions not convex, etc).
 //!
-//! \sa pareto_approximator::utility::computeConvexHull()
+//! \sa pareto_approximator::findLowerConvexEnvelopeVertices()
 //!
 std::list< pa::PointAndSolution<Path> > 
 computeLowerConvexEnvelopeOfPoints(
                   const std::vector< pa::PointAndSolution<Path> > & points,
                   unsigned int spaceDimension)
 {
-  std::list< pa::PointAndSolution<Path> > results;
-
-  // we need at least #(spaceDimension+1) points to compute a convex hull
-  if (points.size() <= spaceDimension) {
-    // no need to continue, all points in "points" are on the lower envelope
-    results.assign(points.begin(), points.end());
-    return results;
-  }
-  // else
+  std::vector<double> coordinates;
+  coordinates.reserve(points.size() * spaceDimension);
+  for (unsigned int k = 0; k != points.size(); ++k)
+    for (unsigned int i = 0; i != spaceDimension; ++i)
+      coordinates.push_back(points[k].point[i]);
 
-  // first compute the convex hull of the set of points
-  // (and keep the extreme points (i.e. the vertices) of the convex hull)
-  std::list< pa::PointAndSolution<Path> > hull;
-  hull = pa::utility::computeConvexHull(points, spaceDimension);
+  std::vector<unsigned int> indices;
+  indices = pa::findLowerConvexEnvelopeVertices(coordinates, spaceDimension);
 
-  if (hull.size() <= spaceDimension) 
-    // no need to continue, all points in "results" 
-    // are on the lower envelope
-    return hull;
-  // else
-
-  // We only need the lower envelope (i.e. the lower half) of the convex hull.
-  // Find the best point for each objective (we call them anchor points), 
-  // compute the hyperplane that connects those points and discard any 
-  // points above the hyperplane. e.g. for 2 objectives:
-  // - find the leftmost (i.e. best in x axis criterion) extreme point, A
-  // - find the lowest (i.e. best in the y axis criterion) extreme point, B 
-  // - A and B (like all the points in "points") will both be on the 
-  //   all-positive quadrant (quadrant I of the Cartesian plane)
-  // - discard any point that is "above" (i.e. on the side further away from 
-  //   the origin of the Cartesian plane) the line connecting A and B
-
-  std::vector< pa::PointAndSolution<Path> > anchorPoints;
-  anchorPoints.reserve(spaceDimension);
-  for (unsigned int i = 0; i != spaceDimension; ++i) {
-    anchorPoints.push_back(findBestPointOnIthObjective(points.begin(), 
-                                                  points.end(), i));
-  }
-  Hyperplane hyperplane(anchorPoints.begin(), anchorPoints.end());
-  results.assign(anchorPoints.begin(), anchorPoints.end());
-
-  std::list< pa::PointAndSolution<Path> >::iterator it, last;
-  for (it = hull.begin(), last = hull.end(); it != last; ++it) {
-    if (not hyperplane.dominates(it->point))
-      results.push_back(*it);
-  }
+  std::list< pa::PointAndSolution<Path> > results;
+  for (unsigned int k = 0; k != indices.size(); ++k)
+    results.push_back(points[indices[k]]);
   results.sort();
 
-  /*
-  // the same for 2 objectives, without using a Hyperplane
-  pa::PointAndSolution<Path> & A = results.front();
-  pa::PointAndSolution<Path> & B = results.back();
-
-  double slope = (A.point[1] - B.point[1]) / (A.point[0] - B.point[0]);
-  double intercept = A.point[1] - slope * A.point[0];
-  //assert(B.point[1] - slope * B.point[0] == intercept);
-
-  std::list< pa::PointAndSolution<Path> >::iterator it, itToB;
-  it = results.begin();
-  ++it;     // iterator now points to the first element after A
-  itToB = results.end();
-  --itToB;  // iterator now points to B
-  // for all elements between A and B:
-  while (it != itToB) {
-    // if the element is on or above the line that connects A and B:
-    if ( it->point[1] - slope * it->point[0] >= intercept ) {
-      // remove the element (iterator moves to the next element)
-      it = results.erase(it);
-    }
-    else {
-      // next element
-      ++it;
-    }
-  }
-  */
-
   return results;
 }
 
@@ -181,7 +181,8 @@ forkAndRunQuery(evns::MultiobjectiveSpOnPmgProblem & problem,
       std::cout << "- Computing shortest path from node " << sourceNodeId << " to node " 
                 << targetNodeId << " using the Chord algorithm (& PGL's Dijkstra) ..." << std::endl;
       timer.start();
-      std::vector< pa::PointAndSolution<evns::Path> > rcd = problem.runQuery(sourceNodeId, targetNodeId, numObjectives, useNamoaStar);
+      // (we only need the points, not the paths)
+      std::vector< pa::PointAndSolution<evns::Path> > rcd = problem.runQuery(sourceNodeId, targetNodeId, numObjectives, useNamoaStar, useAStar, false);
       timer.stop();
       std::cout << "  (Shortest) distance between nodes: " << rcd[0].point[0] << "\n";
       std::cout << "  Elapsed time: " << timer.getElapsedTime() << " sec, " << problem.getTimeSpentInComb() << " of them spent in comb(), " << problem.getNumCallsToComb() << " calls to comb()\n";
@@ -199,7 +200,7 @@ forkAndRunQuery(evns::MultiobjectiveSpOnPmgProblem & problem,
       std::cout << "- Computing shortest path from node " << sourceNodeId << " to node " 
                 << targetNodeId << " using the Chord algorithm (& PGL's A*) ..." << std::endl;
       timer.start();
-      std::vector< pa::PointAndSolution<evns::Path> > rca = problem.runQuery(sourceNodeId, targetNodeId, numObjectives, useNamoaStar, useAStar);
+      std::vector< pa::PointAndSolution<evns::Path> > rca = problem.runQuery(sourceNodeId, targetNodeId, numObjectives, useNamoaStar, useAStar, false);
       timer.stop();
       std::cout << "  (Shortest) distance between nodes: " << rca[0].point[0] << "\n";
       std::cout << "  Elapsed time: " << timer.getElapsedTime() << " sec, " << problem.getTimeSpentInComb() << " of them spent in comb(), " << problem.getNumCallsToComb() << " calls to comb()\n";
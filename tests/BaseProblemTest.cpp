@@ -8,25 +8,303 @@
 #include <string>
 #include <list>
 #include <algorithm>
+#include <limits>
+#include <memory>
+#include <cmath>
 
 #include "gtest/gtest.h"
 #include "../Point.h"
 #include "../PointAndSolution.h"
+#include "../LazyProblem.h"
+#include "../HullVertices.h"
 #include "NonOptimalStartingPointsProblem.h"
 #include "SmallBiobjectiveSPProblem.h"
 #include "SmallTripleobjectiveSPProblem.h"
 #include "TripleobjectiveWithNegativeWeightsProblem.h"
+#include "SphereFrontProblem.h"
 
 
 using std::string;
 
 using pareto_approximator::Point;
 using pareto_approximator::PointAndSolution;
+using pareto_approximator::BaseProblem;
+using pareto_approximator::LazyProblem;
+using pareto_approximator::findLowerConvexEnvelopeVertices;
 
 
 namespace {
 
 
+// A NonOptimalStartingPointsProblem that prefers getting its weight vectors 
+// in batches. (counts the batches and remembers the largest one)
+class BatchedNonOptimalStartingPointsProblem : 
+          public non_optimal_starting_points_problem::NonOptimalStartingPointsProblem
+{
+  public:
+    BatchedNonOptimalStartingPointsProblem(unsigned int dimension) : 
+            NonOptimalStartingPointsProblem(dimension), 
+            numBatches(0), largestBatchSize(0) { }
+
+    std::vector< PointAndSolution<string> > 
+    combBatch(const std::vector< std::vector<double> > & weightVectors) 
+    {
+      ++numBatches;
+      largestBatchSize = std::max(largestBatchSize, 
+                                  (unsigned int) weightVectors.size());
+      return NonOptimalStartingPointsProblem::combBatch(weightVectors);
+    }
+
+    bool prefersCombBatches() const { return true; }
+
+    unsigned int numBatches;
+    unsigned int largestBatchSize;
+};
+
+
+// A NonOptimalStartingPointsProblem that counts its comb() calls.
+class CountingNonOptimalStartingPointsProblem : 
+          public non_optimal_starting_points_problem::NonOptimalStartingPointsProblem
+{
+  public:
+    CountingNonOptimalStartingPointsProblem(unsigned int dimension) : 
+            NonOptimalStartingPointsProblem(dimension), numCombCalls(0) { }
+
+    PointAndSolution<string> comb(std::vector<double>::const_iterator first, 
+                                  std::vector<double>::const_iterator last)
+    {
+      ++numCombCalls;
+      return NonOptimalStartingPointsProblem::comb(first, last);
+    }
+
+    unsigned int numCombCalls;
+};
+
+
+// A SphereFrontProblem that checks the hints combWithHint() gets: every 
+// hint point must be a point comb() returned (with its solution and 
+// weights). (counts the empty and the non-empty hints and remembers the 
+// largest one)
+class HintedSphereFrontProblem : 
+          public sphere_front_problem::SphereFrontProblem
+{
+  public:
+    HintedSphereFrontProblem(unsigned int dimension) : 
+            SphereFrontProblem(dimension), numObjectives(dimension), 
+            numEmptyHints(0), numHints(0), largestHintSize(0), 
+            numBadHintPoints(0) { }
+
+    PointAndSolution<string> 
+    combWithHint(std::vector<double>::const_iterator first, 
+                 std::vector<double>::const_iterator last, 
+                 const pareto_approximator::CombHint<string> & hint)
+    {
+      if (hint.empty())
+        ++numEmptyHints;
+      else {
+        ++numHints;
+        largestHintSize = std::max(largestHintSize, hint.size());
+        for (unsigned int k = 0; k != hint.size(); ++k) {
+          const PointAndSolution<string> & vertex = hint.vertex(k);
+          if (not isOnTheFront(vertex) or 
+              vertex.weightsUsed.size() != numObjectives or 
+              vertex.solution != comb(vertex.weightsUsed.begin(), 
+                                      vertex.weightsUsed.end()).solution)
+            ++numBadHintPoints;
+        }
+        // (the closest point must be one of them)
+        const PointAndSolution<string> & closest = 
+                                          hint.closestVertex(first, last);
+        if (not isOnTheFront(closest))
+          ++numBadHintPoints;
+      }
+
+      return comb(first, last);
+    }
+
+    unsigned int numObjectives;
+    unsigned int numEmptyHints;
+    unsigned int numHints;
+    unsigned int largestHintSize;
+    unsigned int numBadHintPoints;
+};
+
+
+// A SphereFrontProblem whose comb() is only (1+delta)-approximate: it 
+// returns the optimal point times (1+delta). (the worst it may do) It 
+// declares its delta unless told not to.
+class ApproximateSphereFrontProblem : 
+          public sphere_front_problem::SphereFrontProblem
+{
+  public:
+    ApproximateSphereFrontProblem(unsigned int dimension, double delta, 
+                                  bool declareDelta=true) : 
+            SphereFrontProblem(dimension), delta(delta)
+    {
+      if (declareDelta)
+        setCombApproximationDelta(delta);
+    }
+
+    PointAndSolution<string> comb(std::vector<double>::const_iterator first, 
+                                  std::vector<double>::const_iterator last)
+    {
+      Point point = SphereFrontProblem::comb(first, last).point;
+      std::vector<double> coordinates;
+      for (unsigned int i = 0; i != point.dimension(); ++i)
+        coordinates.push_back((1.0 + delta) * point[i]);
+      return PointAndSolution<string>(Point(coordinates.begin(), 
+                                            coordinates.end()), 
+                                      "approximately sphere");
+    }
+
+    double delta;
+};
+
+
+// A problem whose combWithHint() answers like a search pruned with the 
+// hint's upper bound would: "no improvement" (a null point) unless 
+// comb()'s optimum is strictly better than the bound. (counts the "no 
+// improvement" answers and the bounds below comb()'s optimal value)
+template <class P, class S>
+class PruningProblem : public P
+{
+  public:
+    using P::P;
+
+    PointAndSolution<S> 
+    combWithHint(std::vector<double>::const_iterator first, 
+                 std::vector<double>::const_iterator last, 
+                 const pareto_approximator::CombHint<S> & hint)
+    {
+      PointAndSolution<S> result = this->comb(first, last);
+      if (not hint.hasUpperBound())
+        return result;
+      // else
+
+      double value = 0.0;
+      for (unsigned int i = 0; first + i != last; ++i)
+        value += *(first + i) * result.point[i];
+      if (value > hint.upperBound() + 1e-9)
+        ++numBadBounds;
+      if (value < hint.upperBound())
+        return result;
+      // else
+
+      ++numNoImprovements;
+      return PointAndSolution<S>();
+    }
+
+    unsigned int numNoImprovements = 0;
+    unsigned int numBadBounds = 0;
+};
+
+
+// A SphereFrontProblem with move-only solutions. (each solution is a 
+// std::unique_ptr to a copy of its point)
+class MoveOnlySphereFrontProblem : 
+          public BaseProblem< std::unique_ptr<Point> >
+{
+  public:
+    MoveOnlySphereFrontProblem(unsigned int dimension) : sfp(dimension) { }
+
+    PointAndSolution< std::unique_ptr<Point> > 
+    comb(std::vector<double>::const_iterator first, 
+         std::vector<double>::const_iterator last)
+    {
+      Point point = sfp.comb(first, last).point;
+      return PointAndSolution< std::unique_ptr<Point> >(point, 
+                                std::unique_ptr<Point>(new Point(point)));
+    }
+
+    sphere_front_problem::SphereFrontProblem sfp;
+};
+
+
+// A SphereFrontProblem whose comb() returns the number of the comb() call 
+// as a token. materializeSolution() makes the same string 
+// SphereFrontProblem's comb() returns. (counts its calls)
+class LazySphereFrontProblem : public LazyProblem<string, unsigned int>
+{
+  public:
+    LazySphereFrontProblem(unsigned int dimension) : sfp(dimension), 
+                                                      numCombCalls(0), 
+                                                      numMaterializations(0) 
+    { }
+
+    PointAndSolution<unsigned int> 
+    comb(std::vector<double>::const_iterator first, 
+         std::vector<double>::const_iterator last)
+    {
+      return PointAndSolution<unsigned int>(sfp.comb(first, last).point, 
+                                            numCombCalls++);
+    }
+
+    string 
+    materializeSolution(const PointAndSolution<unsigned int> & tokenPoint)
+    {
+      ++numMaterializations;
+      return sfp.comb(tokenPoint.weightsUsed.begin(), 
+                      tokenPoint.weightsUsed.end()).solution;
+    }
+
+    sphere_front_problem::SphereFrontProblem sfp;
+    unsigned int numCombCalls;
+    unsigned int numMaterializations;
+};
+
+
+// A problem with a finite set of points: "numPoints" pseudo-random points 
+// close to the sphere of radius 1000 around (2000, 2000, ...). comb() 
+// returns the (first) point that minimizes the weighted sum; its solution 
+// is the point's index.
+class FinitePointSetProblem : public BaseProblem<unsigned int>
+{
+  public:
+    FinitePointSetProblem(unsigned int dimension, unsigned int numPoints, 
+                          unsigned int seed) : dimension(dimension)
+    {
+      std::vector<double> p(dimension);
+      for (unsigned int k = 0; k != numPoints; ++k) {
+        double length = 0.0;
+        for (unsigned int i = 0; i != dimension; ++i) {
+          seed = seed * 1103515245 + 12345;
+          p[i] = (seed >> 16) % 2001 - 1000.0;
+          length += p[i] * p[i];
+        }
+        length = std::sqrt(length);
+        seed = seed * 1103515245 + 12345;
+        double radius = 1000.0 - (seed >> 16) % 50;
+        for (unsigned int i = 0; i != dimension; ++i)
+          coordinates.push_back(length > 0.0 ? 
+                                2000.0 + radius * p[i] / length : 2000.0);
+      }
+    }
+
+    PointAndSolution<unsigned int> 
+    comb(std::vector<double>::const_iterator first, 
+         std::vector<double>::const_iterator last)
+    {
+      unsigned int best = 0;
+      double bestValue = 0.0;
+      for (unsigned int k = 0; k != coordinates.size() / dimension; ++k) {
+        double value = 0.0;
+        for (unsigned int i = 0; first + i != last; ++i)
+          value += *(first + i) * coordinates[k * dimension + i];
+        if (k == 0 or value < bestValue) {
+          best = k;
+          bestValue = value;
+        }
+      }
+      return PointAndSolution<unsigned int>(
+                Point(coordinates.begin() + best * dimension, 
+                      coordinates.begin() + (best + 1) * dimension), best);
+    }
+
+    unsigned int dimension;
+    std::vector<double> coordinates;
+};
+
+
 // The fixture for testing the BaseProblem wrapper class template.
 // (and our implementation of the chord algorithm)
 class BaseProblemTest : public ::testing::Test 
@@ -36,11 +314,44 @@ class BaseProblemTest : public ::testing::Test
     
     ~BaseProblemTest() { }
 
-    static const double smallEpsilon = 0.001;
-    static const double verySmallEpsilon = 1e-12;
+    static const double smallEpsilon;
+    static const double verySmallEpsilon;
+
+    // Check that "paretoSet" is an (1+eps)-approximate convex Pareto set 
+    // of the SphereFrontProblem "sfp", using some weight vectors.
+    // - For every weight vector w some point p of the set must have 
+    //   w*p <= (1+eps) * (the optimal value of w*x).
+    void expectApproximateConvexParetoSet(
+            const sphere_front_problem::SphereFrontProblem & sfp, 
+            unsigned int numObjectives, double eps, 
+            const std::vector< PointAndSolution<string> > & paretoSet)
+    {
+      // deterministic pseudo-random weights
+      unsigned int seed = 12345;
+      for (unsigned int k = 0; k != 200; ++k) {
+        std::vector<double> weights;
+        for (unsigned int i = 0; i != numObjectives; ++i) {
+          seed = seed * 1103515245 + 12345;
+          weights.push_back(0.01 + (seed >> 16) % 1000);
+        }
+
+        double best = std::numeric_limits<double>::infinity();
+        for (unsigned int j = 0; j != paretoSet.size(); ++j) {
+          double value = 0.0;
+          for (unsigned int i = 0; i != numObjectives; ++i)
+            value += weights[i] * paretoSet[j].point[i];
+          best = std::min(best, value);
+        }
+        EXPECT_LE(best, (1.0 + eps) * sfp.optimalValue(weights));
+      }
+    }
 };
 
 
+const double BaseProblemTest::smallEpsilon = 0.001;
+const double BaseProblemTest::verySmallEpsilon = 1e-12;
+
+
 // Test that the computeConvexParetoSet() method finds the correct 
 // (approximate) convex Pareto set for the SmallBiobjectiveSPProblem problem 
 // class (child of BaseProblem). 
@@ -97,6 +408,253 @@ TEST_F(BaseProblemTest, BiobjectiveNonOptimalStartingPointsProblem)
 }
 
 
+// Test that computeConvexParetoSet() finds the same (approximate) convex 
+// Pareto set whether it uses one or more threads. (biobjective problems)
+TEST_F(BaseProblemTest, BiobjectiveParallelChordMatchesSerialChord)
+{
+  using small_biobjective_sp_problem::SmallBiobjectiveSPProblem;
+  using small_biobjective_sp_problem::PredecessorMap;
+  using non_optimal_starting_points_problem::NonOptimalStartingPointsProblem;
+
+  unsigned int numObjectives = 2;
+  double epsilons[] = { verySmallEpsilon, smallEpsilon, 0.1 };
+
+  for (unsigned int e = 0; e != 3; ++e) {
+    SmallBiobjectiveSPProblem sbspp;
+    std::vector< PointAndSolution<PredecessorMap> > serial, parallel;
+    serial = sbspp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    sbspp.setNumThreads(4);
+    EXPECT_EQ(4, sbspp.getNumThreads());
+    parallel = sbspp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    std::sort(serial.begin(), serial.end());
+    std::sort(parallel.begin(), parallel.end());
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (unsigned int i = 0; i != serial.size(); ++i)
+      EXPECT_EQ(serial[i].point, parallel[i].point);
+
+    NonOptimalStartingPointsProblem nospp(numObjectives);
+    std::vector< PointAndSolution<string> > serialNos, parallelNos;
+    serialNos = nospp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    nospp.setNumThreads(3);
+    parallelNos = nospp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    std::sort(serialNos.begin(), serialNos.end());
+    std::sort(parallelNos.begin(), parallelNos.end());
+    ASSERT_EQ(serialNos.size(), parallelNos.size());
+    for (unsigned int i = 0; i != serialNos.size(); ++i) {
+      EXPECT_EQ(serialNos[i].point, parallelNos[i].point);
+      EXPECT_EQ(serialNos[i].solution, parallelNos[i].solution);
+    }
+  }
+}
+
+
+// Test that Chord passes the weight vectors of all the facets it has not 
+// tried yet to combBatch() at once (if the problem prefers batches) and 
+// still finds the same points.
+TEST_F(BaseProblemTest, BiobjectiveChordUsesCombBatches)
+{
+  using non_optimal_starting_points_problem::NonOptimalStartingPointsProblem;
+
+  unsigned int numObjectives = 2;
+  NonOptimalStartingPointsProblem nospp(numObjectives);
+  BatchedNonOptimalStartingPointsProblem bnospp(numObjectives);
+  std::vector< PointAndSolution<string> > paretoSet, batchedParetoSet;
+  paretoSet = nospp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  batchedParetoSet = bnospp.computeConvexParetoSet(numObjectives, 
+                                                   verySmallEpsilon);
+  std::sort(paretoSet.begin(), paretoSet.end());
+  std::sort(batchedParetoSet.begin(), batchedParetoSet.end());
+
+  // the anchors come in one batch, the facets in at least one more
+  EXPECT_LE(2, bnospp.numBatches);
+  EXPECT_EQ(numObjectives, bnospp.largestBatchSize);
+  ASSERT_EQ(paretoSet.size(), batchedParetoSet.size());
+  for (unsigned int i = 0; i != paretoSet.size(); ++i) {
+    EXPECT_EQ(paretoSet[i].point, batchedParetoSet[i].point);
+    EXPECT_EQ(paretoSet[i].solution, batchedParetoSet[i].solution);
+  }
+}
+
+
+// Test that a coarse weight vector tolerance saves comb() calls (weight 
+// vectors that almost match reuse earlier points) and that the memo of 
+// comb() results is cleared by each computeConvexParetoSet() call.
+TEST_F(BaseProblemTest, BiobjectiveWeightVectorToleranceSavesCombCalls)
+{
+  unsigned int numObjectives = 2;
+  CountingNonOptimalStartingPointsProblem exact(numObjectives);
+  EXPECT_EQ(0.0, exact.getWeightVectorTolerance());
+  std::vector< PointAndSolution<string> > paretoSet;
+  paretoSet = exact.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  unsigned int numExactCombCalls = exact.numCombCalls;
+  EXPECT_EQ(4, paretoSet.size());
+
+  // same weight vectors, same number of comb() calls
+  exact.numCombCalls = 0;
+  paretoSet = exact.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(numExactCombCalls, exact.numCombCalls);
+  EXPECT_EQ(4, paretoSet.size());
+
+  CountingNonOptimalStartingPointsProblem coarse(numObjectives);
+  coarse.setWeightVectorTolerance(0.25);
+  EXPECT_EQ(0.25, coarse.getWeightVectorTolerance());
+  paretoSet = coarse.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_GT(numExactCombCalls, coarse.numCombCalls);
+  // the anchors are still there
+  std::sort(paretoSet.begin(), paretoSet.end());
+  ASSERT_LE(2, paretoSet.size());
+  EXPECT_EQ("best-on-x", paretoSet.front().solution);
+  EXPECT_EQ("best-on-y", paretoSet.back().solution);
+}
+
+
+// Test that computeConvexParetoSet() stops when it runs out of comb() 
+// calls and reports the (larger) approximation error upper bound it 
+// reached. (biobjective problems)
+TEST_F(BaseProblemTest, BiobjectiveMaxCombCallsStopsChordEarly)
+{
+  using small_biobjective_sp_problem::SmallBiobjectiveSPProblem;
+  using small_biobjective_sp_problem::PredecessorMap;
+
+  unsigned int numObjectives = 2;
+  SmallBiobjectiveSPProblem sbspp;
+  EXPECT_EQ(0, sbspp.getMaxCombCalls());
+  std::vector< PointAndSolution<PredecessorMap> > paretoSet;
+  paretoSet = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  unsigned int numCombCalls = sbspp.getNumCombCalls();
+  double errorUpperBound = sbspp.getApproximationErrorUpperBound();
+  EXPECT_EQ(4, paretoSet.size());
+  EXPECT_LT(numObjectives + 1, numCombCalls);
+  EXPECT_LE(errorUpperBound, verySmallEpsilon);
+
+  // the anchors plus a single facet
+  sbspp.setMaxCombCalls(numObjectives + 1);
+  EXPECT_EQ(numObjectives + 1, sbspp.getMaxCombCalls());
+  paretoSet = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(numObjectives + 1, sbspp.getNumCombCalls());
+  EXPECT_GT(sbspp.getApproximationErrorUpperBound(), verySmallEpsilon);
+  EXPECT_LE(2, paretoSet.size());
+  EXPECT_GT(4, paretoSet.size());
+
+  // the anchors are always computed
+  sbspp.setMaxCombCalls(1);
+  paretoSet = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(numObjectives, sbspp.getNumCombCalls());
+  EXPECT_EQ(2, paretoSet.size());
+
+  // the same budget works in rounds too
+  sbspp.setMaxCombCalls(numObjectives + 1);
+  sbspp.setNumThreads(4);
+  paretoSet = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(numObjectives + 1, sbspp.getNumCombCalls());
+  EXPECT_GT(sbspp.getApproximationErrorUpperBound(), verySmallEpsilon);
+
+  // a budget large enough changes nothing
+  sbspp.setMaxCombCalls(numCombCalls);
+  paretoSet = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(4, paretoSet.size());
+  EXPECT_EQ(errorUpperBound, sbspp.getApproximationErrorUpperBound());
+}
+
+
+// Test that computeConvexParetoSet() stops when its time is up. 
+// (biobjective problems)
+TEST_F(BaseProblemTest, BiobjectiveTimeLimitStopsChordEarly)
+{
+  using non_optimal_starting_points_problem::NonOptimalStartingPointsProblem;
+
+  unsigned int numObjectives = 2;
+  NonOptimalStartingPointsProblem nospp(numObjectives);
+  EXPECT_EQ(0.0, nospp.getTimeLimit());
+
+  // the time is up right after the anchors are computed
+  nospp.setTimeLimit(1e-9);
+  EXPECT_EQ(1e-9, nospp.getTimeLimit());
+  std::vector< PointAndSolution<string> > paretoSet;
+  paretoSet = nospp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(numObjectives, nospp.getNumCombCalls());
+  EXPECT_GT(nospp.getApproximationErrorUpperBound(), verySmallEpsilon);
+  EXPECT_LE(2, paretoSet.size());
+
+  // plenty of time
+  nospp.setTimeLimit(3600.0);
+  paretoSet = nospp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  EXPECT_EQ(4, paretoSet.size());
+  EXPECT_LE(nospp.getApproximationErrorUpperBound(), verySmallEpsilon);
+}
+
+
+// Test that the streaming computeConvexParetoSet() passes every point 
+// it finds to the callback (the anchors first) together with the current 
+// approximation error upper bound. (biobjective problems)
+TEST_F(BaseProblemTest, BiobjectiveCallbackGetsEveryNewPoint)
+{
+  using non_optimal_starting_points_problem::NonOptimalStartingPointsProblem;
+
+  unsigned int numObjectives = 2;
+  NonOptimalStartingPointsProblem nospp(numObjectives);
+  std::vector< PointAndSolution<string> > paretoSet, streamedPoints;
+  std::vector<double> bounds;
+  paretoSet = nospp.computeConvexParetoSet(numObjectives, verySmallEpsilon, 
+          [&] (const PointAndSolution<string> & newPoint, double bound) {
+            streamedPoints.push_back(newPoint);
+            bounds.push_back(bound);
+            return true;
+          });
+  std::sort(paretoSet.begin(), paretoSet.end());
+
+  ASSERT_EQ(4, paretoSet.size());
+  ASSERT_LE(paretoSet.size(), streamedPoints.size());
+  EXPECT_EQ("best-on-x", streamedPoints[0].solution);
+  EXPECT_EQ("best-on-y", streamedPoints[1].solution);
+  // (the final bound is only known after the last point is accepted)
+  EXPECT_GT(bounds.front(), verySmallEpsilon);
+  EXPECT_GE(bounds.front(), bounds.back());
+  EXPECT_LE(nospp.getApproximationErrorUpperBound(), verySmallEpsilon);
+  for (unsigned int i = 0; i != paretoSet.size(); ++i)
+    EXPECT_TRUE(std::find(streamedPoints.begin(), streamedPoints.end(), 
+                          paretoSet[i]) != streamedPoints.end());
+}
+
+
+// Test that the callback can cancel the computation. computeConvexParetoSet() 
+// should return (unfiltered) the points it passed to the callback.
+TEST_F(BaseProblemTest, BiobjectiveCallbackCanCancel)
+{
+  using small_biobjective_sp_problem::SmallBiobjectiveSPProblem;
+  using small_biobjective_sp_problem::PredecessorMap;
+
+  unsigned int numObjectives = 2;
+  SmallBiobjectiveSPProblem sbspp;
+  sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon);
+  unsigned int numCombCalls = sbspp.getNumCombCalls();
+
+  unsigned int numStreamedPoints = 0;
+  std::vector< PointAndSolution<PredecessorMap> > points;
+  points = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon, 
+          [&] (const PointAndSolution<PredecessorMap> &, double) {
+            ++numStreamedPoints;
+            return numStreamedPoints < 3;
+          });
+
+  EXPECT_EQ(3, numStreamedPoints);
+  EXPECT_EQ(3, points.size());
+  EXPECT_GT(numCombCalls, sbspp.getNumCombCalls());
+  EXPECT_GT(sbspp.getApproximationErrorUpperBound(), verySmallEpsilon);
+
+  // cancelling right after the anchors
+  numStreamedPoints = 0;
+  points = sbspp.computeConvexParetoSet(numObjectives, verySmallEpsilon, 
+          [&] (const PointAndSolution<PredecessorMap> &, double) {
+            ++numStreamedPoints;
+            return false;
+          });
+  EXPECT_EQ(1, numStreamedPoints);
+  EXPECT_EQ(numObjectives, points.size());
+  EXPECT_EQ(numObjectives, sbspp.getNumCombCalls());
+}
+
+
 // Test computeConvexParetoSet().
 // Test that non-optimal starting points are correctly deleted when 
 // points that dominate them are found.
@@ -198,6 +756,334 @@ TEST_F(BaseProblemTest, TripleobjectiveWithNegativeWeightsProblem)
 }
 
 
+// Test that, with eps = 0, PGEN only finds vertices of the lower convex 
+// envelope of a finite three-objective point set and that it only reports 
+// a zero approximation error upper bound if it found all of them. Facets 
+// whose normal vectors have negative elements must stay in the search in 
+// three dimensions.
+TEST_F(BaseProblemTest, TripleObjectivePgenFindsLowerEnvelopeVertices)
+{
+  unsigned int numObjectives = 3;
+  for (unsigned int seed = 41; seed <= 60; ++seed) {
+    FinitePointSetProblem fpsp(numObjectives, 300, seed);
+    std::vector<unsigned int> envelope;
+    envelope = findLowerConvexEnvelopeVertices(fpsp.coordinates, 
+                                               numObjectives);
+    std::vector< PointAndSolution<unsigned int> > paretoSet;
+    paretoSet = fpsp.computeConvexParetoSet(numObjectives, 0.0);
+
+    std::vector<unsigned int> found;
+    for (unsigned int j = 0; j != paretoSet.size(); ++j) {
+      EXPECT_TRUE(std::binary_search(envelope.begin(), envelope.end(), 
+                                     paretoSet[j].solution));
+      found.push_back(paretoSet[j].solution);
+    }
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+    EXPECT_EQ(found.size(), paretoSet.size());
+    // A zero bound means that every envelope vertex was found. (with 
+    // the strips along the hull's edges PGEN finds them all)
+    EXPECT_EQ(0.0, fpsp.getApproximationErrorUpperBound());
+    if (fpsp.getApproximationErrorUpperBound() == 0.0) {
+      EXPECT_EQ(envelope, found) << "seed " << seed;
+    }
+  }
+}
+
+
+// Test that with more than one thread PGEN works in rounds: the points 
+// it finds do not depend on the number of threads and may differ from 
+// the serial ones, but they reach the same approximation error upper 
+// bound. (with eps = 0 both find every vertex of the lower convex 
+// envelope, i.e. the same points)
+TEST_F(BaseProblemTest, TripleObjectiveParallelPgenWorksInRounds)
+{
+  unsigned int numObjectives = 3;
+  double epsilons[] = { 0.0, smallEpsilon, 0.1 };
+
+  for (unsigned int e = 0; e != 3; ++e) {
+    FinitePointSetProblem fpsp(numObjectives, 300, 41);
+    std::vector< PointAndSolution<unsigned int> > serial, parallel, 
+                                                  moreParallel;
+    serial = fpsp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    EXPECT_LE(fpsp.getApproximationErrorUpperBound(), epsilons[e]);
+    fpsp.setNumThreads(2);
+    parallel = fpsp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    EXPECT_LE(fpsp.getApproximationErrorUpperBound(), epsilons[e]);
+    fpsp.setNumThreads(4);
+    moreParallel = fpsp.computeConvexParetoSet(numObjectives, epsilons[e]);
+    EXPECT_LE(fpsp.getApproximationErrorUpperBound(), epsilons[e]);
+    std::sort(serial.begin(), serial.end());
+    std::sort(parallel.begin(), parallel.end());
+    std::sort(moreParallel.begin(), moreParallel.end());
+
+    ASSERT_EQ(parallel.size(), moreParallel.size());
+    for (unsigned int i = 0; i != parallel.size(); ++i)
+      EXPECT_EQ(parallel[i].solution, moreParallel[i].solution);
+
+    if (epsilons[e] == 0.0) {
+      ASSERT_EQ(serial.size(), parallel.size());
+      for (unsigned int i = 0; i != serial.size(); ++i)
+        EXPECT_EQ(serial[i].solution, parallel[i].solution);
+    }
+  }
+}
+
+
+// Test that PGEN works for four objectives. SphereFrontProblem's Pareto 
+// set is (a part of) a 4-dimensional sphere.
+TEST_F(BaseProblemTest, FourObjectiveSphereFrontProblem)
+{
+  using sphere_front_problem::SphereFrontProblem;
+
+  unsigned int numObjectives = 4;
+  double eps = 0.01;
+  SphereFrontProblem sfp(numObjectives);
+  std::vector< PointAndSolution<string> > paretoSet;
+  paretoSet = sfp.computeConvexParetoSet(numObjectives, eps);
+
+  EXPECT_LT(numObjectives, paretoSet.size());
+  for (unsigned int j = 0; j != paretoSet.size(); ++j) 
+    EXPECT_TRUE(sfp.isOnTheFront(paretoSet[j]));
+  EXPECT_LE(sfp.getApproximationErrorUpperBound(), eps);
+  EXPECT_EQ(sfp.numCombCalls, sfp.getNumCombCalls());
+  expectApproximateConvexParetoSet(sfp, numObjectives, eps, paretoSet);
+}
+
+
+// Test that PGEN works for five objectives and that a smaller eps costs 
+// more comb() calls.
+TEST_F(BaseProblemTest, FiveObjectiveSphereFrontProblem)
+{
+  using sphere_front_problem::SphereFrontProblem;
+
+  unsigned int numObjectives = 5;
+  double coarseEps = 0.1;
+  double eps = 0.05;
+  SphereFrontProblem coarseSfp(numObjectives);
+  SphereFrontProblem sfp(numObjectives);
+  std::vector< PointAndSolution<string> > coarseParetoSet, paretoSet;
+  coarseParetoSet = coarseSfp.computeConvexParetoSet(numObjectives, 
+                                                     coarseEps);
+  paretoSet = sfp.computeConvexParetoSet(numObjectives, eps);
+
+  EXPECT_LT(numObjectives, paretoSet.size());
+  for (unsigned int j = 0; j != paretoSet.size(); ++j) 
+    EXPECT_TRUE(sfp.isOnTheFront(paretoSet[j]));
+  EXPECT_LE(sfp.getApproximationErrorUpperBound(), eps);
+  EXPECT_LE(coarseSfp.getApproximationErrorUpperBound(), coarseEps);
+  EXPECT_LT(coarseSfp.getNumCombCalls(), sfp.getNumCombCalls());
+  expectApproximateConvexParetoSet(sfp, numObjectives, eps, paretoSet);
+  expectApproximateConvexParetoSet(coarseSfp, numObjectives, coarseEps, 
+                                   coarseParetoSet);
+}
+
+
+// Test that Chord and PGEN pass each facet's points to combWithHint() 
+// (the anchor points get empty hints) and find the same points as 
+// without hints.
+TEST_F(BaseProblemTest, CombGetsFacetVerticesAsHints)
+{
+  using sphere_front_problem::SphereFrontProblem;
+
+  double eps = 0.01;
+  for (unsigned int numObjectives = 2; numObjectives <= 3; 
+       ++numObjectives) {
+    SphereFrontProblem sfp(numObjectives);
+    HintedSphereFrontProblem hsfp(numObjectives);
+    std::vector< PointAndSolution<string> > paretoSet, hintedParetoSet;
+    paretoSet = sfp.computeConvexParetoSet(numObjectives, eps);
+    hintedParetoSet = hsfp.computeConvexParetoSet(numObjectives, eps);
+
+    EXPECT_EQ(numObjectives, hsfp.numEmptyHints);
+    EXPECT_LT(0, hsfp.numHints);
+    EXPECT_EQ(numObjectives, hsfp.largestHintSize);
+    EXPECT_EQ(0, hsfp.numBadHintPoints);
+    EXPECT_EQ(sfp.getNumCombCalls(), hsfp.getNumCombCalls());
+    ASSERT_EQ(paretoSet.size(), hintedParetoSet.size());
+    for (unsigned int i = 0; i != paretoSet.size(); ++i) {
+      EXPECT_EQ(paretoSet[i].point, hintedParetoSet[i].point);
+      EXPECT_EQ(paretoSet[i].solution, hintedParetoSet[i].solution);
+    }
+  }
+}
+
+
+// Compute problem's convex Pareto set with and without pruning and 
+// compare them.
+template <class P, class S>
+void 
+expectPruningFindsTheSamePoints(P & problem, PruningProblem<P, S> & pruning, 
+                                unsigned int numObjectives, double eps)
+{
+  std::vector< PointAndSolution<S> > paretoSet, prunedParetoSet;
+  paretoSet = problem.computeConvexParetoSet(numObjectives, eps);
+  prunedParetoSet = pruning.computeConvexParetoSet(numObjectives, eps);
+  std::sort(paretoSet.begin(), paretoSet.end());
+  std::sort(prunedParetoSet.begin(), prunedParetoSet.end());
+
+  EXPECT_EQ(0, pruning.numBadBounds);
+  EXPECT_LT(0, pruning.numNoImprovements);
+  EXPECT_EQ(problem.getNumCombCalls(), pruning.getNumCombCalls());
+  ASSERT_EQ(paretoSet.size(), prunedParetoSet.size());
+  for (unsigned int i = 0; i != paretoSet.size(); ++i) {
+    EXPECT_EQ(paretoSet[i].point, prunedParetoSet[i].point);
+    EXPECT_FALSE(prunedParetoSet[i].isNull());
+  }
+}
+
+
+// Test that Chord and PGEN still find an (1+eps)-approximate convex 
+// Pareto set if comb() is (1+delta)-approximate (and says so), that the 
+// approximation error upper bound includes delta and that a declared 
+// delta costs more comb() calls.
+TEST_F(BaseProblemTest, ApproximateCombDeltaIsAccountedFor)
+{
+  double eps = 0.05;
+  double delta = 0.02;
+  for (unsigned int numObjectives = 2; numObjectives <= 3; 
+       ++numObjectives) {
+    ApproximateSphereFrontProblem asfp(numObjectives, delta);
+    EXPECT_EQ(delta, asfp.getCombApproximationDelta());
+    std::vector<double> callbackBounds;
+    std::vector< PointAndSolution<string> > paretoSet;
+    paretoSet = asfp.computeConvexParetoSet(numObjectives, eps, 
+        [&] (const PointAndSolution<string> &, double errorUpperBound) {
+          callbackBounds.push_back(errorUpperBound);
+          return true;
+        });
+
+    EXPECT_LE(asfp.getApproximationErrorUpperBound(), eps);
+    EXPECT_GE(asfp.getApproximationErrorUpperBound(), delta);
+    for (unsigned int k = 0; k != callbackBounds.size(); ++k)
+      EXPECT_GE(callbackBounds[k], delta);
+    expectApproximateConvexParetoSet(asfp, numObjectives, eps, paretoSet);
+
+    // the same comb(), undeclared: fewer comb() calls (and a bound that 
+    // ignores delta)
+    ApproximateSphereFrontProblem undeclared(numObjectives, delta, false);
+    undeclared.computeConvexParetoSet(numObjectives, eps);
+    EXPECT_LT(undeclared.getNumCombCalls(), asfp.getNumCombCalls());
+
+    // a delta larger than eps: the bound stays above delta
+    ApproximateSphereFrontProblem coarse(numObjectives, 0.1);
+    coarse.setMaxCombCalls(200);
+    coarse.computeConvexParetoSet(numObjectives, eps);
+    EXPECT_GE(coarse.getApproximationErrorUpperBound(), 0.1);
+  }
+}
+
+
+// Test that the hints' upper bounds are never below comb()'s optimal 
+// value and that Chord and PGEN find the same points when comb() answers 
+// "no improvement" instead of returning a point no better than the bound.
+TEST_F(BaseProblemTest, CombCanAnswerNoImprovementOnTheUpperBound)
+{
+  using small_biobjective_sp_problem::SmallBiobjectiveSPProblem;
+  using small_tripleobjective_sp_problem::SmallTripleobjectiveSPProblem;
+  using non_optimal_starting_points_problem::NonOptimalStartingPointsProblem;
+
+  SmallBiobjectiveSPProblem sbspp;
+  PruningProblem<SmallBiobjectiveSPProblem, 
+                 small_biobjective_sp_problem::PredecessorMap> psbspp;
+  expectPruningFindsTheSamePoints(sbspp, psbspp, 2, verySmallEpsilon);
+
+  SmallTripleobjectiveSPProblem stspp;
+  PruningProblem<SmallTripleobjectiveSPProblem, 
+                 small_tripleobjective_sp_problem::PredecessorMap> pstspp;
+  expectPruningFindsTheSamePoints(stspp, pstspp, 3, verySmallEpsilon);
+
+  for (unsigned int numObjectives = 2; numObjectives <= 3; 
+       ++numObjectives) {
+    NonOptimalStartingPointsProblem nospp(numObjectives);
+    PruningProblem<NonOptimalStartingPointsProblem, string> 
+        pnospp(numObjectives);
+    expectPruningFindsTheSamePoints(nospp, pnospp, numObjectives, 
+                                    verySmallEpsilon);
+  }
+}
+
+
+// Test that computeConvexParetoSet() works with move-only solutions, 
+// i.e. it never copies a solution, and that every returned (and 
+// streamed) solution is still the one comb() returned with its point.
+TEST_F(BaseProblemTest, MoveOnlySolutionsWork)
+{
+  using sphere_front_problem::SphereFrontProblem;
+
+  double eps = 0.01;
+  for (unsigned int numObjectives = 2; numObjectives <= 3; ++numObjectives) 
+    for (unsigned int numThreads = 1; numThreads <= 2; ++numThreads) {
+      SphereFrontProblem sfp(numObjectives);
+      MoveOnlySphereFrontProblem mosfp(numObjectives);
+      mosfp.setNumThreads(numThreads);
+      std::vector< PointAndSolution<string> > expectedParetoSet;
+      std::vector< PointAndSolution< std::unique_ptr<Point> > > paretoSet;
+      expectedParetoSet = sfp.computeConvexParetoSet(numObjectives, eps);
+      unsigned int numStreamedPoints = 0;
+      paretoSet = mosfp.computeConvexParetoSet(numObjectives, eps, 
+          [&] (const PointAndSolution< std::unique_ptr<Point> > & newPoint, 
+               double) {
+            ++numStreamedPoints;
+            EXPECT_TRUE(newPoint.solution and 
+                        *newPoint.solution == newPoint.point);
+            return true;
+          });
+
+      EXPECT_LE(paretoSet.size(), numStreamedPoints);
+      if (numThreads == 1) {
+        // (working in rounds PGEN may find a few more points)
+        ASSERT_EQ(expectedParetoSet.size(), paretoSet.size());
+        for (unsigned int j = 0; j != paretoSet.size(); ++j)
+          EXPECT_EQ(expectedParetoSet[j].point, paretoSet[j].point);
+      }
+      for (unsigned int j = 0; j != paretoSet.size(); ++j) {
+        ASSERT_TRUE(paretoSet[j].solution);
+        EXPECT_EQ(paretoSet[j].point, *paretoSet[j].solution);
+        EXPECT_FALSE(paretoSet[j].weightsUsed.empty());
+      }
+    }
+}
+
+
+// Test that a LazyProblem only materializes the solutions of the points 
+// it returns.
+TEST_F(BaseProblemTest, LazySolutionsWork)
+{
+  using sphere_front_problem::SphereFrontProblem;
+
+  double eps = 0.01;
+  for (unsigned int numObjectives = 2; numObjectives <= 3; ++numObjectives) {
+    SphereFrontProblem sfp(numObjectives);
+    LazySphereFrontProblem lsfp(numObjectives);
+    std::vector< PointAndSolution<string> > expectedParetoSet;
+    std::vector< PointAndSolution<string> > paretoSet;
+    expectedParetoSet = sfp.computeConvexParetoSet(numObjectives, eps);
+    paretoSet = lsfp.computeMaterializedConvexParetoSet(numObjectives, eps);
+
+    EXPECT_EQ(paretoSet.size(), lsfp.numMaterializations);
+    EXPECT_LE(lsfp.numMaterializations, lsfp.numCombCalls);
+    ASSERT_EQ(expectedParetoSet.size(), paretoSet.size());
+    for (unsigned int j = 0; j != paretoSet.size(); ++j) {
+      EXPECT_EQ(expectedParetoSet[j].point, paretoSet[j].point);
+      EXPECT_EQ(expectedParetoSet[j].solution, paretoSet[j].solution);
+      EXPECT_EQ(expectedParetoSet[j].weightsUsed, paretoSet[j].weightsUsed);
+    }
+
+    // cancel after the first few points (only those get materialized)
+    LazySphereFrontProblem cancelledLsfp(numObjectives);
+    paretoSet = cancelledLsfp.computeMaterializedConvexParetoSet(
+                    numObjectives, eps, 
+                    [&] (const PointAndSolution<unsigned int> & newPoint, 
+                         double) {
+                      return newPoint.solution + 1 < numObjectives + 2;
+                    });
+    EXPECT_EQ(paretoSet.size(), cancelledLsfp.numMaterializations);
+    EXPECT_LT(cancelledLsfp.numMaterializations, lsfp.numCombCalls);
+  }
+}
+
+
 }  // namespace
 
 
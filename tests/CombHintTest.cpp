@@ -0,0 +1,93 @@
+/*! \file CombHintTest.cpp
+ *  \brief Unit test for the CombHint class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <limits>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../PointAndSolution.h"
+#include "../CombHint.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::CombHint;
+using pareto_approximator::PoolIndex;
+
+
+namespace {
+
+
+// Make a point with a move-only solution, found with the given weights.
+PointAndSolution< std::unique_ptr<std::string> >
+makePoint(double x, double y, const std::string & solution,
+          double wx, double wy)
+{
+  std::vector<double> weights = { wx, wy };
+  return PointAndSolution< std::unique_ptr<std::string> >(Point(x, y),
+                  std::unique_ptr<std::string>(new std::string(solution)),
+                  weights.begin(), weights.end());
+}
+
+
+// Test that a CombHint refers to the points it was given (without
+// copying them) and finds the one with the closest weights.
+TEST(CombHintTest, CombHintWorks)
+{
+  PointAndSolution< std::unique_ptr<std::string> > a, b;
+  a = makePoint(1.0, 4.0, "a", 1.0, 0.0);
+  b = makePoint(3.0, 2.0, "b", 1.0, 1.0);
+
+  CombHint< std::unique_ptr<std::string> > hint;
+  EXPECT_TRUE(hint.empty());
+  hint.addVertex(a);
+  hint.addVertex(b);
+  EXPECT_FALSE(hint.empty());
+  ASSERT_EQ(2, hint.size());
+  EXPECT_EQ(&a, &hint.vertex(0));
+  EXPECT_EQ(&b, &hint.vertex(1));
+  EXPECT_EQ("b", *hint.vertex(1).solution);
+  EXPECT_EQ(Point(1.0, 4.0), hint.vertex(0).point);
+
+  // (the weights are normalized first)
+  std::vector<double> weights = { 10.0, 1.0 };
+  EXPECT_EQ(&a, &hint.closestVertex(weights.begin(), weights.end()));
+  weights = { 2.0, 3.0 };
+  EXPECT_EQ(&b, &hint.closestVertex(weights.begin(), weights.end()));
+  weights = { 3.0, 1.0 };
+  EXPECT_EQ(&a, &hint.closestVertex(weights.begin(), weights.end()));
+
+  // no upper bound until BaseProblem sets one
+  EXPECT_FALSE(hint.hasUpperBound());
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), hint.upperBound());
+  PointAndSolution<PoolIndex> reference(b.point, 7);
+  hint.setUpperBound(5.0, 1, reference);
+  EXPECT_TRUE(hint.hasUpperBound());
+  EXPECT_EQ(5.0, hint.upperBound());
+  EXPECT_EQ(&b, &hint.upperBoundVertex());
+  EXPECT_EQ(7, hint.upperBoundReference().solution);
+
+  // copies refer to the same points
+  CombHint< std::unique_ptr<std::string> > copy(hint);
+  EXPECT_EQ(&b, &copy.vertex(1));
+  EXPECT_EQ(&b, &copy.upperBoundVertex());
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,135 @@
+/*! \file CombResultMemoTest.cpp
+ *  \brief Unit test for the CombResultMemo class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../PointAndSolution.h"
+#include "../CombResultMemo.h"
+
+
+using std::string;
+
+using pareto_approximator::Point;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::CombResultMemo;
+
+
+namespace {
+
+
+// The fixture for testing class CombResultMemo.
+class CombResultMemoTest : public ::testing::Test
+{
+  protected:
+    CombResultMemoTest() { }
+
+    ~CombResultMemoTest() { }
+
+    // Make a weight vector with the given elements.
+    std::vector<double> weights(double x, double y, double z)
+    {
+      std::vector<double> w;
+      w.push_back(x);
+      w.push_back(y);
+      w.push_back(z);
+      return w;
+    }
+};
+
+
+// Test that weight vectors are normalized before they are quantized.
+TEST_F(CombResultMemoTest, MakeKeyNormalizesWeightVectors)
+{
+  CombResultMemo<string> exact;
+  EXPECT_EQ(exact.makeKey(weights(1.0, 2.0, 1.0)),
+            exact.makeKey(weights(0.25, 0.5, 0.25)));
+  EXPECT_NE(exact.makeKey(weights(1.0, 2.0, 1.0)),
+            exact.makeKey(weights(1.0, 2.0, 1.5)));
+
+  CombResultMemo<string> coarse(0.01);
+  EXPECT_EQ(coarse.makeKey(weights(3.0, 6.0, 3.0)),
+            coarse.makeKey(weights(0.25, 0.5, 0.25)));
+}
+
+
+// Test that the tolerance decides which weight vectors share a key.
+TEST_F(CombResultMemoTest, MakeKeyUsesTheTolerance)
+{
+  std::vector<double> w = weights(0.2, 0.3, 0.5);
+  std::vector<double> noisyW = weights(0.2 + 1e-13, 0.3 - 1e-13, 0.5);
+
+  CombResultMemo<string> exact;
+  EXPECT_EQ(0.0, exact.getTolerance());
+  EXPECT_NE(exact.makeKey(w), exact.makeKey(noisyW));
+
+  CombResultMemo<string> tolerant(1e-9);
+  EXPECT_EQ(1e-9, tolerant.getTolerance());
+  EXPECT_EQ(tolerant.makeKey(w), tolerant.makeKey(noisyW));
+  EXPECT_NE(tolerant.makeKey(w),
+            tolerant.makeKey(weights(0.2, 0.3, 0.5 + 1e-6)));
+}
+
+
+// Test find(), insert(), size() and clear().
+TEST_F(CombResultMemoTest, FindReturnsStoredResults)
+{
+  CombResultMemo<string> memo(1e-9);
+  CombResultMemo<string>::Key key = memo.makeKey(weights(1.0, 1.0, 2.0));
+  CombResultMemo<string>::Key otherKey = memo.makeKey(weights(1.0, 2.0, 1.0));
+  EXPECT_EQ(0, memo.size());
+  EXPECT_TRUE(memo.find(key) == NULL);
+
+  memo.insert(key, PointAndSolution<string>(Point(1.0, 2.0, 3.0), "first"));
+  ASSERT_TRUE(memo.find(key) != NULL);
+  EXPECT_EQ(Point(1.0, 2.0, 3.0), memo.find(key)->point);
+  EXPECT_EQ("first", memo.find(key)->solution);
+  EXPECT_TRUE(memo.find(otherKey) == NULL);
+  EXPECT_EQ(1, memo.size());
+
+  // the first result stored under a key is kept
+  memo.insert(key, PointAndSolution<string>(Point(3.0, 2.0, 1.0), "second"));
+  EXPECT_EQ("first", memo.find(key)->solution);
+  EXPECT_EQ(1, memo.size());
+
+  memo.insert(otherKey, PointAndSolution<string>(Point(3.0, 2.0, 1.0),
+                                                 "second"));
+  EXPECT_EQ(2, memo.size());
+
+  memo.clear();
+  EXPECT_EQ(0, memo.size());
+  EXPECT_TRUE(memo.find(key) == NULL);
+}
+
+
+// Test that setTolerance() changes the tolerance and clears the memo.
+TEST_F(CombResultMemoTest, SetToleranceClearsTheMemo)
+{
+  CombResultMemo<string> memo;
+  CombResultMemo<string>::Key key = memo.makeKey(weights(1.0, 1.0, 2.0));
+  memo.insert(key, PointAndSolution<string>(Point(1.0, 2.0, 3.0), "first"));
+  EXPECT_EQ(1, memo.size());
+
+  memo.setTolerance(0.1);
+  EXPECT_EQ(0.1, memo.getTolerance());
+  EXPECT_EQ(0, memo.size());
+  EXPECT_TRUE(memo.find(key) == NULL);
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int 
+main(int argc, char** argv) 
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
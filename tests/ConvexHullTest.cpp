@@ -0,0 +1,228 @@
+/*! \file ConvexHullTest.cpp
+ *  \brief Unit test for the ConvexHull class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../ConvexHull.h"
+#include "../NullObjectException.h"
+#include "../DifferentDimensionsException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::ConvexHull;
+using pareto_approximator::exception_classes::NullObjectException;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+
+
+namespace {
+
+
+// The fixture for testing class ConvexHull.
+class ConvexHullTest : public ::testing::Test
+{
+  protected:
+    ConvexHullTest() { }
+
+    ~ConvexHullTest() { }
+
+    // Check that every point added to the hull is on or behind every
+    // facet, that every facet's vertices are on it and that every facet's
+    // normal has unit length.
+    void expectValidHull(const ConvexHull & hull,
+                         const std::vector<Point> & points)
+    {
+      const std::vector<ConvexHull::HullFacet> & facets = hull.getFacets();
+      for (unsigned int f = 0; f != facets.size(); ++f) {
+        EXPECT_EQ(hull.spaceDimension(), facets[f].vertices.size());
+
+        double length = 0.0;
+        for (unsigned int j = 0; j != facets[f].normal.size(); ++j)
+          length += facets[f].normal[j] * facets[f].normal[j];
+        EXPECT_NEAR(1.0, std::sqrt(length), 1e-9);
+
+        for (unsigned int i = 0; i != points.size(); ++i)
+          EXPECT_LE(distance(facets[f], points[i]), 1e-9);
+        for (unsigned int k = 0; k != facets[f].vertices.size(); ++k)
+          EXPECT_NEAR(0.0, distance(facets[f],
+                                    points[facets[f].vertices[k]]), 1e-9);
+      }
+    }
+
+    // The signed distance of a point from a facet's hyperplane.
+    double distance(const ConvexHull::HullFacet & facet, const Point & p)
+    {
+      double result = -facet.offset;
+      for (unsigned int j = 0; j != facet.normal.size(); ++j)
+        result += facet.normal[j] * p[j];
+      return result;
+    }
+};
+
+
+// Test that the hull is empty until it has d + 1 affinely independent
+// points.
+TEST_F(ConvexHullTest, HullNeedsAffinelyIndependentPoints)
+{
+  ConvexHull hull(3);
+  EXPECT_EQ(3, hull.spaceDimension());
+  EXPECT_EQ(0, hull.numPoints());
+  EXPECT_FALSE(hull.isFullDimensional());
+
+  // four points on the same plane
+  EXPECT_EQ(0, hull.addPoint(Point(0.0, 0.0, 0.0)));
+  EXPECT_EQ(1, hull.addPoint(Point(1.0, 0.0, 0.0)));
+  EXPECT_EQ(2, hull.addPoint(Point(0.0, 1.0, 0.0)));
+  EXPECT_EQ(3, hull.addPoint(Point(1.0, 1.0, 0.0)));
+  EXPECT_EQ(4, hull.numPoints());
+  EXPECT_FALSE(hull.isFullDimensional());
+  EXPECT_TRUE(hull.getFacets().empty());
+  EXPECT_TRUE(hull.getExtremePointIndices().empty());
+
+  // the first point off the plane makes it a pyramid
+  hull.addPoint(Point(0.5, 0.5, 1.0));
+  EXPECT_TRUE(hull.isFullDimensional());
+  // (four triangles on the sides and two on the bottom)
+  EXPECT_EQ(6, hull.getFacets().size());
+  EXPECT_EQ(5, hull.getExtremePointIndices().size());
+}
+
+
+// Test the hull of a square and a point inside it.
+TEST_F(ConvexHullTest, SquareHullWorks)
+{
+  std::vector<Point> points;
+  points.push_back(Point(0.0, 0.0));
+  points.push_back(Point(0.5, 0.5));
+  points.push_back(Point(2.0, 0.0));
+  points.push_back(Point(0.0, 2.0));
+  points.push_back(Point(2.0, 2.0));
+  points.push_back(Point(1.0, 0.0));
+
+  ConvexHull hull(2);
+  for (unsigned int i = 0; i != points.size(); ++i)
+    hull.addPoint(points[i]);
+
+  EXPECT_EQ(4, hull.getFacets().size());
+  std::vector<unsigned int> extremePoints = hull.getExtremePointIndices();
+  ASSERT_EQ(4, extremePoints.size());
+  EXPECT_EQ(0, extremePoints[0]);
+  EXPECT_EQ(2, extremePoints[1]);
+  EXPECT_EQ(3, extremePoints[2]);
+  EXPECT_EQ(4, extremePoints[3]);
+  expectValidHull(hull, points);
+}
+
+
+// Test the hull of a cube (with its center and the center of a face).
+TEST_F(ConvexHullTest, CubeHullWorks)
+{
+  std::vector<Point> points;
+  points.push_back(Point(1.0, 1.0, 1.0));
+  points.push_back(Point(1.0, 1.0, 0.5));
+  for (unsigned int i = 0; i != 8; ++i)
+    points.push_back(Point(2.0 * (i & 1), 2.0 * ((i >> 1) & 1),
+                           2.0 * ((i >> 2) & 1)));
+
+  ConvexHull hull(3);
+  for (unsigned int i = 0; i != points.size(); ++i)
+    hull.addPoint(points[i]);
+
+  // each of the six faces is split into two triangles
+  EXPECT_EQ(12, hull.getFacets().size());
+  std::vector<unsigned int> extremePoints = hull.getExtremePointIndices();
+  ASSERT_EQ(8, extremePoints.size());
+  for (unsigned int i = 0; i != extremePoints.size(); ++i)
+    EXPECT_EQ(i + 2, extremePoints[i]);
+  expectValidHull(hull, points);
+}
+
+
+// Test the hull of a 4-dimensional simplex (and a point inside it).
+TEST_F(ConvexHullTest, FourDimensionalHullWorks)
+{
+  std::vector<double> origin(4, 0.0);
+  std::vector<Point> points;
+  points.push_back(Point(origin.begin(), origin.end()));
+  for (unsigned int i = 0; i != 4; ++i) {
+    std::vector<double> coordinates(origin);
+    coordinates[i] = 1.0;
+    points.push_back(Point(coordinates.begin(), coordinates.end()));
+  }
+  std::vector<double> inside(4, 0.1);
+  points.push_back(Point(inside.begin(), inside.end()));
+
+  ConvexHull hull(4);
+  for (unsigned int i = 0; i != points.size(); ++i)
+    hull.addPoint(points[i]);
+
+  EXPECT_EQ(5, hull.getFacets().size());
+  EXPECT_EQ(5, hull.getExtremePointIndices().size());
+  expectValidHull(hull, points);
+}
+
+
+// Test that facet ids tell which facets changed.
+TEST_F(ConvexHullTest, FacetIdsTrackChanges)
+{
+  ConvexHull hull(2);
+  EXPECT_EQ(0, hull.nextFacetId());
+  hull.addPoint(Point(0.0, 0.0));
+  hull.addPoint(Point(2.0, 0.0));
+  hull.addPoint(Point(0.0, 2.0));
+  EXPECT_EQ(3, hull.nextFacetId());
+  EXPECT_TRUE(hull.takeRemovedFacetIds().empty());
+
+  // a point that can only see the hypotenuse
+  hull.addPoint(Point(2.0, 2.0));
+  std::vector<unsigned int> removedIds = hull.takeRemovedFacetIds();
+  ASSERT_EQ(1, removedIds.size());
+  EXPECT_TRUE(hull.takeRemovedFacetIds().empty());
+  EXPECT_EQ(5, hull.nextFacetId());
+
+  // the two legs are still there (with the same ids), the hypotenuse was 
+  // replaced by two new facets
+  const std::vector<ConvexHull::HullFacet> & facets = hull.getFacets();
+  ASSERT_EQ(4, facets.size());
+  unsigned int numOldFacets = 0;
+  for (unsigned int f = 0; f != facets.size(); ++f) {
+    EXPECT_NE(removedIds[0], facets[f].id);
+    if (facets[f].id < 3)
+      ++numOldFacets;
+  }
+  EXPECT_EQ(2, numOldFacets);
+
+  // an interior point changes nothing
+  hull.addPoint(Point(1.0, 1.0));
+  EXPECT_TRUE(hull.takeRemovedFacetIds().empty());
+  EXPECT_EQ(5, hull.nextFacetId());
+}
+
+
+// Test that addPoint() rejects null points and points of the wrong
+// dimension.
+TEST_F(ConvexHullTest, AddPointThrowsOnBadPoints)
+{
+  ConvexHull hull(3);
+  EXPECT_THROW(hull.addPoint(Point()), NullObjectException);
+  EXPECT_THROW(hull.addPoint(Point(1.0, 2.0)), DifferentDimensionsException);
+  EXPECT_EQ(0, hull.numPoints());
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,183 @@
+/*! \file EpsilonBoxArchiveTest.cpp
+ *  \brief Unit test for the EpsilonBoxArchive class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../FixedPoint.h"
+#include "../PointAndSolution.h"
+#include "../NonDominatedSet.h"
+#include "../EpsilonBoxArchive.h"
+#include "../DifferentDimensionsException.h"
+#include "../NegativeApproximationRatioException.h"
+#include "../NotPositivePointException.h"
+#include "../NotStrictlyPositivePointException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::FixedPoint;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::NonDominatedSet;
+using pareto_approximator::EpsilonBoxArchive;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+using pareto_approximator::exception_classes::NegativeApproximationRatioException;
+using pareto_approximator::exception_classes::NotPositivePointException;
+using pareto_approximator::exception_classes::NotStrictlyPositivePointException;
+
+
+namespace {
+
+
+// Make a random point close to the plane sum(p) = 3. (coordinates in
+// [0.01, 3))
+Point
+randomFrontPoint(unsigned int dimension)
+{
+  std::vector<double> coordinates(dimension);
+  double sum = 0.0;
+  for (unsigned int i = 0; i != dimension; ++i) {
+    coordinates[i] = 0.01 + (std::rand() % 1000) / 1000.0;
+    sum += coordinates[i];
+  }
+  double noise = (std::rand() % 100) / 1000.0;
+  for (unsigned int i = 0; i != dimension; ++i)
+    coordinates[i] = coordinates[i] * 3.0 / sum + noise;
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+// Test EpsilonBoxArchive's basic methods. (additive boxes of side 1)
+TEST(EpsilonBoxArchiveTest, EpsilonBoxArchiveBasicsWork)
+{
+  EpsilonBoxArchive<Point> archive(1.0);
+  EXPECT_TRUE(archive.empty());
+  EXPECT_EQ(1.0, archive.eps());
+  EXPECT_EQ(EpsilonBoxArchive<Point>::AdditiveBoxes, archive.boxType());
+
+  EXPECT_TRUE(archive.insert(Point(0.5, 3.5)));
+  // same box, neither dominates, farther from the corner (0, 3)
+  EXPECT_TRUE(archive.dominates(Point(0.2, 3.9)));
+  EXPECT_FALSE(archive.insert(Point(0.2, 3.9)));
+  // same box, dominates the element
+  EXPECT_FALSE(archive.dominates(Point(0.4, 3.2)));
+  EXPECT_TRUE(archive.insert(Point(0.4, 3.2)));
+  ASSERT_EQ(1, archive.size());
+  EXPECT_EQ(Point(0.4, 3.2), *archive.begin());
+  // same box, neither dominates, closer to the corner
+  EXPECT_TRUE(archive.insert(Point(0.1, 3.3)));
+  EXPECT_EQ(Point(0.1, 3.3), *archive.begin());
+  // a box no box dominates
+  EXPECT_TRUE(archive.insert(Point(1.5, 2.5)));
+  EXPECT_EQ(2, archive.size());
+  // box (1, 4) is dominated by box (0, 3) (though the point is not)
+  EXPECT_FALSE(archive.insert(Point(1.05, 4.0)));
+  EXPECT_EQ(2, archive.size());
+  // box (0, 0) dominates both boxes
+  EXPECT_TRUE(archive.insert(Point(0.9, 0.9)));
+  ASSERT_EQ(1, archive.size());
+  EXPECT_EQ(Point(0.9, 0.9), *archive.begin());
+
+  EXPECT_THROW(archive.insert(Point(1, 2, 3)), DifferentDimensionsException);
+  EXPECT_THROW(archive.insert(Point(-1.0, 2.0)), NotPositivePointException);
+  archive.clear();
+  EXPECT_TRUE(archive.empty());
+  EXPECT_TRUE(archive.insert(Point(1, 2, 3)));
+
+  EXPECT_THROW(EpsilonBoxArchive<Point>(0.0),
+               NegativeApproximationRatioException);
+  EXPECT_THROW(EpsilonBoxArchive<Point>(-0.5),
+               NegativeApproximationRatioException);
+
+  EpsilonBoxArchive<Point> multiplicative(
+        0.1, EpsilonBoxArchive<Point>::MultiplicativeBoxes);
+  EXPECT_THROW(multiplicative.insert(Point(0.0, 2.0)),
+               NotStrictlyPositivePointException);
+  EXPECT_TRUE(multiplicative.insert(Point(1.0, 2.0)));
+  EXPECT_TRUE(multiplicative.insert(Point(2.0, 1.0)));
+  EXPECT_FALSE(multiplicative.insert(Point(1.05, 2.05)));
+  EXPECT_EQ(2, multiplicative.size());
+}
+
+
+// Test that every point that went through an archive is eps-dominated by
+// some element, that the elements' boxes are few and that the archive
+// keeps at most one element per box.
+TEST(EpsilonBoxArchiveTest, EpsilonBoxArchiveCoversItsInput)
+{
+  std::srand(29);
+  for (unsigned int dimension = 2; dimension <= 4; ++dimension) {
+    const double eps = 0.1;
+    EpsilonBoxArchive<Point> additive(eps);
+    typedef EpsilonBoxArchive< PointAndSolution<int> > PasArchive;
+    PasArchive multiplicative(eps, PasArchive::MultiplicativeBoxes);
+    NonDominatedSet<Point> exact;
+    std::vector<Point> points;
+    for (unsigned int k = 0; k != 5000; ++k) {
+      points.push_back(randomFrontPoint(dimension));
+      additive.insert(points.back());
+      multiplicative.insert(PointAndSolution<int>(points.back(), k));
+      exact.insert(points.back());
+    }
+
+    EXPECT_LT(additive.size(), exact.size());
+    EXPECT_LT(multiplicative.size(), exact.size());
+    for (unsigned int k = 0; k != points.size(); ++k) {
+      bool isCovered = false;
+      EpsilonBoxArchive<Point>::iterator ai;
+      for (ai = additive.begin(); ai != additive.end(); ++ai)
+        isCovered = isCovered or ai->dominatesAdditive(points[k], eps);
+      EXPECT_TRUE(isCovered);
+      isCovered = false;
+      PasArchive::iterator mi;
+      for (mi = multiplicative.begin(); mi != multiplicative.end(); ++mi)
+        isCovered = isCovered or
+                    mi->point.dominatesMultiplicative(points[k], eps);
+      EXPECT_TRUE(isCovered);
+    }
+
+    // the elements' boxes are different and mutually non-dominated
+    EpsilonBoxArchive<Point>::iterator ai, aj;
+    for (ai = additive.begin(); ai != additive.end(); ++ai)
+      for (aj = additive.begin(); aj != additive.end(); ++aj) {
+        if (ai == aj)
+          continue;
+        bool isBoxLessOrEqual = true;
+        for (unsigned int i = 0; i != dimension; ++i)
+          isBoxLessOrEqual = isBoxLessOrEqual and
+              std::floor((*ai)[i] / eps) <= std::floor((*aj)[i] / eps);
+        EXPECT_FALSE(isBoxLessOrEqual);
+      }
+
+    // inserting the same points again changes nothing
+    std::vector<Point> before(additive.begin(), additive.end());
+    EXPECT_FALSE(additive.insert(points.begin(), points.end()));
+    EXPECT_TRUE(std::equal(before.begin(), before.end(), additive.begin()));
+  }
+
+  // FixedPoint elements
+  EpsilonBoxArchive< FixedPoint<3> > fixedPoints(0.2);
+  for (unsigned int k = 0; k != 1000; ++k)
+    fixedPoints.insert(FixedPoint<3>(randomFrontPoint(3)));
+  EXPECT_FALSE(fixedPoints.empty());
+  EXPECT_TRUE(fixedPoints.dominates(*fixedPoints.begin()));
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
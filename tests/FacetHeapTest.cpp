@@ -0,0 +1,180 @@
+/*! \file FacetHeapTest.cpp
+ *  \brief Unit test for the FacetHeap class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../PointAndSolution.h"
+#include "../Facet.h"
+#include "../FacetHeap.h"
+
+
+using std::string;
+
+using pareto_approximator::Point;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::Facet;
+using pareto_approximator::FacetHeap;
+
+
+namespace {
+
+
+// The fixture for testing class FacetHeap.
+class FacetHeapTest : public ::testing::Test
+{
+  protected:
+    FacetHeapTest() { }
+
+    ~FacetHeapTest() { }
+
+    // Make a (2D) non-boundary facet with vertices (1, k) and (k, 1).
+    // - Its Lower Distal Point is (1, 1) so the larger k is, the larger 
+    //   its local approximation error upper bound.
+    Facet<string> makeInteriorFacet(double k)
+    {
+      PointAndSolution<string> a(Point(1.0, k), "a");
+      a.weightsUsed.push_back(1.0);
+      a.weightsUsed.push_back(0.0);
+      PointAndSolution<string> b(Point(k, 1.0), "b");
+      b.weightsUsed.push_back(0.0);
+      b.weightsUsed.push_back(1.0);
+
+      std::vector< PointAndSolution<string> > vertices;
+      vertices.push_back(a);
+      vertices.push_back(b);
+      std::vector<double> normal(2, 1.0);
+
+      return Facet<string>(vertices.begin(), vertices.end(), 
+                           normal.begin(), normal.end());
+    }
+
+    // Make a (2D) boundary facet. (no unique Lower Distal Point)
+    Facet<string> makeBoundaryFacet()
+    {
+      PointAndSolution<string> a(Point(1.0, 2.0), "a");
+      a.weightsUsed.push_back(1.0);
+      a.weightsUsed.push_back(0.0);
+      PointAndSolution<string> b(Point(1.0, 1.0), "b");
+      b.weightsUsed.push_back(1.0);
+      b.weightsUsed.push_back(0.0);
+
+      std::vector< PointAndSolution<string> > vertices;
+      vertices.push_back(a);
+      vertices.push_back(b);
+
+      return Facet<string>(vertices.begin(), vertices.end());
+    }
+};
+
+
+// Test that the interior facet with the largest bound is on top, also 
+// after erasing facets.
+TEST_F(FacetHeapTest, TopIsTheFacetWithTheLargestBound)
+{
+  FacetHeap<string> heap;
+  EXPECT_TRUE(heap.empty());
+  EXPECT_FALSE(heap.hasInteriorFacets());
+  EXPECT_EQ(0.0, heap.largestLocalApproximationErrorUpperBound());
+
+  // ids 0, 1, ..., 9 with bounds in a mixed-up order
+  double ks[] = { 3.0, 7.0, 2.0, 9.0, 5.0, 4.0, 8.0, 6.0, 1.5, 10.0 };
+  for (unsigned int i = 0; i != 10; ++i)
+    heap.insert(i, makeInteriorFacet(ks[i]));
+  EXPECT_EQ(10, heap.size());
+  EXPECT_FALSE(heap.hasBoundaryFacets());
+
+  EXPECT_EQ(9, heap.topInteriorFacet());
+  EXPECT_EQ(heap.get(9).getLocalApproximationErrorUpperBound(), 
+            heap.largestLocalApproximationErrorUpperBound());
+
+  EXPECT_TRUE(heap.erase(9));
+  EXPECT_FALSE(heap.erase(9));
+  EXPECT_FALSE(heap.contains(9));
+  EXPECT_EQ(3, heap.topInteriorFacet());
+
+  // erase from the middle of the heap
+  EXPECT_TRUE(heap.erase(6));
+  EXPECT_TRUE(heap.erase(4));
+  EXPECT_EQ(3, heap.topInteriorFacet());
+  EXPECT_TRUE(heap.erase(3));
+  EXPECT_EQ(1, heap.topInteriorFacet());
+  EXPECT_TRUE(heap.erase(1));
+  EXPECT_EQ(7, heap.topInteriorFacet());
+  EXPECT_EQ(5, heap.size());
+
+  // pop the rest in order
+  unsigned int expectedOrder[] = { 7, 5, 0, 2, 8 };
+  for (unsigned int i = 0; i != 5; ++i) {
+    EXPECT_EQ(expectedOrder[i], heap.topInteriorFacet());
+    heap.erase(heap.topInteriorFacet());
+  }
+  EXPECT_TRUE(heap.empty());
+}
+
+
+// Test interiorFacetsAbove().
+TEST_F(FacetHeapTest, InteriorFacetsAboveWorks)
+{
+  FacetHeap<string> heap;
+  double ks[] = { 3.0, 7.0, 2.0, 9.0, 5.0 };
+  for (unsigned int i = 0; i != 5; ++i)
+    heap.insert(i, makeInteriorFacet(ks[i]));
+  heap.insert(5, makeBoundaryFacet());
+
+  double bound = heap.get(0).getLocalApproximationErrorUpperBound();
+  std::vector<unsigned int> ids = heap.interiorFacetsAbove(bound);
+  ASSERT_EQ(3, ids.size());
+  EXPECT_EQ(3, ids[0]);
+  EXPECT_EQ(1, ids[1]);
+  EXPECT_EQ(4, ids[2]);
+
+  EXPECT_EQ(5, heap.interiorFacetsAbove(0.0).size());
+  EXPECT_TRUE(heap.interiorFacetsAbove(
+                heap.largestLocalApproximationErrorUpperBound()).empty());
+}
+
+
+// Test that boundary facets are kept apart from the interior facets.
+TEST_F(FacetHeapTest, BoundaryFacetsAreKeptApart)
+{
+  FacetHeap<string> heap;
+  heap.insert(4, makeBoundaryFacet());
+  heap.insert(2, makeBoundaryFacet());
+  heap.insert(3, makeInteriorFacet(2.0));
+  EXPECT_EQ(3, heap.size());
+
+  EXPECT_TRUE(heap.hasInteriorFacets());
+  EXPECT_EQ(3, heap.topInteriorFacet());
+  ASSERT_TRUE(heap.hasBoundaryFacets());
+  EXPECT_EQ(2, heap.firstBoundaryFacet());
+  std::vector<unsigned int> boundaryFacets = heap.boundaryFacets();
+  ASSERT_EQ(2, boundaryFacets.size());
+  EXPECT_EQ(2, boundaryFacets[0]);
+  EXPECT_EQ(4, boundaryFacets[1]);
+
+  EXPECT_TRUE(heap.erase(2));
+  EXPECT_EQ(4, heap.firstBoundaryFacet());
+  EXPECT_TRUE(heap.erase(3));
+  EXPECT_FALSE(heap.hasInteriorFacets());
+  EXPECT_EQ(0.0, heap.largestLocalApproximationErrorUpperBound());
+  EXPECT_FALSE(heap.empty());
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int 
+main(int argc, char** argv) 
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
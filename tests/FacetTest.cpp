@@ -6,6 +6,7 @@
 
 
 #include <vector>
+#include <cmath>
 #include <algorithm>
 #include <string>
 #include <armadillo>
@@ -208,6 +209,88 @@ class FacetTest : public ::testing::Test
 };
 
 
+// Make a facet vertex with the given coordinates and weights.
+PointAndSolution<std::string> 
+makeVertex(const std::vector<double> & coordinates, 
+           const std::vector<double> & weights)
+{
+  PointAndSolution<std::string> vertex(Point(coordinates.begin(), 
+                                             coordinates.end()), "");
+  vertex.weightsUsed = weights;
+  return vertex;
+}
+
+
+// The normal vector Facet computes with Armadillo for 4 or more 
+// dimensions: element i is the determinant of the vertices' matrix with 
+// column i replaced by ones.
+std::vector<double> 
+armadilloNormal(const std::vector< PointAndSolution<std::string> > & vertices)
+{
+  arma::mat M;
+  for (unsigned int k = 0; k != vertices.size(); ++k)
+    M.insert_rows(M.n_rows, vertices[k].point.toRowVec());
+  M.insert_cols(M.n_cols, arma::ones<arma::vec>(vertices.size()));
+
+  std::vector<double> normal;
+  for (unsigned int i = 0; i != vertices.size(); ++i) {
+    M.swap_cols(i, M.n_cols - 1);
+    normal.push_back(arma::det(M.cols(0, M.n_cols - 2)));
+    M.swap_cols(i, M.n_cols - 1);
+  }
+  return normal;
+}
+
+
+// The Lower Distal Point Facet computes with Armadillo for 4 or more 
+// dimensions. (a null Point if there is no unique one)
+Point 
+armadilloLowerDistalPoint(
+          const std::vector< PointAndSolution<std::string> > & vertices)
+{
+  arma::mat W;
+  arma::vec b;
+  for (unsigned int k = 0; k != vertices.size(); ++k) {
+    arma::rowvec wk(vertices[k].weightsUsed);
+    W.insert_rows(W.n_rows, wk);
+    b.insert_rows(b.n_rows, wk * vertices[k].point.toVec());
+  }
+
+  arma::vec x;
+  if (not arma::solve(x, W, b))
+    return Point();
+  // else
+
+  return Point(x.begin(), x.end());
+}
+
+
+// Check that two vectors are equal up to a tolerance relative to the 
+// largest (absolute) element of the expected one.
+void 
+expectNearlyEqual(const std::vector<double> & expected, 
+                  const std::vector<double> & actual, double tolerance)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  double scale = 1.0;
+  for (unsigned int i = 0; i != expected.size(); ++i)
+    scale = std::max(scale, std::abs(expected[i]));
+  for (unsigned int i = 0; i != expected.size(); ++i)
+    EXPECT_NEAR(expected[i], actual[i], tolerance * scale);
+}
+
+
+// The coordinates of a Point as a std::vector<double>.
+std::vector<double> 
+coordinatesOf(const Point & p)
+{
+  std::vector<double> coordinates;
+  for (unsigned int i = 0; i != p.dimension(); ++i)
+    coordinates.push_back(p[i]);
+  return coordinates;
+}
+
+
 // Test that Facet's constructor and accessors work as expected.
 TEST_F(FacetTest, FacetConstructorsAndAccessorsWork) 
 {
@@ -490,6 +573,47 @@ TEST_F(FacetTest, DominatesMultiplicativeWorks)
 }
 
 
+// Test that the unchecked Facet methods agree with the checked ones.
+TEST_F(FacetTest, UncheckedMethodsWork)
+{
+  Point points[3] = { Point(1, 1, 1), Point(2, 1, 1), Point(8, 8, 8) };
+  for (unsigned int k = 0; k != 3; ++k) {
+    const Point & p = points[k];
+    EXPECT_EQ(regularFacet->ratioDistance(p), 
+              regularFacet->ratioDistanceUnchecked(p));
+    EXPECT_EQ(boundaryFacet->ratioDistance(p), 
+              boundaryFacet->ratioDistanceUnchecked(p));
+    EXPECT_EQ(regularFacet->additiveDistance(p), 
+              regularFacet->additiveDistanceUnchecked(p));
+    EXPECT_EQ(boundaryFacet->distance(p), 
+              boundaryFacet->distanceUnchecked(p));
+    EXPECT_EQ(regularFacet->dominates(p, 0.5), 
+              regularFacet->dominatesUnchecked(p, 0.5));
+    EXPECT_EQ(boundaryFacet->dominatesAdditive(p, 0.7), 
+              boundaryFacet->dominatesAdditiveUnchecked(p, 0.7));
+    EXPECT_EQ(boundaryFacet->dominatesMultiplicative(p, 0.7), 
+              boundaryFacet->dominatesMultiplicativeUnchecked(p, 0.7));
+  }
+
+  // (see RatioDistanceWorks) the unchecked ratio distance is infinite 
+  // where the checked one throws an InfiniteRatioDistanceException
+  std::vector< PointAndSolution<std::string> > infiniteVertices;
+  PointAndSolution<std::string> pas1(Point(1.0, 0.0), "p01");
+  PointAndSolution<std::string> pas2(Point(2.0, 1.0), "p12");
+  pas1.weightsUsed.push_back(1.0);
+  pas1.weightsUsed.push_back(-1.0);
+  pas2.weightsUsed.push_back(1.0);
+  pas2.weightsUsed.push_back(-1.0);
+  infiniteVertices.push_back(pas1);
+  infiniteVertices.push_back(pas2);
+  Facet<std::string> infiniteFacet(infiniteVertices.begin(), 
+                                   infiniteVertices.end());
+  Point parallelPoint(1.0, 1.0);
+  EXPECT_TRUE(std::isinf(infiniteFacet.ratioDistanceUnchecked(parallelPoint)));
+  EXPECT_FALSE(infiniteFacet.dominatesMultiplicativeUnchecked(parallelPoint));
+}
+
+
 // Test that Facet::hasAllNormalVectorElementsNonPositive() works.
 TEST_F(FacetTest, HasAllNormalVectorElementsNonPositiveWorks)
 {
@@ -528,6 +652,126 @@ TEST_F(FacetTest, HasAllNormalVectorElementsNonNegativeWorks)
 }
 
 
+// Test that the closed form 2D and 3D normal vectors match the ones 
+// Armadillo computes for more dimensions, for random facets and for 
+// (almost) collinear vertices.
+TEST_F(FacetTest, ClosedFormNormalVectorMatchesArmadillo)
+{
+  // deterministic pseudo-random coordinates in [1, 100]
+  unsigned int seed = 12345;
+  for (unsigned int dimension = 2; dimension <= 3; ++dimension)
+    for (unsigned int k = 0; k != 100; ++k) {
+      std::vector< PointAndSolution<std::string> > vertices;
+      for (unsigned int v = 0; v != dimension; ++v) {
+        std::vector<double> coordinates;
+        for (unsigned int i = 0; i != dimension; ++i) {
+          seed = seed * 1103515245 + 12345;
+          coordinates.push_back(1.0 + (seed >> 16) % 9901 / 100.0);
+        }
+        vertices.push_back(makeVertex(coordinates, 
+                                      std::vector<double>(dimension, 1.0)));
+      }
+      Facet<std::string> facet(vertices.begin(), vertices.end(), false);
+      expectNearlyEqual(armadilloNormal(vertices), facet.getNormalVector(), 
+                        1e-12);
+    }
+
+  // a 3D facet whose vertices are almost collinear and one whose vertices 
+  // are collinear (zero normal vector)
+  for (unsigned int collinear = 0; collinear <= 1; ++collinear) {
+    double offset = collinear ? 0.0 : std::ldexp(1.0, -30);
+    std::vector< PointAndSolution<std::string> > vertices;
+    std::vector<double> weights(3, 1.0);
+    vertices.push_back(makeVertex({ 1.0, 2.0, 3.0 }, weights));
+    vertices.push_back(makeVertex({ 2.0, 4.0, 5.0 }, weights));
+    vertices.push_back(makeVertex({ 3.0, 6.0 + offset, 7.0 }, weights));
+    Facet<std::string> facet(vertices.begin(), vertices.end(), false);
+    expectNearlyEqual(armadilloNormal(vertices), facet.getNormalVector(), 
+                      1e-12);
+  }
+}
+
+
+// Test that the closed form 2D and 3D Lower Distal Points match the ones 
+// Armadillo computes for more dimensions, for random facets and for 
+// almost singular systems on either side of the closed form's threshold. 
+// (a determinant of DBL_EPSILON times the product of the rows' lengths)
+TEST_F(FacetTest, ClosedFormLowerDistalPointMatchesArmadillo)
+{
+  // deterministic pseudo-random coordinates in [1, 100] and weights in 
+  // (0, 1]
+  unsigned int seed = 54321;
+  for (unsigned int dimension = 2; dimension <= 3; ++dimension)
+    for (unsigned int k = 0; k != 100; ++k) {
+      std::vector< PointAndSolution<std::string> > vertices;
+      for (unsigned int v = 0; v != dimension; ++v) {
+        std::vector<double> coordinates, weights;
+        for (unsigned int i = 0; i != dimension; ++i) {
+          seed = seed * 1103515245 + 12345;
+          coordinates.push_back(1.0 + (seed >> 16) % 9901 / 100.0);
+          seed = seed * 1103515245 + 12345;
+          weights.push_back((1 + (seed >> 16) % 1000) / 1000.0);
+        }
+        vertices.push_back(makeVertex(coordinates, weights));
+      }
+      Facet<std::string> facet(vertices.begin(), vertices.end());
+      Point expected = armadilloLowerDistalPoint(vertices);
+      Point actual = facet.computeLowerDistalPoint();
+      ASSERT_FALSE(expected.isNull());
+      ASSERT_FALSE(actual.isNull());
+      expectNearlyEqual(coordinatesOf(expected), coordinatesOf(actual), 
+                        1e-9);
+    }
+
+  // weights (1, 0) and (1, delta) in 2D, (1, 0, 0), (0, 1, 0) and 
+  // (1, 1, delta) in 3D, i.e. determinant delta and rows of length 
+  // about 1 and sqrt(2): 
+  // - delta = 2^-40 is far above the threshold (about 2^-52) but still 
+  //   tiny: both must find the same point
+  // - delta = 2^-60 is below it: the closed form gives up (a boundary 
+  //   facet) whatever Armadillo does
+  // - delta = 0: neither has a unique solution
+  double deltas[] = { std::ldexp(1.0, -40), std::ldexp(1.0, -60), 0.0 };
+  for (unsigned int d = 0; d != 3; ++d) {
+    double delta = deltas[d];
+
+    std::vector< PointAndSolution<std::string> > vertices2d;
+    vertices2d.push_back(makeVertex({ 3.0, 5.0 }, { 1.0, 0.0 }));
+    vertices2d.push_back(makeVertex({ 2.0, 7.0 }, { 1.0, delta }));
+    Facet<std::string> facet2d(vertices2d.begin(), vertices2d.end());
+
+    std::vector< PointAndSolution<std::string> > vertices3d;
+    vertices3d.push_back(makeVertex({ 3.0, 5.0, 4.0 }, { 1.0, 0.0, 0.0 }));
+    vertices3d.push_back(makeVertex({ 6.0, 2.0, 4.0 }, { 0.0, 1.0, 0.0 }));
+    vertices3d.push_back(makeVertex({ 2.0, 7.0, 1.0 }, { 1.0, 1.0, delta }));
+    Facet<std::string> facet3d(vertices3d.begin(), vertices3d.end());
+
+    if (d == 0) {
+      Point expected2d = armadilloLowerDistalPoint(vertices2d);
+      Point expected3d = armadilloLowerDistalPoint(vertices3d);
+      ASSERT_FALSE(expected2d.isNull());
+      ASSERT_FALSE(expected3d.isNull());
+      ASSERT_FALSE(facet2d.computeLowerDistalPoint().isNull());
+      ASSERT_FALSE(facet3d.computeLowerDistalPoint().isNull());
+      expectNearlyEqual(coordinatesOf(expected2d), 
+                        coordinatesOf(facet2d.computeLowerDistalPoint()), 
+                        1e-9);
+      expectNearlyEqual(coordinatesOf(expected3d), 
+                        coordinatesOf(facet3d.computeLowerDistalPoint()), 
+                        1e-9);
+    }
+    else {
+      EXPECT_TRUE(facet2d.computeLowerDistalPoint().isNull());
+      EXPECT_TRUE(facet3d.computeLowerDistalPoint().isNull());
+      if (delta == 0.0) {
+        EXPECT_TRUE(armadilloLowerDistalPoint(vertices2d).isNull());
+        EXPECT_TRUE(armadilloLowerDistalPoint(vertices3d).isNull());
+      }
+    }
+  }
+}
+
+
 }  // namespace
 
 
@@ -0,0 +1,124 @@
+/*! \file FixedPointTest.cpp
+ *  \brief Unit test for the FixedPoint class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <array>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../FixedPoint.h"
+#include "../NonDominatedSet.h"
+#include "../NullObjectException.h"
+#include "../DifferentDimensionsException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::FixedPoint;
+using pareto_approximator::NonDominatedSet;
+using pareto_approximator::exception_classes::NullObjectException;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+
+
+namespace {
+
+
+// Test FixedPoint's constructors, accessors and conversions.
+TEST(FixedPointTest, ConstructorsAndConversionsWork)
+{
+  FixedPoint<2> origin;
+  EXPECT_EQ(2, origin.dimension());
+  EXPECT_EQ(0.0, origin[0]);
+  EXPECT_EQ(0.0, origin[1]);
+
+  FixedPoint<3> p(1.0, 2.5, 3.0);
+  EXPECT_EQ(3, p.dimension());
+  EXPECT_EQ(2.5, p[1]);
+  EXPECT_EQ(Point(1.0, 2.5, 3.0), p.toPoint());
+  EXPECT_EQ(p, FixedPoint<3>(p.toPoint()));
+  EXPECT_EQ(p.toPoint().str(), p.str());
+
+  std::array<double, 4> coordinates = {{ 1.0, 2.0, 3.0, 4.0 }};
+  FixedPoint<4> q(coordinates);
+  EXPECT_EQ(FixedPoint<4>(1.0, 2.0, 3.0, 4.0), q);
+  q[3] = 5.0;
+  EXPECT_EQ(Point(1.0, 2.0, 3.0, 5.0), q.toPoint());
+
+  Point nullPoint;
+  Point threeDimensionalPoint(1.0, 2.0, 3.0);
+  EXPECT_THROW(FixedPoint<2> fp(nullPoint), NullObjectException);
+  EXPECT_THROW(FixedPoint<2> fp(threeDimensionalPoint),
+               DifferentDimensionsException);
+}
+
+
+// Test FixedPoint's arithmetic and comparison operators.
+TEST(FixedPointTest, OperatorsWork)
+{
+  FixedPoint<2> p(1.0, 2.0);
+  FixedPoint<2> q(3.0, 1.0);
+
+  EXPECT_EQ(FixedPoint<2>(4.0, 3.0), p + q);
+  EXPECT_EQ(FixedPoint<2>(2.0, -1.0), q - p);
+  EXPECT_TRUE(p != q);
+  EXPECT_FALSE(p == q);
+  EXPECT_TRUE(p < q);
+  EXPECT_FALSE(q < p);
+  EXPECT_TRUE(FixedPoint<2>(1.0, 1.0) < p);
+  EXPECT_FALSE(p < p);
+  p += q;
+  EXPECT_EQ(FixedPoint<2>(4.0, 3.0), p);
+
+  // the same results as Point's operators
+  FixedPoint<3> a(1.0, 5.0, 2.0);
+  FixedPoint<3> b(1.0, 4.0, 7.0);
+  EXPECT_EQ(a.toPoint() < b.toPoint(), a < b);
+  EXPECT_EQ(b.toPoint() < a.toPoint(), b < a);
+  EXPECT_EQ((a + b).toPoint(), a.toPoint() + b.toPoint());
+}
+
+
+// Test FixedPoint::dominates(). (same as Point::dominates())
+TEST(FixedPointTest, DominatesWorks)
+{
+  FixedPoint<3> p(1.0, 2.0, 3.0);
+  FixedPoint<3> q(1.0, 2.5, 3.0);
+  FixedPoint<3> r(0.5, 2.5, 3.5);
+
+  EXPECT_TRUE(p.dominates(p));
+  EXPECT_TRUE(p.dominates(q));
+  EXPECT_FALSE(q.dominates(p));
+  EXPECT_FALSE(p.dominates(r));
+  EXPECT_FALSE(r.dominates(p));
+  EXPECT_TRUE(r.dominates(p, 0.5));
+  EXPECT_FALSE(r.dominates(p, 0.4));
+  EXPECT_EQ(r.toPoint().dominates(p.toPoint(), 0.5), r.dominates(p, 0.5));
+}
+
+
+// Test that NonDominatedSet works with FixedPoint elements.
+TEST(FixedPointTest, NonDominatedSetOfFixedPointsWorks)
+{
+  NonDominatedSet< FixedPoint<2> > nds;
+  EXPECT_TRUE(nds.insert(FixedPoint<2>(2.0, 2.0)));
+  EXPECT_TRUE(nds.insert(FixedPoint<2>(1.0, 3.0)));
+  EXPECT_FALSE(nds.insert(FixedPoint<2>(2.0, 3.0)));
+  EXPECT_EQ(2, nds.size());
+  EXPECT_TRUE(nds.insert(FixedPoint<2>(1.0, 1.0)));
+  ASSERT_EQ(1, nds.size());
+  EXPECT_EQ(FixedPoint<2>(1.0, 1.0), *nds.begin());
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
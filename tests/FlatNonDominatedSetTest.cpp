@@ -0,0 +1,145 @@
+/*! \file FlatNonDominatedSetTest.cpp
+ *  \brief Unit test for the FlatNonDominatedSet class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../FixedPoint.h"
+#include "../PointAndSolution.h"
+#include "../NonDominatedSet.h"
+#include "../FlatNonDominatedSet.h"
+#include "../DifferentDimensionsException.h"
+#include "../NotPositivePointException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::FixedPoint;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::NonDominatedSet;
+using pareto_approximator::FlatNonDominatedSet;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+using pareto_approximator::exception_classes::NotPositivePointException;
+
+
+namespace {
+
+
+// Make a random point. (coordinates in 0, 1, ..., range-1)
+Point
+randomPoint(unsigned int dimension, int range)
+{
+  std::vector<double> coordinates(dimension);
+  for (unsigned int i = 0; i != dimension; ++i)
+    coordinates[i] = std::rand() % range;
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+// Check that a FlatNonDominatedSet and a NonDominatedSet have the same
+// elements. (in the same order)
+template <class T>
+void
+expectSameElements(const NonDominatedSet<T> & nds,
+                   const FlatNonDominatedSet<T> & flat)
+{
+  ASSERT_EQ(nds.size(), flat.size());
+  typename NonDominatedSet<T>::const_iterator si = nds.begin();
+  typename FlatNonDominatedSet<T>::iterator fi = flat.begin();
+  for ( ; si != nds.end(); ++si, ++fi)
+    EXPECT_TRUE(*si == *fi);
+}
+
+
+// Test FlatNonDominatedSet's basic methods.
+TEST(FlatNonDominatedSetTest, FlatNonDominatedSetBasicsWork)
+{
+  FlatNonDominatedSet<Point> flat;
+  EXPECT_TRUE(flat.empty());
+  EXPECT_FALSE(flat.dominates(Point(1, 2, 3)));
+  EXPECT_TRUE(flat.insert(Point(3, 2, 1)));
+  EXPECT_TRUE(flat.insert(Point(1, 2, 3)));
+  EXPECT_TRUE(flat.insert(Point(2, 2, 2)));
+  EXPECT_FALSE(flat.insert(Point(1, 2, 3)));
+  EXPECT_FALSE(flat.insert(Point(2, 3, 4)));
+  EXPECT_TRUE(flat.dominates(Point(3, 3, 3)));
+  EXPECT_FALSE(flat.dominates(Point(1, 1, 4)));
+  ASSERT_EQ(3, flat.size());
+  // sorted on demand
+  FlatNonDominatedSet<Point>::iterator it = flat.begin();
+  EXPECT_EQ(Point(1, 2, 3), *it++);
+  EXPECT_EQ(Point(2, 2, 2), *it++);
+  EXPECT_EQ(Point(3, 2, 1), *it++);
+  EXPECT_TRUE(it == flat.end());
+  EXPECT_TRUE(flat.find(Point(2, 2, 2)) != flat.end());
+  EXPECT_TRUE(flat.find(Point(2, 2, 3)) == flat.end());
+  EXPECT_THROW(flat.insert(Point(1, 1)), DifferentDimensionsException);
+  EXPECT_THROW(flat.insert(Point(-1, 1, 1)), NotPositivePointException);
+
+  // dominates the first and the second element
+  EXPECT_TRUE(flat.insert(Point(1, 2, 2)));
+  ASSERT_EQ(2, flat.size());
+  EXPECT_EQ(Point(1, 2, 2), *flat.begin());
+  EXPECT_EQ(Point(3, 2, 1), *(flat.begin() + 1));
+
+  flat.clear();
+  EXPECT_TRUE(flat.empty());
+  EXPECT_TRUE(flat.insert(Point(1, 1)));
+}
+
+
+// Test that FlatNonDominatedSet keeps the same elements as
+// NonDominatedSet.
+TEST(FlatNonDominatedSetTest, FlatNonDominatedSetMatchesNonDominatedSet)
+{
+  std::srand(31);
+  for (unsigned int dimension = 2; dimension <= 5; ++dimension) {
+    NonDominatedSet<Point> nds;
+    FlatNonDominatedSet<Point> flat;
+    NonDominatedSet< PointAndSolution<int> > ndsPas;
+    FlatNonDominatedSet< PointAndSolution<int> > flatPas;
+    for (unsigned int k = 0; k != 2000; ++k) {
+      Point p = randomPoint(dimension, 50);
+      EXPECT_EQ(nds.dominates(p), flat.dominates(p));
+      EXPECT_EQ(nds.insert(p), flat.insert(p));
+      EXPECT_EQ(ndsPas.insert(PointAndSolution<int>(p, k)),
+                flatPas.insert(PointAndSolution<int>(p, k)));
+      // (look at the elements now and then, so that they get sorted
+      // between insertions too)
+      if (k % 300 == 0)
+        expectSameElements(nds, flat);
+    }
+    expectSameElements(nds, flat);
+    expectSameElements(ndsPas, flatPas);
+
+    // copies are independent
+    FlatNonDominatedSet<Point> copy(flat);
+    flat.clear();
+    expectSameElements(nds, copy);
+  }
+
+  NonDominatedSet< FixedPoint<3> > ndsFixed;
+  FlatNonDominatedSet< FixedPoint<3> > flatFixed;
+  for (unsigned int k = 0; k != 1000; ++k) {
+    FixedPoint<3> p(randomPoint(3, 20));
+    EXPECT_EQ(ndsFixed.insert(p), flatFixed.insert(p));
+  }
+  expectSameElements(ndsFixed, flatFixed);
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,195 @@
+/*! \file HullVerticesTest.cpp
+ *  \brief Unit test for findConvexHullVertices() and
+ *         findLowerConvexEnvelopeVertices().
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../ConvexHull.h"
+#include "../HullVertices.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::ConvexHull;
+using pareto_approximator::findConvexHullVertices;
+using pareto_approximator::findLowerConvexEnvelopeVertices;
+
+
+namespace {
+
+
+// Make random points close to the sphere of radius 1000 around
+// (2000, 2000, ...), in the first quadrant/octant. (so that many of them
+// are hull vertices)
+std::vector<double>
+randomRoundPoints(unsigned int numPoints, unsigned int dimension)
+{
+  std::vector<double> coordinates;
+  std::vector<double> p(dimension);
+  for (unsigned int k = 0; k != numPoints; ++k) {
+    double length = 0.0;
+    for (unsigned int i = 0; i != dimension; ++i) {
+      p[i] = (std::rand() % 2001) - 1000.0;
+      length += p[i] * p[i];
+    }
+    length = std::sqrt(length);
+    double radius = 1000.0 - (std::rand() % 50);
+    for (unsigned int i = 0; i != dimension; ++i)
+      coordinates.push_back(length > 0.0 ?
+                            2000.0 + radius * p[i] / length : 2000.0);
+  }
+  return coordinates;
+}
+
+
+// The hull vertices according to ConvexHull.
+std::vector<unsigned int>
+convexHullExtremePoints(const std::vector<double> & coordinates,
+                        unsigned int dimension)
+{
+  ConvexHull hull(dimension);
+  for (unsigned int k = 0; k != coordinates.size() / dimension; ++k)
+    hull.addPoint(Point(coordinates.begin() + k * dimension,
+                        coordinates.begin() + (k + 1) * dimension));
+  return hull.getExtremePointIndices();
+}
+
+
+// The index of the (first) point that minimizes w * p.
+unsigned int
+bestPoint(const std::vector<double> & coordinates,
+          const std::vector<double> & w)
+{
+  const unsigned int dimension = w.size();
+  unsigned int best = 0;
+  double bestValue = 0.0;
+  for (unsigned int k = 0; k != coordinates.size() / dimension; ++k) {
+    double value = 0.0;
+    for (unsigned int i = 0; i != dimension; ++i)
+      value += w[i] * coordinates[k * dimension + i];
+    if (k == 0 or value < bestValue) {
+      best = k;
+      bestValue = value;
+    }
+  }
+  return best;
+}
+
+
+// Test findConvexHullVertices() on small examples.
+TEST(HullVerticesTest, ConvexHullVerticesOfSmallSetsWork)
+{
+  // a square, its center, a point on an edge and a copy of a corner
+  std::vector<double> square = { 0, 0,  2, 0,  1, 1,  2, 2,  0, 2,  1, 0,
+                                 2, 2 };
+  std::vector<unsigned int> expected = { 0, 1, 3, 4 };
+  EXPECT_EQ(expected, findConvexHullVertices(square, 2));
+
+  // a cube's corners, its center and a point on a face
+  std::vector<double> cube;
+  for (unsigned int k = 0; k != 8; ++k) {
+    cube.push_back(k & 1);
+    cube.push_back((k >> 1) & 1);
+    cube.push_back((k >> 2) & 1);
+  }
+  cube.insert(cube.end(), { 0.5, 0.5, 0.5,  0.5, 0.5, 1.0 });
+  expected = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  EXPECT_EQ(expected, findConvexHullVertices(cube, 3));
+
+  // points that do not span the space: every index
+  std::vector<double> line = { 0, 0,  1, 1,  3, 3,  2, 2 };
+  expected = { 0, 1, 2, 3 };
+  EXPECT_EQ(expected, findConvexHullVertices(line, 2));
+  std::vector<double> plane = { 0, 0, 1,  1, 0, 1,  0, 1, 1,  1, 1, 1 };
+  EXPECT_EQ(expected, findConvexHullVertices(plane, 3));
+
+  // the lower envelope of the square is its corner at the origin
+  expected = { 0 };
+  EXPECT_EQ(expected, findLowerConvexEnvelopeVertices(square, 2));
+  // the lower envelope of a segment is one of its endpoints or both
+  std::vector<double> segment = { 0, 3,  1, 2,  3, 0,  2, 1,  1, 2.5 };
+  expected = { 0, 2 };
+  EXPECT_EQ(expected, findLowerConvexEnvelopeVertices(segment, 2));
+  expected = { 0 };
+  EXPECT_EQ(expected, findLowerConvexEnvelopeVertices(line, 2));
+  // the cube's lower envelope is its corner at the origin
+  EXPECT_EQ(expected, findLowerConvexEnvelopeVertices(cube, 3));
+}
+
+
+// Test that findConvexHullVertices() finds ConvexHull's extreme points,
+// whatever the number of threads.
+TEST(HullVerticesTest, ConvexHullVerticesMatchConvexHull)
+{
+  std::srand(37);
+  for (unsigned int dimension = 2; dimension <= 3; ++dimension) {
+    std::vector<double> coordinates = randomRoundPoints(3000, dimension);
+    std::vector<unsigned int> vertices = findConvexHullVertices(coordinates,
+                                                                dimension);
+    EXPECT_EQ(convexHullExtremePoints(coordinates, dimension), vertices);
+
+    std::vector<double> more = randomRoundPoints(20000, dimension);
+    vertices = findConvexHullVertices(more, dimension);
+    for (unsigned int numThreads = 2; numThreads <= 5; ++numThreads)
+      EXPECT_EQ(vertices, findConvexHullVertices(more, dimension,
+                                                 numThreads));
+  }
+}
+
+
+// Test that findLowerConvexEnvelopeVertices() finds the hull vertices
+// that minimize positive linear combinations of the coordinates and
+// nothing else.
+TEST(HullVerticesTest, LowerConvexEnvelopeVerticesWork)
+{
+  std::srand(41);
+  for (unsigned int dimension = 2; dimension <= 3; ++dimension) {
+    std::vector<double> coordinates = randomRoundPoints(5000, dimension);
+    std::vector<unsigned int> hull = findConvexHullVertices(coordinates,
+                                                            dimension);
+    std::vector<unsigned int> envelope;
+    envelope = findLowerConvexEnvelopeVertices(coordinates, dimension);
+    EXPECT_EQ(envelope, findLowerConvexEnvelopeVertices(coordinates,
+                                                        dimension, 3));
+    EXPECT_LT(envelope.size(), hull.size());
+    EXPECT_TRUE(std::includes(hull.begin(), hull.end(),
+                              envelope.begin(), envelope.end()));
+
+    // every point that minimizes a positive linear combination is there
+    std::vector<double> w(dimension);
+    for (unsigned int k = 0; k != 500; ++k) {
+      for (unsigned int i = 0; i != dimension; ++i)
+        w[i] = 1 + std::rand() % 1000;
+      unsigned int best = bestPoint(coordinates, w);
+      EXPECT_TRUE(std::binary_search(envelope.begin(), envelope.end(), best));
+    }
+
+    // every envelope vertex is on the side of the sphere facing the origin
+    for (unsigned int k = 0; k != envelope.size(); ++k) {
+      double sum = 0.0;
+      for (unsigned int i = 0; i != dimension; ++i)
+        sum += coordinates[envelope[k] * dimension + i] - 2000.0;
+      EXPECT_LT(sum, 0.0);
+    }
+  }
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -7,6 +7,7 @@
 
 #include <set>
 #include <vector>
+#include <cmath>
 
 #include "gtest/gtest.h"
 #include "../Hyperplane.h"
@@ -237,6 +238,32 @@ TEST_F(HyperplaneTest, HyperplaneParallelThroughAndIsParallelWork)
 }
 
 
+// Test that the unchecked Hyperplane distance methods agree with the 
+// checked ones.
+TEST_F(HyperplaneTest, HyperplaneUncheckedDistancesWork)
+{
+  Hyperplane h(1.0, 1.0, 1.0, 6.0);
+  Point points[3] = { Point(1, 1, 1), Point(2, 2, 2), Point(8, 8, 8) };
+  for (unsigned int k = 0; k != 3; ++k) {
+    const Point & p = points[k];
+    EXPECT_EQ(h.ratioDistance(p), h.ratioDistanceUnchecked(p));
+    EXPECT_EQ(h.distance(p), h.distanceUnchecked(p));
+  }
+  EXPECT_EQ(1.0, h.distanceUnchecked(Point(1, 1, 1)));
+  EXPECT_EQ(0.0, h.distanceUnchecked(Point(2, 2, 2)));
+  EXPECT_EQ(0.0, h.distanceUnchecked(Point(8, 8, 8)));
+
+  // the checked methods throw if p's coordinate vector is perpendicular 
+  // to the hyperplane's normal vector, the unchecked ones return infinity
+  Hyperplane perpendicular(1.0, -1.0, 1.0);
+  Point parallelPoint(1.0, 1.0);
+  EXPECT_THROW(perpendicular.distance(parallelPoint), 
+               exception_classes::InfiniteRatioDistanceException);
+  EXPECT_TRUE(std::isinf(perpendicular.ratioDistanceUnchecked(parallelPoint)));
+  EXPECT_TRUE(std::isinf(perpendicular.distanceUnchecked(parallelPoint)));
+}
+
+
 // Test that Hyperplane::hasAllAiCoefficientsNonPositive() works as expected.
 TEST_F(HyperplaneTest, HyperplaneHasAllAiCoefficientsNonPositiveWorks)
 {
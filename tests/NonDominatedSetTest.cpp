@@ -7,15 +7,18 @@
 
 #include <string>
 #include <vector>
+#include <cstdlib>
 
 #include "gtest/gtest.h"
 #include "../Point.h"
 #include "../PointAndSolution.h"
+#include "../FixedPoint.h"
 #include "../NonDominatedSet.h"
 
 
 using pareto_approximator::Point;
 using pareto_approximator::PointAndSolution;
+using pareto_approximator::FixedPoint;
 using pareto_approximator::NonDominatedSet;
 
 
@@ -126,6 +129,44 @@ TEST_F(NonDominatedSetTest, NonDominatedSetInsertWorks)
 }
 
 
+// Test that the staircase version (2-dimensional FixedPoint elements) 
+// keeps the same elements as the general version.
+TEST_F(NonDominatedSetTest, NonDominatedSetStaircaseWorks)
+{
+  NonDominatedSet< FixedPoint<2> > staircase;
+  EXPECT_TRUE(staircase.insert(FixedPoint<2>(2, 2)));
+  EXPECT_FALSE(staircase.dominates(FixedPoint<2>(1, 1)));
+  EXPECT_TRUE(staircase.dominates(FixedPoint<2>(2, 3)));
+  EXPECT_FALSE(staircase.insert(FixedPoint<2>(2, 2)));
+  EXPECT_TRUE(staircase.insert(FixedPoint<2>(2, 1)));
+  EXPECT_TRUE(staircase.insert(FixedPoint<2>(1, 3)));
+  EXPECT_TRUE(staircase.insert(FixedPoint<2>(3, 0.5)));
+  EXPECT_EQ(staircase.size(), 3);
+  // dominates (2, 1) and (3, 0.5) but not (1, 3)
+  EXPECT_TRUE(staircase.insert(FixedPoint<2>(1.5, 0.5)));
+  ASSERT_EQ(staircase.size(), 2);
+  EXPECT_EQ(*staircase.begin(), FixedPoint<2>(1, 3));
+  EXPECT_EQ(*(++staircase.begin()), FixedPoint<2>(1.5, 0.5));
+
+  std::srand(5);
+  for (unsigned int run = 0; run != 20; ++run) {
+    NonDominatedSet<Point> general;
+    staircase.clear();
+    for (unsigned int k = 0; k != 100; ++k) {
+      double x = std::rand() % 20;
+      double y = std::rand() % 20;
+      EXPECT_EQ(general.insert(Point(x, y)), 
+                staircase.insert(FixedPoint<2>(x, y)));
+    }
+    ASSERT_EQ(general.size(), staircase.size());
+    NonDominatedSet<Point>::iterator git = general.begin();
+    NonDominatedSet< FixedPoint<2> >::iterator sit = staircase.begin();
+    for ( ; git != general.end(); ++git, ++sit)
+      EXPECT_EQ(*git, sit->toPoint());
+  }
+}
+
+
 }  // namespace
 
 
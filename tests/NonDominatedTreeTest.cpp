@@ -0,0 +1,152 @@
+/*! \file NonDominatedTreeTest.cpp
+ *  \brief Unit test for the NonDominatedTree class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../FixedPoint.h"
+#include "../PointAndSolution.h"
+#include "../NonDominatedSet.h"
+#include "../NonDominatedTree.h"
+#include "../DifferentDimensionsException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::FixedPoint;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::NonDominatedSet;
+using pareto_approximator::NonDominatedTree;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+
+
+namespace {
+
+
+// Make a random point. (coordinates in 0, 1, ..., range-1)
+Point
+randomPoint(unsigned int dimension, int range)
+{
+  std::vector<double> coordinates(dimension);
+  for (unsigned int i = 0; i != dimension; ++i)
+    coordinates[i] = std::rand() % range;
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+// Check that a NonDominatedTree and a NonDominatedSet have the same
+// elements.
+template <class T>
+void
+expectSameElements(const NonDominatedSet<T> & nds,
+                   const NonDominatedTree<T> & ndt)
+{
+  ASSERT_EQ(nds.size(), ndt.size());
+  typename NonDominatedSet<T>::const_iterator si = nds.begin();
+  typename NonDominatedTree<T>::iterator ti = ndt.begin();
+  for ( ; si != nds.end(); ++si, ++ti)
+    EXPECT_TRUE(*si == *ti);
+}
+
+
+// Test NonDominatedTree's basic methods.
+TEST(NonDominatedTreeTest, NonDominatedTreeBasicsWork)
+{
+  NonDominatedTree<Point> ndt;
+  EXPECT_TRUE(ndt.empty());
+  EXPECT_FALSE(ndt.dominates(Point(1, 2, 3)));
+  EXPECT_TRUE(ndt.insert(Point(1, 2, 3)));
+  EXPECT_TRUE(ndt.insert(Point(3, 2, 1)));
+  EXPECT_FALSE(ndt.insert(Point(1, 2, 3)));
+  EXPECT_FALSE(ndt.insert(Point(2, 3, 4)));
+  EXPECT_TRUE(ndt.dominates(Point(3, 3, 3)));
+  EXPECT_FALSE(ndt.dominates(Point(2, 2, 2)));
+  EXPECT_EQ(2, ndt.size());
+  EXPECT_TRUE(ndt.find(Point(3, 2, 1)) != ndt.end());
+  EXPECT_TRUE(ndt.find(Point(2, 2, 2)) == ndt.end());
+  EXPECT_THROW(ndt.insert(Point(1, 1)), DifferentDimensionsException);
+
+  // dominates both elements
+  EXPECT_TRUE(ndt.insert(Point(1, 1, 1)));
+  ASSERT_EQ(1, ndt.size());
+  EXPECT_EQ(Point(1, 1, 1), *ndt.begin());
+
+  ndt.clear();
+  EXPECT_TRUE(ndt.empty());
+  EXPECT_TRUE(ndt.insert(Point(1, 1)));
+}
+
+
+// Test that NonDominatedTree keeps the same elements as NonDominatedSet.
+// (small leaves, so that the tree has many levels)
+TEST(NonDominatedTreeTest, NonDominatedTreeMatchesNonDominatedSet)
+{
+  std::srand(11);
+  unsigned int dimensions[] = { 2, 3, 4, 6 };
+  unsigned int leafSizes[] = { 1, 3, 20 };
+  for (unsigned int d = 0; d != 4; ++d)
+    for (unsigned int l = 0; l != 3; ++l) {
+      NonDominatedSet<Point> nds;
+      NonDominatedTree<Point> ndt(leafSizes[l]);
+      for (unsigned int k = 0; k != 1000; ++k) {
+        // points close to the plane sum(p) = 50 (many non-dominated)
+        Point p = randomPoint(dimensions[d], 30);
+        double sum = 0.0;
+        for (unsigned int i = 0; i != p.dimension(); ++i)
+          sum += p[i];
+        if (sum < 40.0 or sum > 60.0)
+          continue;
+        EXPECT_EQ(nds.dominates(p), ndt.dominates(p));
+        EXPECT_EQ(nds.insert(p), ndt.insert(p));
+      }
+      expectSameElements(nds, ndt);
+
+      // copies get their own tree
+      NonDominatedTree<Point> copy(ndt);
+      ndt.clear();
+      expectSameElements(nds, copy);
+      std::vector<double> zeros(dimensions[d], 0.0);
+      Point origin(zeros.begin(), zeros.end());
+      EXPECT_TRUE(copy.insert(origin));
+      EXPECT_EQ(1, copy.size());
+    }
+}
+
+
+// Test NonDominatedTree with FixedPoint and PointAndSolution elements.
+TEST(NonDominatedTreeTest, NonDominatedTreeOfOtherTypesWorks)
+{
+  NonDominatedTree< FixedPoint<3> > fixedPoints(2);
+  NonDominatedTree< PointAndSolution<int> > pointsAndSolutions(2);
+  NonDominatedSet< PointAndSolution<int> > nds;
+  std::srand(13);
+  for (unsigned int k = 0; k != 300; ++k) {
+    Point p = randomPoint(3, 10);
+    fixedPoints.insert(FixedPoint<3>(p));
+    pointsAndSolutions.insert(PointAndSolution<int>(p, k));
+    nds.insert(PointAndSolution<int>(p, k));
+  }
+  expectSameElements(nds, pointsAndSolutions);
+  ASSERT_EQ(nds.size(), fixedPoints.size());
+  NonDominatedTree< FixedPoint<3> >::iterator fi = fixedPoints.begin();
+  NonDominatedSet< PointAndSolution<int> >::iterator si = nds.begin();
+  for ( ; fi != fixedPoints.end(); ++fi, ++si)
+    EXPECT_EQ(si->point, fi->toPoint());
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,219 @@
+/*! \file ParetoFilterTest.cpp
+ *  \brief Unit test for findNonDominatedPoints(), filterDominatedPoints()
+ *         and the bulk construction of NonDominatedSet.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../FixedPoint.h"
+#include "../PointAndSolution.h"
+#include "../NonDominatedSet.h"
+#include "../ParetoFilter.h"
+#include "../utility.h"
+#include "../DifferentDimensionsException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::FixedPoint;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::NonDominatedSet;
+using pareto_approximator::findNonDominatedPoints;
+using pareto_approximator::utility::filterDominatedPoints;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+
+
+namespace {
+
+
+// Make a random point. (coordinates in 0, 1, ..., range-1)
+Point
+randomPoint(unsigned int dimension, int range)
+{
+  std::vector<double> coordinates(dimension);
+  for (unsigned int i = 0; i != dimension; ++i)
+    coordinates[i] = std::rand() % range;
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+// Find the non-dominated points by comparing every pair.
+std::vector<unsigned int>
+bruteForce(const std::vector<double> & coordinates, unsigned int dimension)
+{
+  const unsigned int numPoints = coordinates.size() / dimension;
+  std::vector<unsigned int> result;
+  for (unsigned int q = 0; q != numPoints; ++q) {
+    bool isDominated = false;
+    for (unsigned int p = 0; p != numPoints and not isDominated; ++p) {
+      if (p == q)
+        continue;
+      bool isLessOrEqual = true;
+      bool isEqual = true;
+      for (unsigned int i = 0; i != dimension; ++i) {
+        double pi = coordinates[p * dimension + i];
+        double qi = coordinates[q * dimension + i];
+        isLessOrEqual = isLessOrEqual and pi <= qi;
+        isEqual = isEqual and pi == qi;
+      }
+      // of equal points the first is kept
+      isDominated = isLessOrEqual and (not isEqual or p < q);
+    }
+    if (not isDominated)
+      result.push_back(q);
+  }
+
+  return result;
+}
+
+
+// Test findNonDominatedPoints() against the brute force filter.
+TEST(ParetoFilterTest, FindNonDominatedPointsWorks)
+{
+  EXPECT_TRUE(findNonDominatedPoints(std::vector<double>(), 3).empty());
+
+  std::srand(17);
+  unsigned int sizes[] = { 1, 5, 40, 300, 2000 };
+  int ranges[] = { 3, 20, 1000 };
+  for (unsigned int dimension = 1; dimension <= 6; ++dimension)
+    for (unsigned int s = 0; s != 5; ++s)
+      for (unsigned int r = 0; r != 3; ++r) {
+        std::vector<double> coordinates;
+        for (unsigned int k = 0; k != sizes[s] * dimension; ++k)
+          coordinates.push_back(std::rand() % ranges[r]);
+        EXPECT_EQ(bruteForce(coordinates, dimension),
+                  findNonDominatedPoints(coordinates, dimension));
+      }
+
+  // points on the plane sum(p) = 30 (nobody dominates anybody)
+  for (unsigned int dimension = 2; dimension <= 5; ++dimension) {
+    std::vector<double> coordinates;
+    for (unsigned int k = 0; k != 1000; ++k) {
+      double rest = 30.0;
+      for (unsigned int i = 0; i + 1 != dimension; ++i) {
+        double xi = std::rand() % 11;
+        coordinates.push_back(xi);
+        rest -= xi;
+      }
+      coordinates.push_back(rest);
+    }
+    EXPECT_EQ(bruteForce(coordinates, dimension),
+              findNonDominatedPoints(coordinates, dimension));
+  }
+}
+
+
+// Test that the parallel filter finds the same points as the sequential one.
+TEST(ParetoFilterTest, ParallelFindNonDominatedPointsWorks)
+{
+  std::srand(23);
+  for (unsigned int dimension = 2; dimension <= 5; ++dimension) {
+    std::vector<double> coordinates;
+    for (unsigned int k = 0; k != 50000 * dimension; ++k)
+      coordinates.push_back(std::rand() % 200);
+    std::vector<unsigned int> expected = 
+          findNonDominatedPoints(coordinates, dimension);
+    for (unsigned int numThreads = 1; numThreads <= 7; ++numThreads)
+      EXPECT_EQ(expected, 
+                findNonDominatedPoints(coordinates, dimension, numThreads));
+  }
+
+  // filterDominatedPoints() returns the same points in the same order
+  std::vector< PointAndSolution<int> > pointsAndSolutions;
+  for (unsigned int k = 0; k != 30000; ++k)
+    pointsAndSolutions.push_back(
+          PointAndSolution<int>(randomPoint(3, 100), k));
+  std::vector< PointAndSolution<int> > sequential = 
+        filterDominatedPoints<int>(pointsAndSolutions.begin(), 
+                                   pointsAndSolutions.end());
+  std::vector< PointAndSolution<int> > parallel = 
+        filterDominatedPoints<int>(pointsAndSolutions.begin(), 
+                                   pointsAndSolutions.end(), 4);
+  ASSERT_EQ(sequential.size(), parallel.size());
+  for (unsigned int k = 0; k != sequential.size(); ++k) {
+    EXPECT_EQ(sequential[k].point, parallel[k].point);
+    EXPECT_EQ(sequential[k].solution, parallel[k].solution);
+  }
+}
+
+
+// Test that the bulk construction keeps what inserting one by one keeps.
+TEST(ParetoFilterTest, NonDominatedSetBulkConstructionWorks)
+{
+  std::srand(19);
+  unsigned int dimensions[] = { 2, 3, 4, 5 };
+  for (unsigned int d = 0; d != 4; ++d) {
+    std::vector<Point> points;
+    std::vector< PointAndSolution<int> > pointsAndSolutions;
+    for (unsigned int k = 0; k != 500; ++k) {
+      points.push_back(randomPoint(dimensions[d], 40));
+      pointsAndSolutions.push_back(
+            PointAndSolution<int>(points.back(), k));
+    }
+
+    NonDominatedSet<Point> sequential;
+    sequential.insert(points.begin(), points.end());
+    NonDominatedSet<Point> bulk(points.begin(), points.end());
+    EXPECT_EQ(sequential.size(), bulk.size());
+    EXPECT_TRUE(std::equal(bulk.begin(), bulk.end(), sequential.begin()));
+    EXPECT_EQ(sequential.dominates(points.back()),
+              bulk.dominates(points.back()));
+
+    // of equal points the first is kept
+    NonDominatedSet< PointAndSolution<int> > sequentialPas;
+    sequentialPas.insert(pointsAndSolutions.begin(),
+                         pointsAndSolutions.end());
+    NonDominatedSet< PointAndSolution<int> > bulkPas(
+            pointsAndSolutions.begin(), pointsAndSolutions.end());
+    ASSERT_EQ(sequentialPas.size(), bulkPas.size());
+    NonDominatedSet< PointAndSolution<int> >::iterator si, bi;
+    for (si = sequentialPas.begin(), bi = bulkPas.begin();
+         si != sequentialPas.end(); ++si, ++bi)
+      EXPECT_EQ(si->solution, bi->solution);
+  }
+
+  // the staircase (FixedPoint<2>) and the blocked (FixedPoint<3>) sets
+  std::vector< FixedPoint<2> > points2;
+  std::vector< FixedPoint<3> > points3;
+  for (unsigned int k = 0; k != 500; ++k) {
+    points2.push_back(FixedPoint<2>(randomPoint(2, 100)));
+    points3.push_back(FixedPoint<3>(randomPoint(3, 30)));
+  }
+  NonDominatedSet< FixedPoint<2> > sequential2, bulk2(points2.begin(),
+                                                      points2.end());
+  sequential2.insert(points2.begin(), points2.end());
+  EXPECT_EQ(sequential2.size(), bulk2.size());
+  EXPECT_TRUE(std::equal(bulk2.begin(), bulk2.end(), sequential2.begin()));
+  NonDominatedSet< FixedPoint<3> > sequential3, bulk3(points3.begin(),
+                                                      points3.end());
+  sequential3.insert(points3.begin(), points3.end());
+  EXPECT_EQ(sequential3.size(), bulk3.size());
+  EXPECT_TRUE(std::equal(bulk3.begin(), bulk3.end(), sequential3.begin()));
+  // (the set's point block must be usable afterwards)
+  EXPECT_TRUE(bulk3.insert(FixedPoint<3>(Point(0, 0, 0))));
+  EXPECT_EQ(1, bulk3.size());
+
+  // mixed dimensions
+  std::vector<Point> mixed(100, Point(1, 2));
+  mixed.push_back(Point(1, 2, 3));
+  EXPECT_THROW(NonDominatedSet<Point>(mixed.begin(), mixed.end()),
+               DifferentDimensionsException);
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,258 @@
+/*! \file PointBlockTest.cpp
+ *  \brief Unit test for the PointBlock class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../FixedPoint.h"
+#include "../PointAndSolution.h"
+#include "../PointBlock.h"
+#include "../Facet.h"
+#include "../NonDominatedSet.h"
+#include "../NullObjectException.h"
+#include "../DifferentDimensionsException.h"
+#include "../NotStrictlyPositivePointException.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::FixedPoint;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::PointBlock;
+using pareto_approximator::Facet;
+using pareto_approximator::NonDominatedSet;
+using pareto_approximator::exception_classes::NullObjectException;
+using pareto_approximator::exception_classes::DifferentDimensionsException;
+using pareto_approximator::exception_classes::NotStrictlyPositivePointException;
+
+
+namespace {
+
+
+// Make a random, strictly positive point. (coordinates in 1, 2, ..., 10
+// so that there are ties)
+Point
+randomPoint(unsigned int dimension)
+{
+  std::vector<double> coordinates(dimension);
+  for (unsigned int i = 0; i != dimension; ++i)
+    coordinates[i] = 1.0 + (std::rand() % 10);
+  return Point(coordinates.begin(), coordinates.end());
+}
+
+
+// The test fixture for the PointBlock class.
+// - Runs every test with and without SIMD instructions.
+class PointBlockTest : public ::testing::TestWithParam<bool>
+{
+  protected:
+    PointBlockTest() : simdWasEnabled_(PointBlock::simdEnabled())
+    {
+      PointBlock::setSimdEnabled(GetParam());
+    }
+
+    ~PointBlockTest()
+    {
+      PointBlock::setSimdEnabled(simdWasEnabled_);
+    }
+
+  private:
+    bool simdWasEnabled_;
+};
+
+
+// Test PointBlock's constructors, accessors, push_back(), erase() and
+// clear().
+TEST_P(PointBlockTest, ContainerMethodsWork)
+{
+  PointBlock block;
+  EXPECT_EQ(0, block.dimension());
+  EXPECT_TRUE(block.empty());
+
+  block.push_back(Point(1.0, 2.0, 3.0));
+  block.push_back(FixedPoint<3>(4.0, 5.0, 6.0));
+  block.push_back(Point(7.0, 8.0, 9.0));
+  EXPECT_EQ(3, block.dimension());
+  EXPECT_EQ(3, block.size());
+  EXPECT_EQ(5.0, block.coordinate(1, 1));
+  EXPECT_EQ(Point(7.0, 8.0, 9.0), block.point(2));
+
+  Point nullPoint;
+  EXPECT_THROW(block.push_back(nullPoint), NullObjectException);
+  EXPECT_THROW(block.push_back(Point(1.0, 2.0)),
+               DifferentDimensionsException);
+  EXPECT_THROW(block.someDominates(Point(1.0, 2.0)),
+               DifferentDimensionsException);
+  EXPECT_EQ(3, block.size());
+
+  // the last point takes the erased point's place
+  block.erase(0);
+  ASSERT_EQ(2, block.size());
+  EXPECT_EQ(Point(7.0, 8.0, 9.0), block.point(0));
+  EXPECT_EQ(Point(4.0, 5.0, 6.0), block.point(1));
+
+  block.clear();
+  EXPECT_TRUE(block.empty());
+  EXPECT_EQ(3, block.dimension());
+  EXPECT_FALSE(block.someDominates(Point(1.0, 2.0)));
+
+  PointBlock twoDimensionalBlock(2);
+  EXPECT_EQ(2, twoDimensionalBlock.dimension());
+  EXPECT_THROW(twoDimensionalBlock.push_back(FixedPoint<3>()),
+               DifferentDimensionsException);
+}
+
+
+// Test that the queries give the same results as the Point methods.
+TEST_P(PointBlockTest, QueriesMatchPointMethods)
+{
+  std::srand(42);
+  unsigned int dimensions[] = { 2, 3, 5, 17 };
+  for (unsigned int d = 0; d != 4; ++d) {
+    unsigned int dimension = dimensions[d];
+    std::vector<Point> points;
+    PointBlock block;
+    for (unsigned int k = 0; k != 37; ++k) {
+      points.push_back(randomPoint(dimension));
+      block.push_back(points.back());
+    }
+    std::vector<double> normal(dimension);
+    for (unsigned int i = 0; i != dimension; ++i)
+      normal[i] = 0.5 + i;
+
+    for (unsigned int j = 0; j != 20; ++j) {
+      Point q = randomPoint(dimension);
+      bool someDominates = false;
+      std::vector<unsigned int> dominated;
+      for (unsigned int k = 0; k != points.size(); ++k) {
+        someDominates = someDominates or points[k].dominates(q, 1.0);
+        if (q.dominates(points[k], 1.0))
+          dominated.push_back(k);
+      }
+      EXPECT_EQ(someDominates, block.someDominates(q, 1.0));
+      EXPECT_EQ(dominated, block.dominatedBy(q, 1.0));
+
+      std::vector<double> additiveDistances = block.additiveDistances(q);
+      std::vector<double> ratioDistances = block.ratioDistances(q);
+      std::vector<double> dotProducts = block.dotProducts(normal);
+      for (unsigned int k = 0; k != points.size(); ++k) {
+        EXPECT_EQ(q.additiveDistance(points[k]), additiveDistances[k]);
+        EXPECT_EQ(q.ratioDistance(points[k]), ratioDistances[k]);
+        double dotProduct = 0.0;
+        for (unsigned int i = 0; i != dimension; ++i)
+          dotProduct += normal[i] * points[k][i];
+        EXPECT_EQ(dotProduct, dotProducts[k]);
+      }
+    }
+  }
+
+  PointBlock block;
+  block.push_back(Point(1.0, 2.0));
+  EXPECT_THROW(block.ratioDistances(Point(0.0, 1.0)),
+               NotStrictlyPositivePointException);
+  EXPECT_THROW(block.dotProducts(std::vector<double>(3, 1.0)),
+               DifferentDimensionsException);
+}
+
+
+// Test Facet::additiveDistances() and Facet::ratioDistances().
+TEST_P(PointBlockTest, FacetDistanceBatchesWork)
+{
+  // the plane x + 2y + 3z = 13
+  std::vector< PointAndSolution<int> > vertices;
+  vertices.push_back(PointAndSolution<int>(Point(1.0, 3.0, 2.0), 1));
+  vertices.push_back(PointAndSolution<int>(Point(2.0, 1.0, 3.0), 2));
+  vertices.push_back(PointAndSolution<int>(Point(6.0, 2.0, 1.0), 3));
+  for (unsigned int i = 0; i != 3; ++i)
+    for (unsigned int j = 0; j != 3; ++j)
+      vertices[i].weightsUsed.push_back(i == j ? 1.0 : 0.0);
+  std::vector<double> normal;
+  normal.push_back(1.0);
+  normal.push_back(2.0);
+  normal.push_back(3.0);
+  const std::vector< PointAndSolution<int> > & cvertices = vertices;
+  const std::vector<double> & cnormal = normal;
+  Facet<int> facet(cvertices.begin(), cvertices.end(),
+                   cnormal.begin(), cnormal.end());
+
+  std::srand(7);
+  PointBlock block;
+  std::vector<Point> points;
+  for (unsigned int k = 0; k != 11; ++k) {
+    points.push_back(randomPoint(3));
+    block.push_back(points.back());
+  }
+
+  std::vector<double> additiveDistances = facet.additiveDistances(block);
+  std::vector<double> ratioDistances = facet.ratioDistances(block);
+  ASSERT_EQ(points.size(), additiveDistances.size());
+  ASSERT_EQ(points.size(), ratioDistances.size());
+  for (unsigned int k = 0; k != points.size(); ++k) {
+    EXPECT_DOUBLE_EQ(facet.additiveDistance(points[k]),
+                     additiveDistances[k]);
+    EXPECT_DOUBLE_EQ(facet.ratioDistance(points[k]), ratioDistances[k]);
+  }
+
+  PointBlock twoDimensionalBlock;
+  twoDimensionalBlock.push_back(Point(1.0, 1.0));
+  EXPECT_THROW(facet.additiveDistances(twoDimensionalBlock),
+               DifferentDimensionsException);
+  EXPECT_TRUE(facet.ratioDistances(PointBlock()).empty());
+}
+
+
+// Test that NonDominatedSet (which uses a PointBlock) keeps exactly the
+// non-dominated points.
+TEST_P(PointBlockTest, NonDominatedSetKeepsNonDominatedPoints)
+{
+  std::srand(3);
+  std::vector<Point> points;
+  for (unsigned int k = 0; k != 200; ++k)
+    points.push_back(randomPoint(3));
+
+  NonDominatedSet<Point> nds(points.begin(), points.end());
+  std::vector<Point> expected;
+  for (unsigned int k = 0; k != points.size(); ++k) {
+    bool isDominated = false;
+    for (unsigned int j = 0; j != points.size() and not isDominated; ++j)
+      // strictly dominated, or a duplicate of an earlier point
+      isDominated = (points[j].dominates(points[k]) and
+                     (points[j] != points[k] or j < k));
+    if (not isDominated)
+      expected.push_back(points[k]);
+  }
+  EXPECT_EQ(expected.size(), nds.size());
+  for (unsigned int k = 0; k != expected.size(); ++k)
+    EXPECT_TRUE(nds.find(expected[k]) != nds.end());
+
+  // copies get their own block
+  NonDominatedSet<Point> copy;
+  copy = nds;
+  nds.clear();
+  EXPECT_EQ(expected.size(), copy.size());
+  EXPECT_FALSE(copy.insert(expected[0]));
+  EXPECT_TRUE(copy.insert(Point(0.0, 0.0, 0.0)));
+  EXPECT_EQ(1, copy.size());
+  EXPECT_TRUE(nds.insert(Point(1.0, 2.0)));
+}
+
+
+INSTANTIATE_TEST_CASE_P(WithAndWithoutSimd, PointBlockTest,
+                        ::testing::Bool());
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,104 @@
+/*! \file PointPoolTest.cpp
+ *  \brief Unit test for the PointPool class template.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <string>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "../Point.h"
+#include "../PointAndSolution.h"
+#include "../PointPool.h"
+
+
+using pareto_approximator::Point;
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::PointPool;
+using pareto_approximator::PoolIndex;
+
+
+namespace {
+
+
+// The fixture for testing class template PointPool.
+class PointPoolTest : public ::testing::Test
+{
+  protected:
+    PointPoolTest() { }
+
+    ~PointPoolTest() { }
+
+    // Make a point with a move-only solution.
+    PointAndSolution< std::unique_ptr<std::string> > 
+    makePoint(double x, double y, const std::string & solution)
+    {
+      std::vector<double> weights(2, 0.5);
+      return PointAndSolution< std::unique_ptr<std::string> >(Point(x, y), 
+                      std::unique_ptr<std::string>(new std::string(solution)), 
+                      weights.begin(), weights.end());
+    }
+};
+
+
+// Test that add() returns references with the point, the weights and 
+// the pool index and that get() finds the referred-to points.
+TEST_F(PointPoolTest, AddAndGetWork)
+{
+  PointPool< std::unique_ptr<std::string> > pool;
+  EXPECT_EQ(0, pool.size());
+
+  PointAndSolution<PoolIndex> a = pool.add(makePoint(1.0, 2.0, "a"));
+  PointAndSolution<PoolIndex> b = pool.add(makePoint(2.0, 1.0, "b"));
+  EXPECT_EQ(2, pool.size());
+  EXPECT_EQ(0, a.solution);
+  EXPECT_EQ(1, b.solution);
+  EXPECT_EQ(Point(1.0, 2.0), a.point);
+  EXPECT_EQ(2, a.weightsUsed.size());
+  EXPECT_FALSE(a.isNull());
+
+  // references to earlier points stay valid
+  for (unsigned int i = 0; i != 100; ++i)
+    pool.add(makePoint(3.0, 3.0 + i, "c"));
+  EXPECT_EQ("a", *pool.get(a).solution);
+  EXPECT_EQ("b", *pool.get(b).solution);
+  EXPECT_EQ(Point(2.0, 1.0), pool.get(b).point);
+
+  pool.clear();
+  EXPECT_EQ(0, pool.size());
+}
+
+
+// Test that take() moves the points out of the pool, each only once.
+TEST_F(PointPoolTest, TakeMovesEachPointOnce)
+{
+  PointPool< std::unique_ptr<std::string> > pool;
+  std::vector< PointAndSolution<PoolIndex> > references;
+  references.push_back(pool.add(makePoint(1.0, 2.0, "a")));
+  references.push_back(pool.add(makePoint(2.0, 1.0, "b")));
+  pool.add(makePoint(3.0, 3.0, "c"));
+  references.push_back(references[0]);
+
+  std::vector< PointAndSolution< std::unique_ptr<std::string> > > points;
+  points = pool.take(references.begin(), references.end());
+  ASSERT_EQ(2, points.size());
+  EXPECT_EQ(Point(1.0, 2.0), points[0].point);
+  EXPECT_EQ("a", *points[0].solution);
+  EXPECT_EQ("b", *points[1].solution);
+  EXPECT_EQ(2, points[1].weightsUsed.size());
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int
+main(int argc, char** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
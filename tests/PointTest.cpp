@@ -564,6 +564,34 @@ TEST_F(PointTest, PointDominatesMultiplicativeWorks)
 }
 
 
+// Test that the unchecked Point methods agree with the checked ones.
+TEST_F(PointTest, PointUncheckedMethodsWork) 
+{
+  double coordinatesA[5] = {1.0, 10.0, 100.0, 1000.0, 10000.0};
+  double coordinatesB[5] = {1.0, 20.0, 300.0, 4000.0, 50000.0};
+  Point p1(coordinatesA, coordinatesA + 5);
+  Point p2(coordinatesB, coordinatesB + 5);
+  Point p3(1.6, 6.0);
+  Point p4(1.0, 5.0);
+
+  EXPECT_EQ(p1[3], p1.coordinateUnchecked(3));
+  EXPECT_EQ(p1.ratioDistance(p2), p1.ratioDistanceUnchecked(p2));
+  EXPECT_EQ(p2.ratioDistance(p1), p2.ratioDistanceUnchecked(p1));
+  EXPECT_EQ(p3.ratioDistance(p4), p3.ratioDistanceUnchecked(p4));
+  EXPECT_EQ(p1.additiveDistance(p2), p1.additiveDistanceUnchecked(p2));
+  EXPECT_EQ(p2.additiveDistance(p1), p2.additiveDistanceUnchecked(p1));
+  EXPECT_EQ(p3.additiveDistance(p4), p3.additiveDistanceUnchecked(p4));
+
+  EXPECT_TRUE(p1.dominatesUnchecked(p2));
+  EXPECT_FALSE(p2.dominatesUnchecked(p1));
+  EXPECT_TRUE(p3.dominatesAdditiveUnchecked(p4, 1.0));
+  EXPECT_FALSE(p3.dominatesAdditiveUnchecked(p4, 0.5));
+  EXPECT_TRUE(p2.dominatesMultiplicativeUnchecked(p1, 4));
+  EXPECT_FALSE(p2.dominatesMultiplicativeUnchecked(p1, 3));
+  EXPECT_FALSE(p3.dominatesMultiplicativeUnchecked(p4, 0.5));
+}
+
+
 // Test that Point::str() works as expected.
 TEST_F(PointTest, PointStrWorks) 
 {
@@ -0,0 +1,82 @@
+/*! \file SphereFrontProblem.cpp
+ *  \brief Implementation of the SphereFrontProblem class, a simple 
+ *         synthetic problem class (of any dimension) used in 
+ *         BaseProblemTest.cpp.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <assert.h>
+#include <cmath>
+#include <iterator>
+
+#include "../Point.h"
+#include "SphereFrontProblem.h"
+
+
+using pareto_approximator::Point;
+
+
+namespace sphere_front_problem {
+
+
+static const double center = 2.0;
+
+
+SphereFrontProblem::SphereFrontProblem(unsigned int dimension) : 
+                                  numCombCalls(0), dimension_(dimension) { }
+
+
+SphereFrontProblem::~SphereFrontProblem() { }
+
+
+PointAndSolution<string> 
+SphereFrontProblem::comb(std::vector<double>::const_iterator first,
+                         std::vector<double>::const_iterator last) 
+{
+  assert(std::distance(first, last) == (long) dimension_);
+  ++numCombCalls;
+
+  double norm = 0.0;
+  for (std::vector<double>::const_iterator wi = first; wi != last; ++wi)
+    norm += (*wi) * (*wi);
+  norm = std::sqrt(norm);
+  assert(norm > 0.0);
+
+  std::vector<double> coordinates;
+  for (std::vector<double>::const_iterator wi = first; wi != last; ++wi)
+    coordinates.push_back(center - (*wi) / norm);
+
+  return PointAndSolution<string>(Point(coordinates.begin(), 
+                                        coordinates.end()), "sphere");
+}
+
+
+bool 
+SphereFrontProblem::isOnTheFront(const PointAndSolution<string> & p) const
+{
+  double distanceSquared = 0.0;
+  for (unsigned int i = 0; i != dimension_; ++i)
+    distanceSquared += (p.point[i] - center) * (p.point[i] - center);
+
+  return std::abs(distanceSquared - 1.0) < 1e-9;
+}
+
+
+double 
+SphereFrontProblem::optimalValue(const std::vector<double> & weights) const
+{
+  assert(weights.size() == dimension_);
+
+  double sum = 0.0, norm = 0.0;
+  for (unsigned int i = 0; i != dimension_; ++i) {
+    sum += weights[i];
+    norm += weights[i] * weights[i];
+  }
+
+  return center * sum - std::sqrt(norm);
+}
+
+
+}  // namespace sphere_front_problem
@@ -0,0 +1,61 @@
+/*! \file SphereFrontProblem.h
+ *  \brief Declaration of the SphereFrontProblem class, a simple synthetic 
+ *         problem class (of any dimension) used in BaseProblemTest.cpp.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#ifndef EXAMPLE_CLASS_SPHERE_FRONT_PROBLEM_H
+#define EXAMPLE_CLASS_SPHERE_FRONT_PROBLEM_H
+
+
+#include <string>
+#include <vector>
+
+#include "../PointAndSolution.h"
+#include "../BaseProblem.h"
+
+
+using std::string;
+
+using pareto_approximator::PointAndSolution;
+using pareto_approximator::BaseProblem;
+
+
+namespace sphere_front_problem {
+
+
+// A problem whose Pareto set is the lower part of the unit sphere centered 
+// at (2, 2, ..., 2), in any number of dimensions. (a smooth convex front, 
+// so PGEN has to refine it until it reaches the required eps)
+// - comb() returns the point of the sphere that minimizes the weighted 
+//   sum, i.e. center - w / |w|, and counts its calls.
+class SphereFrontProblem : public BaseProblem<string>
+{
+  public:
+    SphereFrontProblem(unsigned int dimension);
+    ~SphereFrontProblem();
+
+    PointAndSolution<string> comb(
+                        std::vector<double>::const_iterator first, 
+                        std::vector<double>::const_iterator last);
+
+    // Is "p" on the sphere?
+    bool isOnTheFront(const PointAndSolution<string> & p) const;
+
+    // The optimal value of the weighted sum for the given weights.
+    double optimalValue(const std::vector<double> & weights) const;
+
+    unsigned int numCombCalls;
+
+  private:
+    // problem dimension:
+    unsigned int dimension_;
+};
+
+
+}  // namespace sphere_front_problem
+
+
+#endif  // EXAMPLE_CLASS_SPHERE_FRONT_PROBLEM_H
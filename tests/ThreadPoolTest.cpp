@@ -0,0 +1,102 @@
+/*! \file ThreadPoolTest.cpp
+ *  \brief Unit test for the ThreadPool class.
+ *  \author Christos Nitsas
+ *  \date 2013
+ */
+
+
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "../ThreadPool.h"
+
+
+using pareto_approximator::ThreadPool;
+
+
+namespace {
+
+
+// The fixture for testing class ThreadPool.
+class ThreadPoolTest : public ::testing::Test 
+{
+  protected:
+    ThreadPoolTest() { }
+
+    ~ThreadPoolTest() { }
+
+    // Make numTasks tasks; task i adds i + 1 to sum.
+    std::vector<ThreadPool::Task> 
+    makeTasks(unsigned int numTasks, std::atomic<long> & sum)
+    {
+      std::vector<ThreadPool::Task> tasks;
+      for (unsigned int i = 0; i != numTasks; ++i)
+        tasks.push_back([i, &sum] () { sum += i + 1; });
+      return tasks;
+    }
+};
+
+
+// Test that run() runs every task exactly once (and waits for them).
+TEST_F(ThreadPoolTest, RunRunsEveryTaskOnce)
+{
+  unsigned int poolSizes[] = { 1, 2, 4, 8 };
+  for (unsigned int p = 0; p != 4; ++p) {
+    ThreadPool pool(poolSizes[p]);
+    EXPECT_EQ(poolSizes[p], pool.size());
+    for (unsigned int numTasks = 0; numTasks <= 100; numTasks += 25) {
+      std::atomic<long> sum(0);
+      std::vector<ThreadPool::Task> tasks = makeTasks(numTasks, sum);
+      pool.run(tasks);
+      EXPECT_EQ(numTasks * (numTasks + 1) / 2, sum);
+    }
+  }
+}
+
+
+// Test that run() rethrows exceptions thrown by tasks (after every 
+// other task has finished) and that the pool is still usable afterwards.
+TEST_F(ThreadPoolTest, RunRethrowsTaskExceptions)
+{
+  ThreadPool pool(4);
+  std::atomic<long> sum(0);
+  std::vector<ThreadPool::Task> tasks = makeTasks(10, sum);
+  tasks.push_back([] () { throw std::runtime_error("task failed"); });
+  EXPECT_THROW(pool.run(tasks), std::runtime_error);
+  EXPECT_EQ(55, sum);
+
+  sum = 0;
+  tasks = makeTasks(10, sum);
+  EXPECT_NO_THROW(pool.run(tasks));
+  EXPECT_EQ(55, sum);
+}
+
+
+// Test many back-to-back run() calls with tiny tasks. (each call's 
+// bookkeeping lives on run()'s stack, so the workers must be done with 
+// it before run() returns)
+TEST_F(ThreadPoolTest, RunSurvivesManyTinyTasks)
+{
+  ThreadPool pool(4);
+  for (unsigned int k = 0; k != 20000; ++k) {
+    std::atomic<long> sum(0);
+    unsigned int numTasks = 1 + k % 8;
+    std::vector<ThreadPool::Task> tasks = makeTasks(numTasks, sum);
+    pool.run(tasks);
+    ASSERT_EQ(numTasks * (numTasks + 1) / 2, sum);
+  }
+}
+
+
+}  // namespace
+
+
+// Run all tests
+int 
+main(int argc, char** argv) 
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
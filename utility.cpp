@@ -9,14 +9,16 @@
  */
 
 
-#include <iostream>
-#include <unistd.h>
-#include <sys/wait.h>
-#include <string>
 #include <assert.h>
-#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <utility>
 
 #include "NonDominatedSet.h"
+#include "ParetoFilter.h"
+#include "HullVertices.h"
+#include "ConvexHull.h"
 
 
 /*!
@@ -34,63 +36,6 @@ using pareto_approximator::PointAndSolution;
 using pareto_approximator::Facet;
 
 
-//! Make qconvex's input file. The given points will be the input.
-/*!
- *  \param points The points whose convex hull we need qconvex to compute
- *                for us.
- *  \param filename The name of the file we will create. (qconvex's input file)
- *  \param spaceDimension The dimension of the space that the points live in.
- *  
- *  \sa pareto_approximator::computeConvexHull() and 
- *      pareto_approximator::computeConvexHullFacets()
- */
-template <class S> 
-void 
-writePointsToQconvexInputFile(
-                  std::vector< PointAndSolution<S> > points, 
-                  std::string filename, unsigned int spaceDimension);
-
-
-/*!
- *  \brief Parse qconvex's output file and return a list of the convex 
- *         hull's facets.
- *  
- *  \param filename The name of the file we will parse. (qconvex's output file)
- *  \param points The points whose convex hull we asked qconvex to compute
- *                for us. Their order counts - it must be the same as their 
- *                order in qconvex's input file.
- *  \param spaceDimension The dimension of the space that the points live in.
- *  \return A list of the convex hull's facets.
- *  
- *  \sa pareto_approximator::computeConvexHullFacets()
- */
-template <class S> 
-std::list< Facet<S> > 
-readFacetsFromQconvexOutputFile(std::string filename, 
-                    std::vector< PointAndSolution<S> > points, 
-                    unsigned int spaceDimension);
-
-
-/*!
- *  \brief Parse qconvex's output file and return a vector of the convex 
- *         hull's extreme points..
- *  
- *  \param filename The name of the file we will parse. (qconvex's output file)
- *  \param points The points (PointAndSolution<S> objects) whose convex hull 
- *                we asked qconvex to compute for us. Their order counts - it 
- *                must be the same as their order in qconvex's input file.
- *  \return A vector of the convex hull's extreme points (PointAndSolution<S> 
- *          objects).
- *  
- *  \sa pareto_approximator::computeConvexHull()
- */
-template <class S> 
-std::list< PointAndSolution<S> > 
-readExtremePointsFromQconvexOutputFile(
-                            std::string filename, 
-                            std::vector< PointAndSolution<S> > points);
-
-
 //! Normalizes a vector of double. (in place)
 /*!
  *  \param v A vector (as a std::vector<double>).
@@ -116,108 +61,69 @@ namespace pareto_approximator {
 namespace utility {
 
 
+//! Make a Facet<S> instance out of a facet of a ConvexHull instance.
+/*!
+ *  \param hullFacet A facet of a ConvexHull instance.
+ *  \param points The points that were added to the ConvexHull instance, 
+ *                in the order they were added.
+ *  \return The facet as a Facet<S> instance. (its normal vector faces 
+ *          inwards)
+ *  
+ *  The facet's local approximation error upper bound is computed by the 
+ *  Facet<S> constructor.
+ *  
+ *  \sa ConvexHull, computeConvexHullFacets() and BaseProblem::doPgen()
+ */
+template <class S> 
+Facet<S> 
+makeFacet(const ConvexHull::HullFacet & hullFacet, 
+          const std::vector< PointAndSolution<S> > & points)
+{
+  typename Facet<S>::VerticesVector vertices;
+  for (unsigned int k = 0; k != hullFacet.vertices.size(); ++k)
+    vertices.push_back(points[hullFacet.vertices[k]]);
+  // - ConvexHull's normal vectors face outwards (from the convex hull)
+  //   but ours face inwards so we will reverse each normal vector's sign
+  std::vector<double> facetNormal(hullFacet.normal);
+  for (unsigned int j = 0; j != facetNormal.size(); ++j)
+    facetNormal[j] = - facetNormal[j];
+
+  return Facet<S>(vertices.begin(), vertices.end(), 
+                  facetNormal.begin(), facetNormal.end());
+}
+
+
 //! Compute the facets of the convex hull of the given set of points.
 /*!
  *  \param points A (const reference to a) std::vector of points. 
  *                (PointAndSolution<S> instances)
  *  \param spaceDimension The dimension of the space that the points live in.
  *  \return A list containing all the facets (Facet<S> instances) of the 
- *          convex hull.
+ *          convex hull. (empty if the points do not span the space, i.e. 
+ *          if there are no d + 1 affinely independent points)
  *  
- *  This function requires that the external program/tool qconvex, 
- *  distributed with qhull (see www.qhull.org) be installed on the system 
- *  (and be on the PATH).
+ *  The hull is computed in-process by a ConvexHull instance. Each facet 
+ *  is a simplex (flat faces are split into coplanar simplicial facets) 
+ *  and its normal vector faces inwards.
  *  
- *  This function currently only works for Unix-like systems, it won't 
- *  work on Windows. It has only been tested on Mac OS X Mountain Lion 
- *  but should work on other Unix-like systems as well.
+ *  Safe to call from several threads at once.
  *  
- *  \sa BaseProblem::doPgen()
+ *  \sa ConvexHull and BaseProblem::doPgen()
  */
 template <class S> 
 std::list< Facet<S> > 
 computeConvexHullFacets(const std::vector< PointAndSolution<S> > & points, 
                         unsigned int spaceDimension)
 {
-  // The files we'll use to interface with qconvex.
-  std::string qconvexInputFilename = "qconvex-input.txt";
-  std::string qconvexOutputFilename = "qconvex-output.txt";
-
-  // First make qconvex's input file:
-  writePointsToQconvexInputFile(points, qconvexInputFilename, spaceDimension);
+  ConvexHull hull(spaceDimension);
+  for (unsigned int i = 0; i != points.size(); ++i)
+    hull.addPoint(points[i].point);
 
   std::list< Facet<S> > facets;
+  const std::vector<ConvexHull::HullFacet> & hullFacets = hull.getFacets();
+  for (unsigned int f = 0; f != hullFacets.size(); ++f)
+    facets.push_back(makeFacet<S>(hullFacets[f], points));
 
-  // Make a subprocess (child) that will exec qconvex to compute 
-  // the convex hull:
-  pid_t pid = fork();
-  if (pid < 0) {
-    // could not fork()
-    std::cerr << "Failed to fork... Exiting" << std::endl;
-    exit(-1);
-  }
-  else if (pid == 0) {
-    // child process 
-    // run qconvex (input: qconvex-input.txt, output: qconvex-output.txt)
-    int rv = execlp("qconvex", "qconvex", "i", "n", "Qt", 
-                    "PF0.000000000000000000000001", 
-                    "TI", "qconvex-input.txt", 
-                    "TO", "qconvex-output.txt", NULL);
-    // Added option "PFn" where n is a lower bound for the area of 
-    // facets to be printed (facets with area < n will not be printed) to 
-    // avoid degenerate facets with zero area.
-    // - e.g. "PF0.000000000000000000000001" will not print facets with 
-    //   area less than 0.000000000000000000001
-    // - degenerate facets with zero area might appear due to option "Qt"
-    //   (how come? all the vertices might belong to the same ridge 
-    //   of the original non simplicial facet)
-
-    if (rv == -1) {
-      std::cerr << "An error occured while trying to call qconvex... Exiting" 
-                << std::endl;
-      exit(-1);
-    }
-
-    // Code will have ended by here. 
-    // - Either via qconvex exiting without error or the exit(-1) in case a 
-    //   qconvex error occurs. 
-    // - Won't reach the return statement.
-  }
-  else {
-    // parent process
-    int childStatus;
-    waitpid(pid, &childStatus, 0);
-    if ( not WIFEXITED(childStatus) ) {
-      if ( WIFSIGNALED(childStatus) ) {
-        std::cerr << "ERROR: qconvex got a signal that caused it to exit (" 
-                  << WTERMSIG(childStatus) << "). Exiting" << std::endl;
-        exit(-1);
-      }
-      else {
-        std::cerr << "ERROR: qconvex did not exit normally. Exiting"
-                  << std::endl;
-        exit(-1);
-      }
-    }
-    else if ( WEXITSTATUS(childStatus) != 0 ) {
-      std::cerr << "ERROR: qconvex exited with errorcode: " 
-                << WEXITSTATUS(childStatus) << std::endl
-                << "Exiting" << std::endl;
-      exit(-1);
-    }
-    else {
-      // parse qconvex's output file (qconvex-output.txt) and make the facets
-      facets = readFacetsFromQconvexOutputFile(qconvexOutputFilename, 
-                                               points, 
-                                               spaceDimension);
-      // return the facets outside the ifs (to avoid compiler warnings 
-      // about reaching the end of non-void function)
-    }
-  }
-
-  // Only the parent will get here and only after succesfully reading 
-  // the facets from qconvex's output file. (qconvex will have exited 
-  // without error as well)
   return facets;
 }
 
@@ -227,119 +133,61 @@ computeConvexHullFacets(const std::vector< PointAndSolution<S> > & points,
  *  \param points A (const reference to a) std::vector of points. 
  *                (PointAndSolution<S> instances)
  *  \param spaceDimension The dimension of the space that the points live in.
- *  \return A vector containing all the extreme points (PointAndSolution<S> 
- *          instances) of the convex hull.
+ *  \return A list containing all the extreme points (PointAndSolution<S> 
+ *          instances) of the convex hull. (sorted)
  *  
- *  We need at least #(spaceDimension+1) points to compute a convex hull.
- *  If "points" contains less than #(spaceDimension+1) points we will 
- *  this function will just return the given set of points ("points") as 
- *  the result.
- *
- *  This function requires that the external program/tool qconvex, 
- *  distributed with qhull (see www.qhull.org) be installed on the system 
- *  (and be on the PATH).
+ *  We need at least #(spaceDimension+1) affinely independent points to 
+ *  compute a convex hull. If "points" does not contain that many this 
+ *  function will just return the given set of points ("points") as the 
+ *  result.
  *  
- *  This function currently only works for Unix-like systems, it won't 
- *  work on Windows. It has only been tested on Mac OS X Mountain Lion 
- *  but should work on other Unix-like systems as well.
+ *  The hull is computed in-process, by findConvexHullVertices() in two 
+ *  or three dimensions and by a ConvexHull instance otherwise. Safe to 
+ *  call from several threads at once.
  *  
- *  \sa BaseProblem::doPgen()
+ *  \sa findConvexHullVertices(), ConvexHull and BaseProblem::doPgen()
  */
 template <class S> 
 std::list< PointAndSolution<S> > 
 computeConvexHull(const std::vector< PointAndSolution<S> > & points, 
                   unsigned int spaceDimension)
 {
-  // The files we'll use to interface with qconvex.
-  std::string qconvexInputFilename = "qconvex-input.txt";
-  std::string qconvexOutputFilename = "qconvex-output.txt";
-
   std::list< PointAndSolution<S> > extremePoints;
 
-  // we need at least #(spaceDimension+1) points to compute a convex hull
-  if (points.size() <= spaceDimension) {
-    // no need to continue, all points in "points" are on the lower envelope
-    extremePoints.assign(points.begin(), points.end());
+  if (spaceDimension == 2 or spaceDimension == 3) {
+    std::vector<double> coordinates;
+    coordinates.reserve(points.size() * spaceDimension);
+    for (unsigned int k = 0; k != points.size(); ++k)
+      for (unsigned int i = 0; i != spaceDimension; ++i)
+        coordinates.push_back(points[k].point[i]);
+
+    // (all the indices if the points do not span the space)
+    std::vector<unsigned int> indices;
+    indices = findConvexHullVertices(coordinates, spaceDimension);
+    for (unsigned int i = 0; i != indices.size(); ++i)
+      extremePoints.push_back(points[indices[i]]);
+
     extremePoints.sort();
     return extremePoints;
   }
   // else
 
-  // First make qconvex's input file:
-  writePointsToQconvexInputFile(points, qconvexInputFilename, spaceDimension);
-
-  // Make a subprocess (child) that will exec qconvex to compute 
-  // the convex hull:
-  pid_t pid = fork();
-  unsigned int retries = 10;
-  while ( (pid < 0) && (retries > 0) ) {
-    // could not fork()
-    --retries;
-    std::cerr << "Failed to fork (probably due to low memory)... Will retry in 30 seconds. " << retries << " retries left." << std::endl;
-    sleep(30);
-    pid = fork();
-  }
+  ConvexHull hull(spaceDimension);
+  for (unsigned int i = 0; i != points.size(); ++i)
+    hull.addPoint(points[i].point);
 
-  if (retries == 0) {
-    std::cerr << "Failed to fork... Exiting" << std::endl;
-    exit(-1);
+  if (not hull.isFullDimensional()) {
+    // no need to continue, all points in "points" are on the lower envelope
+    extremePoints.assign(points.begin(), points.end());
+    extremePoints.sort();
+    return extremePoints;
   }
+  // else
 
-  if (pid == 0) {
-    // child process 
-    // run qconvex (input: qconvex-input.txt, output: qconvex-output.txt)
-    int rv = execlp("qconvex", "qconvex", "Fx", "TI", "qconvex-input.txt", 
-                    "TO", "qconvex-output.txt", NULL);
-    // Used option "Fx" which only prints the (indices of the) extreme 
-    // points of the convex hull.
-
-    if (rv == -1) {
-      std::cerr << "An error occured while trying to call qconvex... Exiting" 
-                << std::endl;
-      exit(-1);
-    }
+  std::vector<unsigned int> indices = hull.getExtremePointIndices();
+  for (unsigned int i = 0; i != indices.size(); ++i)
+    extremePoints.push_back(points[indices[i]]);
 
-    // Code will have ended by here. 
-    // - Either via qconvex exiting without error or the exit(-1) in case a 
-    //   qconvex error occurs. 
-    // - Won't reach the return statement.
-  }
-  else {
-    // parent process
-    int childStatus;
-    waitpid(pid, &childStatus, 0);
-    if ( not WIFEXITED(childStatus) ) {
-      if ( WIFSIGNALED(childStatus) ) {
-        std::cerr << "ERROR: qconvex got a signal that caused it to exit (" 
-                  << WTERMSIG(childStatus) << "). Exiting" << std::endl;
-        exit(-1);
-      }
-      else {
-        std::cerr << "ERROR: qconvex did not exit normally. Exiting"
-                  << std::endl;
-        exit(-1);
-      }
-    }
-    else if ( WEXITSTATUS(childStatus) != 0 ) {
-      std::cerr << "ERROR: qconvex exited with errorcode: " 
-                << WEXITSTATUS(childStatus) << std::endl
-                << "Exiting" << std::endl;
-      exit(-1);
-    }
-    else {
-      // parse qconvex's output file (qconvex-output.txt) and 
-      // get the convex hull's extreme points
-      extremePoints = readExtremePointsFromQconvexOutputFile(
-                                               qconvexOutputFilename, 
-                                               points);
-      // return the extreme points outside the ifs (to avoid compiler 
-      // warnings // about reaching the end of non-void function)
-    }
-  }
-
-  // Only the parent will get here and only after succesfully reading 
-  // the extreme points from qconvex's output file. (qconvex will have 
-  // exited without error as well)
   extremePoints.sort();
   return extremePoints;
 }
@@ -353,7 +201,8 @@ computeConvexHull(const std::vector< PointAndSolution<S> > & points,
  *  \param last An iterator to the past-the-end element in the sequence.
  *  
  *  We will use a pareto_approximator::NonDominatedSet to discard dominated 
- *  points.
+ *  points. (large sequences are filtered in O(n log n) time, see 
+ *  NonDominatedSet's iteration constructor)
  *  
  *  \sa NonDominatedSet
  */
@@ -368,6 +217,65 @@ filterDominatedPoints(
 }
 
 
+/*!
+ *  \brief Filter a sequence of PointAndSolution instances and return 
+ *         only the non-dominated ones, using several threads.
+ *
+ *  \param first An iterator to the first element in the sequence.
+ *  \param last An iterator to the past-the-end element in the sequence.
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  
+ *  Returns exactly what the two-argument filterDominatedPoints() returns, 
+ *  whatever the number of threads. (see the three-argument 
+ *  pareto_approximator::findNonDominatedPoints())
+ *  
+ *  Possible exceptions:
+ *  - May throw a NullObjectException exception if some instance is null.
+ *  - May throw a DifferentDimensionsException exception if the points 
+ *    are not all of the same dimension.
+ *  - May throw a NotPositivePointException exception if some point is 
+ *    not positive.
+ *  
+ *  \sa findNonDominatedPoints() and NonDominatedSet
+ */
+template <class S> 
+std::vector< PointAndSolution<S> > 
+filterDominatedPoints(
+      typename std::vector< PointAndSolution<S> >::const_iterator first, 
+      typename std::vector< PointAndSolution<S> >::const_iterator last, 
+      unsigned int numThreads)
+{
+  typedef NonDominatedSetPoint< PointAndSolution<S> > ElementPoint;
+
+  if (first == last)
+    return std::vector< PointAndSolution<S> >();
+  // else
+
+  const unsigned int dimension = ElementPoint::point(*first).dimension();
+  std::vector<double> coordinates;
+  coordinates.reserve(dimension * (last - first));
+  typename std::vector< PointAndSolution<S> >::const_iterator it;
+  for (it = first; it != last; ++it) {
+    if (ElementPoint::point(*it).dimension() != dimension)
+      throw exception_classes::DifferentDimensionsException();
+    ElementPoint::checkQuery(*it);
+    for (unsigned int i = 0; i != dimension; ++i)
+      coordinates.push_back(it->point[i]);
+  }
+
+  std::vector<unsigned int> nonDominated = 
+        findNonDominatedPoints(coordinates, dimension, numThreads);
+  std::vector< PointAndSolution<S> > result;
+  result.reserve(nonDominated.size());
+  for (unsigned int k = 0; k != nonDominated.size(); ++k)
+    result.push_back(first[nonDominated[k]]);
+  // (in the same order as the NonDominatedSet would have them)
+  std::sort(result.begin(), result.end());
+
+  return result;
+}
+
+
 //! Discard facets not useful for generating new Pareto points.
 /*!
  *  \param facets A (reference to a) list of facets.
@@ -443,6 +351,30 @@ chooseFacetWithLargestLocalApproximationErrorUpperBound(
 }
 
 
+//! Does facet "a" have a smaller bound than facet "b"?
+/*!
+ *  \param a A Facet instance.
+ *  \param b A Facet instance.
+ *  \return true if "a" is a boundary facet and "b" is not, or if neither 
+ *          is a boundary facet and "a" has a smaller local approximation 
+ *          error upper bound than "b"; false otherwise.
+ *  
+ *  \sa FacetHasSmallerLocalApproximationErrorUpperBound
+ */
+template <class S> 
+bool 
+FacetHasSmallerLocalApproximationErrorUpperBound<S>::operator()(
+                              const Facet<S> & a, const Facet<S> & b) const
+{
+  if (a.isBoundaryFacet() or b.isBoundaryFacet())
+    return a.isBoundaryFacet() and not b.isBoundaryFacet();
+  // else
+
+  return a.getLocalApproximationErrorUpperBound() < 
+         b.getLocalApproximationErrorUpperBound();
+}
+
+
 /*! \brief Choose a boundary Facet instance with the smallest angle
  *         from the given sequence of Facet instances.
  *  
@@ -491,6 +423,9 @@ chooseBoundaryFacetWithSmallestAngle(
  *  The resulting weights will be:
  *  - Either the facet's normal vector. (normalized)
  *    (if it has no negative elements)
+ *  - Or the facet's normal vector with its negative elements set to 
+ *    zero. (normalized) (if it is not a boundary facet, see 
+ *    Facet::isBoundaryFacet())
  *  - Or the mean of the weights used to obtain the facet's vertices. 
  *    (normalized)
  *  
@@ -507,6 +442,14 @@ generateNewWeightVector(const Facet<S> & facet)
     // Use the facet's normal vector (i.e. the facet's slope) as weights.
     weights = facet.getNormalVector();
   }
+  else if (not facet.isBoundaryFacet()) {
+    // Use the facet's normal vector with its negative elements set to 
+    // zero as weights. (the non-negative weights closest to the facet's 
+    // slope)
+    weights = facet.getNormalVector();
+    for (unsigned int i = 0; i != weights.size(); ++i)
+      weights[i] = std::max(weights[i], 0.0);
+  }
   else {
     // Use the mean of the facet's vertex weights (weightsUsed) as weights.
     // - "weights" will be a std::vector<double> of weights W_{i}, where:
@@ -521,218 +464,81 @@ generateNewWeightVector(const Facet<S> & facet)
 }
 
 
-}  // namespace utility
-
-
-}  // namespace pareto_approximator
-
-
-// An unnamed namespace containing helper functions. (implementations here)
-// (declarations at the beginning of this file)
-namespace {
-
-
-//! Make qconvex's input file. The given points will be the input.
+//! Generate the weight vectors of the "strips" along a 3D hull's edges.
 /*!
- *  \param points The points whose convex hull we need qconvex to compute
- *                for us.
- *  \param filename The name of the file we will create. (qconvex's input file)
- *  \param spaceDimension The dimension of the space that the points live in.
+ *  \param hull A three dimensional ConvexHull instance.
+ *  \param points The points that were added to the ConvexHull instance, 
+ *                in the order they were added.
+ *  \return A std::vector of (normalized, non-negative) weight vectors.
  *  
- *  \sa pareto_approximator::computeConvexHull() and 
- *      pareto_approximator::computeConvexHullFacets()
- */
-template <class S> 
-void 
-writePointsToQconvexInputFile(
-                  std::vector< PointAndSolution<S> > points, 
-                  std::string filename, unsigned int spaceDimension)
-{
-  // qcif stands for "QConvex's Input File"
-  std::ofstream qcif(filename.c_str(), std::ios::out | std::ios::trunc);
-
-  if (not qcif.is_open()) {
-    std::cerr << "An error occured while opening file \"" << filename 
-              << "\" for output... Exiting" << std::endl;
-    exit(-1);
-  }
-  // else 
-
-  // make qconvex's input file
-  qcif << spaceDimension << "\n";
-  qcif << points.size() << "\n";
-  typename std::vector< PointAndSolution<S> >::iterator pit;
-  for (pit = points.begin(); pit != points.end(); ++pit)
-    qcif << pit->point << "\n";
-
-  qcif.close();
-}
-
-
-/*!
- *  \brief Parse qconvex's output file and return a list of the convex 
- *         hull's facets.
- *  
- *  \param filename The name of the file we will parse. (qconvex's output file)
- *  \param points The points whose convex hull we asked qconvex to compute
- *                for us. Their order counts - it must be the same as their 
- *                order in qconvex's input file.
- *  \param spaceDimension The dimension of the space that the points live in.
- *  \return A list of the convex hull's facets.
+ *  The strip along edge [a, b] and axis e_j has normal vector 
+ *  (b - a) x e_j, i.e. (with d = b - a and k, l the other two axes) 
+ *  zero in position j and d_l, -d_k (up to sign) in positions k and l. 
+ *  It is a weight vector only if d_k and d_l do not have the same sign.
  *  
- *  \sa pareto_approximator::computeConvexHullFacets()
+ *  \sa ConvexHull, generateNewWeightVector() and BaseProblem::doPgen()
  */
 template <class S> 
-std::list< Facet<S> > 
-readFacetsFromQconvexOutputFile(std::string filename, 
-                    std::vector< PointAndSolution<S> > points, 
-                    unsigned int spaceDimension)
+std::vector< std::vector<double> > 
+generateEdgeWeightVectors(const ConvexHull & hull, 
+                          const std::vector< PointAndSolution<S> > & points)
 {
-  std::list< Facet<S> > facets;
-
-  // qcof stands for "QConvex's Output File"
-  std::ifstream qcof(filename.c_str());
-
-  if (not qcof.is_open()) {
-    std::cerr << "An error occured while opening file \"" << filename
-              << "\" for input... Exiting" << std::endl;
-    exit(-1);
-  }
-  // else
-
-  // start parsing qconvex's output file
-  unsigned int numFacets, i, j, vertexIndex;
-  qcof >> numFacets;
-
-  if (numFacets == 0)
-    // nothing else to read
-    return facets;
-  
-  // first read each facet's vertices
-  std::vector< typename Facet<S>::VerticesVector > vertexSets(numFacets);
-  for (i = 0; i != numFacets; ++i) {
-    for (j = 0; j != spaceDimension; ++j) {
-      qcof >> vertexIndex;
-      // Make sure that the vertex index is a valid index.
-      // - If the vertex index is greater than all valid indices it means 
-      //   that qconvex encountered a non-simplicial facet and we had not 
-      //   told qconvex to triangulate such facets.
-      // - We call a facet in a d-dimensional space non-simplicial when it 
-      //   consists of more than d vertices.
-      // - Triangulating a non-simplicial facet with v vertices that lives 
-      //   in a d-dimensional space (v > d) is the process of splitting the 
-      //   (non-simplicial) facet into a set of coplanar simplicial facets.
-      //   (each of the resulting simplicial facets will have d vertices and 
-      //   they will all have the same normal vector)
-      // - qconvex should triangulate non-simplicial facets if we give it 
-      //   the "Qt" option (along with the "i" option) when calling it.
-      // - Not sure (yet) if qconvex may encounter non-simplicial facets 
-      //   in this use case i.e. convex hull of points belonging to a 
-      //   Pareto set. (this only applies to the case when the given set of 
-      //   points only contains Pareto optimal points)
-      assert(vertexIndex < points.size());
-      vertexSets[i].push_back(points[vertexIndex]);
+  assert(hull.spaceDimension() == 3);
+
+  // The edges of the facets whose normal vectors have negative elements. 
+  // (ConvexHull's normal vectors face outwards, i.e. we are looking for 
+  // positive elements)
+  std::set< std::pair<unsigned int, unsigned int> > edges;
+  const std::vector<ConvexHull::HullFacet> & hullFacets = hull.getFacets();
+  for (unsigned int f = 0; f != hullFacets.size(); ++f) {
+    const std::vector<double> & normal = hullFacets[f].normal;
+    if (*std::max_element(normal.begin(), normal.end()) <= 0.0)
+      continue;
+    // else
+
+    const std::vector<unsigned int> & vertices = hullFacets[f].vertices;
+    for (unsigned int i = 0; i != vertices.size(); ++i) {
+      unsigned int u = vertices[i];
+      unsigned int v = vertices[(i + 1) % vertices.size()];
+      edges.insert(std::make_pair(std::min(u, v), std::max(u, v)));
     }
   }
 
-  unsigned int temp;
-  // consume (read) the next line 
-  // - contains the facet normal vector size + 1
-  qcof >> temp;
-  assert(temp == spaceDimension + 1);
-
-  unsigned int numOfNormalVectors;
-  // consume (read) the next line
-  // - contains the number of normal vectors (number of facets)
-  qcof >> numOfNormalVectors;
-  assert(numOfNormalVectors == numFacets);
-
-  // now read each facet's normal vector and make the Facet instance
-  // - qconvex facet's normal vectors face outwards (from the convex hull)
-  //   but ours face inwards so we will reverse each normal vector's sign
-  double normalVectorElement, facetOffset;
-  for (i = 0; i != numFacets; ++i) {
-    std::vector<double> facetNormal(spaceDimension);
-    for (j = 0; j != spaceDimension; ++j) {
-      qcof >> normalVectorElement;
-      facetNormal[j] = - normalVectorElement;
+  std::vector< std::vector<double> > weightVectors;
+  std::set< std::pair<unsigned int, unsigned int> >::const_iterator ei;
+  for (ei = edges.begin(); ei != edges.end(); ++ei) {
+    const Point & a = points[ei->first].point;
+    const Point & b = points[ei->second].point;
+    for (unsigned int j = 0; j != 3; ++j) {
+      unsigned int k = (j + 1) % 3;
+      unsigned int l = (j + 2) % 3;
+      double dk = b[k] - a[k];
+      double dl = b[l] - a[l];
+      if (dk * dl > 0.0 or (dk == 0.0 and dl == 0.0))
+        continue;
+      // else
+
+      std::vector<double> weights(3, 0.0);
+      weights[k] = std::abs(dl);
+      weights[l] = std::abs(dk);
+      normalizeVector(weights);
+      weightVectors.push_back(weights);
     }
-    // consume the next number (it's the facet offset - we don't need it)
-    qcof >> facetOffset;
-    // make the facet and push it onto the list of facets
-    facets.push_back(Facet<S>(vertexSets[i].begin(), vertexSets[i].end(), 
-                              facetNormal.begin(), facetNormal.end()));
   }
 
-  // We should be at the end of the file. Make sure:
-  double consume = 0.0;
-  qcof >> consume;
-  assert(qcof.eof());
-
-  // Close the file and return the list of facets:
-  qcof.close();
-
-  return facets;
+  return weightVectors;
 }
 
 
-/*!
- *  \brief Parse qconvex's output file and return a vector of the convex 
- *         hull's extreme points..
- *  
- *  \param filename The name of the file we will parse. (qconvex's output file)
- *  \param points The points (PointAndSolution<S> objects) whose convex hull 
- *                we asked qconvex to compute for us. Their order counts - it 
- *                must be the same as their order in qconvex's input file.
- *  \return A vector of the convex hull's extreme points (PointAndSolution<S> 
- *          objects).
- *  
- *  \sa pareto_approximator::computeConvexHull()
- */
-template <class S> 
-std::list< PointAndSolution<S> > 
-readExtremePointsFromQconvexOutputFile(
-                            std::string filename, 
-                            std::vector< PointAndSolution<S> > points)
-{
-  std::list< PointAndSolution<S> > extremePoints;
-
-  // qcof stands for "QConvex's Output File"
-  std::ifstream qcof(filename.c_str());
-
-  if (not qcof.is_open()) {
-    std::cerr << "An error occured while opening file \"" << filename
-              << "\" for input... Exiting" << std::endl;
-    exit(-1);
-  }
-  // else
-
-  // start parsing qconvex's output file
-  unsigned int numExtremePoints, i, vertexIndex;
-  qcof >> numExtremePoints;
+}  // namespace utility
 
-  if (numExtremePoints == 0)
-    // nothing else to read
-    return extremePoints;
-  // else 
 
-  // read the (indices of the) extreme points
-  for (i = 0; i != numExtremePoints; ++i) {
-    qcof >> vertexIndex;
-    assert(vertexIndex < points.size());
-    extremePoints.push_back(points[vertexIndex]);
-  }
-
-  // We should be at the end of the file. Make sure:
-  double consume = 0.0;
-  qcof >> consume;
-  assert(qcof.eof());
+}  // namespace pareto_approximator
 
-  // Close the file and return the list of facets:
-  qcof.close();
 
-  return extremePoints;
-}
+// An unnamed namespace containing helper functions. (implementations here)
+// (declarations at the beginning of this file)
+namespace {
 
 
 //! Normalizes a vector of double. (in place)
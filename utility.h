@@ -14,6 +14,7 @@
 #include "Point.h"
 #include "PointAndSolution.h"
 #include "Facet.h"
+#include "ConvexHull.h"
 
 
 /*!
@@ -33,23 +34,35 @@ namespace pareto_approximator {
 namespace utility {
 
 
+//! Make a Facet<S> instance out of a facet of a ConvexHull instance.
+/*!
+ *  \param hullFacet A facet of a ConvexHull instance.
+ *  \param points The points that were added to the ConvexHull instance, 
+ *                in the order they were added.
+ *  \return The facet as a Facet<S> instance. (its normal vector faces 
+ *          inwards)
+ *  
+ *  \sa ConvexHull, computeConvexHullFacets() and BaseProblem::doPgen()
+ */
+template <class S> 
+Facet<S> 
+makeFacet(const ConvexHull::HullFacet & hullFacet, 
+          const std::vector< PointAndSolution<S> > & points);
+
+
 //! Compute the facets of the convex hull of the given set of points.
 /*!
  *  \param points A (const reference to a) std::vector of points. 
  *                (PointAndSolution<S> instances)
  *  \param spaceDimension The dimension of the space that the points live in.
  *  \return A list containing all the facets (Facet<S> instances) of the 
- *          convex hull.
- *  
- *  This function requires that the external program/tool qconvex, 
- *  distributed with qhull (see www.qhull.org) be installed on the system 
- *  (and be on the PATH).
+ *          convex hull. (empty if the points do not span the space)
  *  
- *  This function currently only works for Unix-like systems, it won't 
- *  work on Windows. It has only been tested on Mac OS X Mountain Lion 
- *  but should work on other Unix-like systems as well.
+ *  The hull is computed in-process by a ConvexHull instance, i.e. no 
+ *  external program and no temporary files. Safe to call from several 
+ *  threads at once.
  *  
- *  \sa BaseProblem::doPgen()
+ *  \sa ConvexHull and BaseProblem::doPgen()
  */
 template <class S> 
 typename std::list< Facet<S> > 
@@ -65,15 +78,12 @@ computeConvexHullFacets(const std::vector< PointAndSolution<S> > & points,
  *  \return A vector containing all the extreme points (PointAndSolution<S> 
  *          instances) of the convex hull.
  *  
- *  This function requires that the external program/tool qconvex, 
- *  distributed with qhull (see www.qhull.org) be installed on the system 
- *  (and be on the PATH).
- *  
- *  This function currently only works for Unix-like systems, it won't 
- *  work on Windows. It has only been tested on Mac OS X Mountain Lion 
- *  but should work on other Unix-like systems as well.
+ *  The hull is computed in-process (by findConvexHullVertices() in two 
+ *  or three dimensions, by a ConvexHull instance otherwise), i.e. no 
+ *  external program and no temporary files. Safe to call from several 
+ *  threads at once.
  *  
- *  \sa BaseProblem::doPgen()
+ *  \sa findConvexHullVertices(), ConvexHull and BaseProblem::doPgen()
  */
 template <class S> 
 typename std::list< PointAndSolution<S> > 
@@ -89,7 +99,8 @@ computeConvexHull(const std::vector< PointAndSolution<S> > & points,
  *  \param last An iterator to the past-the-end element in the sequence.
  *  
  *  We will use a pareto_approximator::NonDominatedSet to discard dominated 
- *  points.
+ *  points. (large sequences are filtered in O(n log n) time, see 
+ *  NonDominatedSet's iteration constructor)
  *  
  *  \sa NonDominatedSet
  */
@@ -100,6 +111,28 @@ filterDominatedPoints(
         typename std::vector< PointAndSolution<S> >::const_iterator last);
 
 
+/*!
+ *  \brief Filter a sequence of PointAndSolution instances and return 
+ *         only the non-dominated ones, using several threads.
+ *
+ *  \param first An iterator to the first element in the sequence.
+ *  \param last An iterator to the past-the-end element in the sequence.
+ *  \param numThreads The number of threads to use. (at least 1)
+ *  
+ *  Returns exactly what the two-argument filterDominatedPoints() returns, 
+ *  whatever the number of threads. (see the three-argument 
+ *  pareto_approximator::findNonDominatedPoints())
+ *  
+ *  \sa findNonDominatedPoints() and NonDominatedSet
+ */
+template <class S> 
+std::vector< PointAndSolution<S> > 
+filterDominatedPoints(
+        typename std::vector< PointAndSolution<S> >::const_iterator first, 
+        typename std::vector< PointAndSolution<S> >::const_iterator last, 
+        unsigned int numThreads);
+
+
 //! Discard facets not useful for generating new Pareto points.
 /*!
  *  \param facets A (reference to a) list of facets.
@@ -145,6 +178,27 @@ chooseFacetWithLargestLocalApproximationErrorUpperBound(
                     typename std::list< Facet<S> >::iterator last);
 
 
+//! Compare two facets by their local approximation error upper bounds.
+/*!
+ *  A less-than functor, e.g. a std::priority_queue of Facet<S> instances 
+ *  that uses it keeps the facet with the largest local approximation 
+ *  error upper bound on top.
+ *  
+ *  Boundary facets (i.e. those with isBoundaryFacet() == true) count as 
+ *  smaller than every non-boundary facet.
+ *  
+ *  \sa Facet, Facet::getLocalApproximationErrorUpperBound() and 
+ *      BaseProblem::doChord()
+ */
+template <class S> 
+class FacetHasSmallerLocalApproximationErrorUpperBound
+{
+  public:
+    //! Does facet "a" have a smaller bound than facet "b"?
+    bool operator()(const Facet<S> & a, const Facet<S> & b) const;
+};
+
+
 /*! \brief Choose a boundary Facet instance with the smallest angle
  *         from the given sequence of Facet instances.
  *  
@@ -179,6 +233,8 @@ chooseBoundaryFacetWithSmallestAngle(
  *  The resulting weights will be:
  *  - Either the facet's normal vector. 
  *    (if it has no negative elements)
+ *  - Or the facet's normal vector with its negative elements set to 
+ *    zero. (if it is not a boundary facet, see Facet::isBoundaryFacet())
  *  - Or the mean of the weights used to obtain the facet's vertices.
  *  
  *  \sa BaseProblem, BaseProblem::comb() and 
@@ -189,6 +245,33 @@ std::vector<double>
 generateNewWeightVector(const Facet<S> & facet);
 
 
+//! Generate the weight vectors of the "strips" along a 3D hull's edges.
+/*!
+ *  \param hull A three dimensional ConvexHull instance.
+ *  \param points The points that were added to the ConvexHull instance, 
+ *                in the order they were added.
+ *  \return A std::vector of (normalized, non-negative) weight vectors.
+ *  
+ *  The set of points dominated by the hull's points' convex hull is 
+ *  bounded by the hull's facets with non-negative normal vectors and by 
+ *  "strips" made of an edge [a, b] and a coordinate axis e_j, with 
+ *  normal vector (b - a) x e_j. We only need the edges of facets whose 
+ *  normal vectors have negative elements; the rest of the strips lie 
+ *  between facets with non-negative normal vectors.
+ *  
+ *  If comb() gives no new point for any of these weight vectors (or for 
+ *  the facets with non-negative normal vectors) there is no Pareto point 
+ *  outside the dominated set, i.e. the points are all the vertices of 
+ *  the lower convex envelope of the Pareto set.
+ *  
+ *  \sa ConvexHull, generateNewWeightVector() and BaseProblem::doPgen()
+ */
+template <class S> 
+std::vector< std::vector<double> > 
+generateEdgeWeightVectors(const ConvexHull & hull, 
+                          const std::vector< PointAndSolution<S> > & points);
+
+
 }  // namespace utility
 
 